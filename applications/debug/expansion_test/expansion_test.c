@@ -27,6 +27,10 @@
  * - Waits 5 cycles of idle loop (1 second),
  * - Stops the RPC session,
  * - Disables OTG (5V) on GPIO via plain expansion protocol,
+ * - Reconnects at several baud rates with and without bulk mode and
+ *   logs RPC ping latency and throughput for each of them,
+ * - In bulk mode, also keeps its send window full with large pings while
+ *   the host streams the responses back, confirming them only afterwards,
  * - Exits (plays a sound if any of the above steps failed).
  */
 #include <furi.h>
@@ -56,7 +60,18 @@
 #define HOST_SERIAL_ID   (FuriHalSerialIdLpuart)
 #define MODULE_SERIAL_ID (FuriHalSerialIdUsart)
 
-#define RECEIVE_BUFFER_SIZE (sizeof(ExpansionFrame) + sizeof(ExpansionFrameChecksum))
+#define FRAME_SIZE          (sizeof(ExpansionFrame) + sizeof(ExpansionFrameChecksum))
+// Host may send a full window of bulk frames and confirmations without waiting
+#define RECEIVE_BUFFER_SIZE (FRAME_SIZE * (EXPANSION_PROTOCOL_BULK_WINDOW_SIZE + 1))
+#define DMA_CHUNK_SIZE      (64UL)
+
+#define BENCHMARK_PING_COUNT     (16UL)
+#define BENCHMARK_PING_DATA_SIZE (512UL)
+#define BENCHMARK_RESET_DELAY_MS (EXPANSION_PROTOCOL_TIMEOUT_MS * 3)
+
+// Each request and response takes more than a full window of bulk frames
+#define PIPELINE_PING_COUNT     (8UL)
+#define PIPELINE_PING_DATA_SIZE (1200UL)
 
 typedef enum {
     ExpansionTestAppFlagData = 1U << 0,
@@ -73,19 +88,32 @@ typedef struct {
     ExpansionFrame frame;
     PB_Main msg;
     Storage* storage;
+    // Bulk mode state
+    bool bulk_mode;
+    uint32_t tx_pending;
+    // Data frame payload being decoded as RPC message
+    uint8_t rx_data[EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE];
+    size_t rx_data_size;
+    size_t rx_data_pos;
 } ExpansionTestApp;
 
 static void expansion_test_app_serial_rx_callback(
     FuriHalSerialHandle* handle,
     FuriHalSerialRxEvent event,
+    size_t data_len,
     void* context) {
     furi_assert(handle);
     furi_assert(context);
     ExpansionTestApp* app = context;
 
-    if(event == FuriHalSerialRxEventData) {
-        const uint8_t data = furi_hal_serial_async_rx(handle);
-        furi_stream_buffer_send(app->buf, &data, sizeof(data), 0);
+    if(event & (FuriHalSerialRxEventData | FuriHalSerialRxEventIdle)) {
+        uint8_t data[DMA_CHUNK_SIZE];
+        while(data_len) {
+            const size_t chunk_size =
+                furi_hal_serial_dma_rx(handle, data, MIN(data_len, DMA_CHUNK_SIZE));
+            furi_stream_buffer_send(app->buf, data, chunk_size, 0);
+            data_len -= chunk_size;
+        }
         furi_thread_flags_set(app->thread_id, ExpansionTestAppFlagData);
     }
 }
@@ -111,7 +139,7 @@ static void expansion_test_app_start(ExpansionTestApp* instance) {
     // Start waiting for the initial pulse
     expansion_set_listen_serial(instance->expansion, HOST_SERIAL_ID);
 
-    furi_hal_serial_async_rx_start(
+    furi_hal_serial_dma_rx_start(
         instance->handle, expansion_test_app_serial_rx_callback, instance, false);
 }
 
@@ -215,64 +243,153 @@ static bool expansion_test_app_send_data_request(
     ExpansionTestApp* instance,
     const uint8_t* data,
     size_t data_size) {
-    furi_assert(data_size <= EXPANSION_PROTOCOL_MAX_DATA_SIZE);
-
-    ExpansionFrame frame = {
-        .header.type = ExpansionFrameTypeData,
-        .content.data.size = data_size,
-    };
+    ExpansionFrame* frame = &instance->frame;
+
+    if(instance->bulk_mode) {
+        furi_assert(data_size <= EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE);
+        frame->header.type = ExpansionFrameTypeBulkData;
+        frame->content.bulk_data.size = data_size;
+        memcpy(frame->content.bulk_data.bytes, data, data_size);
+    } else {
+        furi_assert(data_size <= EXPANSION_PROTOCOL_MAX_DATA_SIZE);
+        frame->header.type = ExpansionFrameTypeData;
+        frame->content.data.size = data_size;
+        memcpy(frame->content.data.bytes, data, data_size);
+    }
 
-    memcpy(frame.content.data.bytes, data, data_size);
-    return expansion_protocol_encode(&frame, expansion_test_app_send_callback, instance) ==
+    return expansion_protocol_encode(frame, expansion_test_app_send_callback, instance) ==
            ExpansionProtocolStatusOk;
 }
 
-static bool expansion_test_app_rpc_encode_callback(
-    pb_ostream_t* stream,
-    const pb_byte_t* data,
-    size_t data_size) {
-    ExpansionTestApp* instance = stream->state;
+// Handles status and data frames, which may come in any order in bulk mode
+static bool expansion_test_app_process_frame(ExpansionTestApp* instance) {
+    bool success = false;
+    ExpansionFrame* frame = &instance->frame;
 
-    size_t size_sent = 0;
+    do {
+        if(!expansion_test_app_receive_frame(instance, frame)) break;
+
+        if(frame->header.type == ExpansionFrameTypeStatus) {
+            if(frame->content.status.error != ExpansionFrameErrorNone) break;
+            if(instance->tx_pending == 0) break;
+            instance->tx_pending--;
+
+        } else if(
+            frame->header.type == ExpansionFrameTypeData ||
+            (instance->bulk_mode && frame->header.type == ExpansionFrameTypeBulkData)) {
+            // Previous payload must be consumed first
+            if(instance->rx_data_pos < instance->rx_data_size) break;
+
+            if(frame->header.type == ExpansionFrameTypeBulkData) {
+                instance->rx_data_size = frame->content.bulk_data.size;
+                memcpy(instance->rx_data, frame->content.bulk_data.bytes, instance->rx_data_size);
+            } else {
+                instance->rx_data_size = frame->content.data.size;
+                memcpy(instance->rx_data, frame->content.data.bytes, instance->rx_data_size);
+            }
+            instance->rx_data_pos = 0;
+
+            if(!expansion_test_app_send_status_response(instance, ExpansionFrameErrorNone)) break;
+
+        } else {
+            break;
+        }
 
-    while(size_sent < data_size) {
-        const size_t current_size = MIN(data_size - size_sent, EXPANSION_PROTOCOL_MAX_DATA_SIZE);
-        if(!expansion_test_app_send_data_request(instance, data + size_sent, current_size)) break;
-        if(!expansion_test_app_receive_frame(instance, &instance->frame)) break;
-        if(!expansion_test_app_is_success_response(&instance->frame)) break;
-        size_sent += current_size;
-    }
+        success = true;
+    } while(false);
 
-    return size_sent == data_size;
+    return success;
 }
 
 static bool expansion_test_app_send_rpc_request(ExpansionTestApp* instance, PB_Main* message) {
-    pb_ostream_t stream = {
-        .callback = expansion_test_app_rpc_encode_callback,
-        .state = instance,
-        .max_size = SIZE_MAX,
-        .bytes_written = 0,
-        .errmsg = NULL,
-    };
+    bool success = false;
+    uint8_t* buffer = NULL;
+
+    do {
+        // Encode whole message first, so it is split into as few frames as possible
+        pb_ostream_t stream = PB_OSTREAM_SIZING;
+        if(!pb_encode_ex(&stream, &PB_Main_msg, message, PB_ENCODE_DELIMITED)) break;
+
+        const size_t encoded_size = stream.bytes_written;
+        buffer = malloc(encoded_size);
+        stream = pb_ostream_from_buffer(buffer, encoded_size);
+        if(!pb_encode_ex(&stream, &PB_Main_msg, message, PB_ENCODE_DELIMITED)) break;
+
+        const size_t max_frame_data_size = instance->bulk_mode ?
+                                               EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE :
+                                               EXPANSION_PROTOCOL_MAX_DATA_SIZE;
+        const uint32_t window_size = instance->bulk_mode ? EXPANSION_PROTOCOL_BULK_WINDOW_SIZE : 1;
+
+        size_t size_sent = 0;
+        while(size_sent < encoded_size) {
+            // Wait for a free slot in the window
+            if(instance->tx_pending >= window_size) {
+                if(!expansion_test_app_process_frame(instance)) break;
+                continue;
+            }
+
+            const size_t current_size = MIN(encoded_size - size_sent, max_frame_data_size);
+            if(!expansion_test_app_send_data_request(instance, buffer + size_sent, current_size))
+                break;
+            instance->tx_pending++;
+            size_sent += current_size;
+        }
 
-    const bool success = pb_encode_ex(&stream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
+        success = size_sent == encoded_size;
+    } while(false);
+
+    free(buffer);
     pb_release(&PB_Main_msg, message);
     return success;
 }
 
+static bool expansion_test_app_rpc_decode_callback(
+    pb_istream_t* stream,
+    pb_byte_t* data,
+    size_t data_size) {
+    ExpansionTestApp* instance = stream->state;
+
+    size_t size_received = 0;
+
+    while(size_received < data_size) {
+        if(instance->rx_data_pos == instance->rx_data_size) {
+            if(!expansion_test_app_process_frame(instance)) break;
+            continue;
+        }
+
+        const size_t current_size =
+            MIN(data_size - size_received, instance->rx_data_size - instance->rx_data_pos);
+        memcpy(data + size_received, instance->rx_data + instance->rx_data_pos, current_size);
+        instance->rx_data_pos += current_size;
+        size_received += current_size;
+    }
+
+    return size_received == data_size;
+}
+
 static bool expansion_test_app_receive_rpc_request(ExpansionTestApp* instance, PB_Main* message) {
     bool success = false;
 
+    pb_istream_t stream = {
+        .callback = expansion_test_app_rpc_decode_callback,
+        .state = instance,
+        .bytes_left = SIZE_MAX,
+        .errmsg = NULL,
+    };
+
     do {
-        if(!expansion_test_app_receive_frame(instance, &instance->frame)) break;
-        if(!expansion_test_app_send_status_response(instance, ExpansionFrameErrorNone)) break;
-        if(instance->frame.header.type != ExpansionFrameTypeData) break;
-        pb_istream_t stream = pb_istream_from_buffer(
-            instance->frame.content.data.bytes, instance->frame.content.data.size);
         if(!pb_decode_ex(&stream, &PB_Main_msg, message, PB_DECODE_DELIMITED)) break;
+        // Collect confirmations for the rest of request frames
+        while(instance->tx_pending > 0) {
+            if(!expansion_test_app_process_frame(instance)) break;
+        }
+        if(instance->tx_pending > 0) break;
         success = true;
     } while(false);
 
+    instance->rx_data_size = 0;
+    instance->rx_data_pos = 0;
+
     return success;
 }
 
@@ -296,14 +413,14 @@ static bool expansion_test_app_wait_ready(ExpansionTestApp* instance) {
     return success;
 }
 
-static bool expansion_test_app_handshake(ExpansionTestApp* instance) {
+static bool expansion_test_app_handshake(ExpansionTestApp* instance, uint32_t baud_rate) {
     bool success = false;
 
     do {
-        if(!expansion_test_app_send_baud_rate_request(instance, 230400)) break;
+        if(!expansion_test_app_send_baud_rate_request(instance, baud_rate)) break;
         if(!expansion_test_app_receive_frame(instance, &instance->frame)) break;
         if(!expansion_test_app_is_success_response(&instance->frame)) break;
-        furi_hal_serial_set_br(instance->handle, 230400);
+        furi_hal_serial_set_br(instance->handle, baud_rate);
         furi_delay_ms(EXPANSION_PROTOCOL_BAUD_CHANGE_DT_MS);
         success = true;
     } while(false);
@@ -311,6 +428,22 @@ static bool expansion_test_app_handshake(ExpansionTestApp* instance) {
     return success;
 }
 
+static bool expansion_test_app_enable_bulk(ExpansionTestApp* instance) {
+    bool success = false;
+
+    do {
+        if(!expansion_test_app_send_control_request(
+               instance, ExpansionFrameControlCommandEnableBulk))
+            break;
+        if(!expansion_test_app_receive_frame(instance, &instance->frame)) break;
+        if(!expansion_test_app_is_success_response(&instance->frame)) break;
+        instance->bulk_mode = true;
+        success = true;
+    } while(false);
+
+    return success;
+}
+
 static bool expansion_test_app_enable_otg(ExpansionTestApp* instance, bool enable) {
     bool success = false;
 
@@ -468,6 +601,251 @@ static bool expansion_test_app_stop_rpc(ExpansionTestApp* instance) {
     return success;
 }
 
+static bool expansion_test_app_rpc_ping(ExpansionTestApp* instance, size_t data_size) {
+    bool success = false;
+
+    instance->msg.command_id++;
+    instance->msg.command_status = PB_CommandStatus_OK;
+    instance->msg.which_content = PB_Main_system_ping_request_tag;
+    instance->msg.has_next = false;
+    instance->msg.content.system_ping_request.data = NULL;
+
+    if(data_size) {
+        pb_bytes_array_t* data = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(data_size));
+        data->size = data_size;
+        for(size_t i = 0; i < data_size; ++i) {
+            data->bytes[i] = i;
+        }
+        instance->msg.content.system_ping_request.data = data;
+    }
+
+    do {
+        if(!expansion_test_app_send_rpc_request(instance, &instance->msg)) break;
+        if(!expansion_test_app_receive_rpc_request(instance, &instance->msg)) break;
+        if(instance->msg.which_content != PB_Main_system_ping_response_tag) break;
+        if(instance->msg.command_status != PB_CommandStatus_OK) break;
+        const pb_bytes_array_t* data = instance->msg.content.system_ping_response.data;
+        if((data ? data->size : 0) != data_size) break;
+        success = true;
+    } while(false);
+
+    pb_release(&PB_Main_msg, &instance->msg);
+
+    return success;
+}
+
+static size_t expansion_test_app_encode_pipeline_ping(
+    ExpansionTestApp* instance,
+    uint8_t* buffer,
+    size_t buffer_size,
+    pb_size_t which_content) {
+    pb_bytes_array_t* data = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(PIPELINE_PING_DATA_SIZE));
+    data->size = PIPELINE_PING_DATA_SIZE;
+    for(size_t i = 0; i < PIPELINE_PING_DATA_SIZE; ++i) {
+        data->bytes[i] = i + instance->msg.command_id;
+    }
+
+    instance->msg.command_status = PB_CommandStatus_OK;
+    instance->msg.which_content = which_content;
+    instance->msg.has_next = false;
+    // Request and response only differ by tag
+    if(which_content == PB_Main_system_ping_request_tag) {
+        instance->msg.content.system_ping_request.data = data;
+    } else {
+        instance->msg.content.system_ping_response.data = data;
+    }
+
+    // Only compute the size when there is no buffer
+    pb_ostream_t stream = PB_OSTREAM_SIZING;
+    if(buffer) stream = pb_ostream_from_buffer(buffer, buffer_size);
+    const bool success = pb_encode_ex(&stream, &PB_Main_msg, &instance->msg, PB_ENCODE_DELIMITED);
+    pb_release(&PB_Main_msg, &instance->msg);
+
+    return success ? stream.bytes_written : 0;
+}
+
+// Keeps the send window full and confirms host frames only after that, so that
+// host confirmations always queue up behind a full window of its input
+static bool expansion_test_app_rpc_pipeline(ExpansionTestApp* instance) {
+    bool success = false;
+
+    const uint32_t command_id = instance->msg.command_id;
+    size_t request_size = 0;
+    size_t response_size = 0;
+
+    for(uint32_t i = 0; i < PIPELINE_PING_COUNT; ++i) {
+        instance->msg.command_id = command_id + i + 1;
+        request_size += expansion_test_app_encode_pipeline_ping(
+            instance, NULL, 0, PB_Main_system_ping_request_tag);
+        response_size += expansion_test_app_encode_pipeline_ping(
+            instance, NULL, 0, PB_Main_system_ping_response_tag);
+    }
+
+    uint8_t* request = malloc(request_size);
+    uint8_t* response = malloc(response_size);
+
+    size_t size_encoded = 0;
+    for(uint32_t i = 0; i < PIPELINE_PING_COUNT; ++i) {
+        instance->msg.command_id = command_id + i + 1;
+        size_encoded += expansion_test_app_encode_pipeline_ping(
+            instance,
+            request + size_encoded,
+            request_size - size_encoded,
+            PB_Main_system_ping_request_tag);
+    }
+
+    size_t size_sent = 0;
+    size_t size_received = 0;
+    uint32_t rx_pending = 0;
+
+    // Nothing is sent if any of the requests failed to encode
+    while(size_encoded == request_size) {
+        while(size_sent < request_size &&
+              instance->tx_pending < EXPANSION_PROTOCOL_BULK_WINDOW_SIZE) {
+            const size_t current_size =
+                MIN(request_size - size_sent, EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE);
+            if(!expansion_test_app_send_data_request(instance, request + size_sent, current_size))
+                break;
+            instance->tx_pending++;
+            size_sent += current_size;
+        }
+        if(size_sent < request_size &&
+           instance->tx_pending < EXPANSION_PROTOCOL_BULK_WINDOW_SIZE)
+            break;
+
+        for(; rx_pending > 0; --rx_pending) {
+            if(!expansion_test_app_send_status_response(instance, ExpansionFrameErrorNone)) break;
+        }
+        if(rx_pending > 0) break;
+
+        if(size_sent == request_size && instance->tx_pending == 0 &&
+           size_received == response_size) {
+            success = true;
+            break;
+        }
+
+        ExpansionFrame* frame = &instance->frame;
+        if(!expansion_test_app_receive_frame(instance, frame)) break;
+
+        if(frame->header.type == ExpansionFrameTypeStatus) {
+            if(frame->content.status.error != ExpansionFrameErrorNone) break;
+            if(instance->tx_pending == 0) break;
+            instance->tx_pending--;
+
+        } else if(frame->header.type == ExpansionFrameTypeBulkData) {
+            const size_t current_size = frame->content.bulk_data.size;
+            if(current_size > response_size - size_received) break;
+            memcpy(response + size_received, frame->content.bulk_data.bytes, current_size);
+            size_received += current_size;
+            rx_pending++;
+
+        } else {
+            break;
+        }
+    }
+
+    pb_istream_t stream = pb_istream_from_buffer(response, size_received);
+
+    for(uint32_t i = 0; success && i < PIPELINE_PING_COUNT; ++i) {
+        success = false;
+        do {
+            if(!pb_decode_ex(&stream, &PB_Main_msg, &instance->msg, PB_DECODE_DELIMITED)) break;
+            if(instance->msg.command_id != command_id + i + 1) break;
+            if(instance->msg.which_content != PB_Main_system_ping_response_tag) break;
+            if(instance->msg.command_status != PB_CommandStatus_OK) break;
+            const pb_bytes_array_t* data = instance->msg.content.system_ping_response.data;
+            if(!data || data->size != PIPELINE_PING_DATA_SIZE) break;
+            if(data->bytes[data->size - 1] != (uint8_t)(data->size - 1 + command_id + i + 1))
+                break;
+            success = true;
+        } while(false);
+        pb_release(&PB_Main_msg, &instance->msg);
+    }
+
+    free(response);
+    free(request);
+
+    return success;
+}
+
+static void expansion_test_app_reset_connection(ExpansionTestApp* instance) {
+    // Stay silent until the host drops the connection and starts listening again
+    furi_delay_ms(BENCHMARK_RESET_DELAY_MS);
+    furi_hal_serial_set_br(instance->handle, EXPANSION_PROTOCOL_DEFAULT_BAUD_RATE);
+    furi_stream_buffer_reset(instance->buf);
+    instance->bulk_mode = false;
+    instance->tx_pending = 0;
+}
+
+static bool expansion_test_app_benchmark_run(
+    ExpansionTestApp* instance,
+    uint32_t baud_rate,
+    bool bulk_mode) {
+    bool success = false;
+
+    do {
+        if(!expansion_test_app_send_presence(instance)) break;
+        if(!expansion_test_app_wait_ready(instance)) break;
+        if(!expansion_test_app_handshake(instance, baud_rate)) break;
+        if(bulk_mode && !expansion_test_app_enable_bulk(instance)) break;
+        if(!expansion_test_app_start_rpc(instance)) break;
+
+        uint32_t tick_start = furi_get_tick();
+        uint32_t ping_count;
+        for(ping_count = 0; ping_count < BENCHMARK_PING_COUNT; ++ping_count) {
+            if(!expansion_test_app_rpc_ping(instance, 0)) break;
+        }
+        if(ping_count != BENCHMARK_PING_COUNT) break;
+        const uint32_t latency_us = (furi_get_tick() - tick_start) * 1000 / BENCHMARK_PING_COUNT;
+
+        tick_start = furi_get_tick();
+        for(ping_count = 0; ping_count < BENCHMARK_PING_COUNT; ++ping_count) {
+            if(!expansion_test_app_rpc_ping(instance, BENCHMARK_PING_DATA_SIZE)) break;
+        }
+        if(ping_count != BENCHMARK_PING_COUNT) break;
+        const uint32_t elapsed_ms = MAX(furi_get_tick() - tick_start, 1UL);
+        // Payload goes both ways
+        const uint32_t throughput =
+            BENCHMARK_PING_COUNT * BENCHMARK_PING_DATA_SIZE * 2 * 1000 / elapsed_ms;
+
+        FURI_LOG_I(
+            TAG,
+            "%7lu baud, %s: ping %lu us, throughput %lu B/s",
+            baud_rate,
+            bulk_mode ? "bulk" : "legacy",
+            latency_us,
+            throughput);
+
+        if(bulk_mode && !expansion_test_app_rpc_pipeline(instance)) break;
+        if(!expansion_test_app_stop_rpc(instance)) break;
+        success = true;
+    } while(false);
+
+    expansion_test_app_reset_connection(instance);
+
+    return success;
+}
+
+static bool expansion_test_app_benchmark(ExpansionTestApp* instance) {
+    static const uint32_t baud_rates[] = {115200, 230400, 460800, 921600};
+
+    bool success = true;
+    expansion_test_app_reset_connection(instance);
+
+    for(size_t i = 0; i < COUNT_OF(baud_rates); ++i) {
+        if(!furi_hal_serial_is_baud_rate_supported(instance->handle, baud_rates[i])) continue;
+
+        for(uint32_t bulk_mode = 0; bulk_mode < 2; ++bulk_mode) {
+            if(!expansion_test_app_benchmark_run(instance, baud_rates[i], bulk_mode)) {
+                FURI_LOG_E(TAG, "Benchmark failed at %lu baud", baud_rates[i]);
+                success = false;
+            }
+        }
+    }
+
+    return success;
+}
+
 int32_t expansion_test_app(void* p) {
     UNUSED(p);
 
@@ -479,7 +857,7 @@ int32_t expansion_test_app(void* p) {
     do {
         if(!expansion_test_app_send_presence(instance)) break;
         if(!expansion_test_app_wait_ready(instance)) break;
-        if(!expansion_test_app_handshake(instance)) break;
+        if(!expansion_test_app_handshake(instance, 230400)) break;
         if(!expansion_test_app_enable_otg(instance, true)) break;
         if(!expansion_test_app_idle(instance, 5)) break;
         if(!expansion_test_app_start_rpc(instance)) break;
@@ -492,6 +870,7 @@ int32_t expansion_test_app(void* p) {
         if(!expansion_test_app_idle(instance, 5)) break;
         if(!expansion_test_app_stop_rpc(instance)) break;
         if(!expansion_test_app_enable_otg(instance, false)) break;
+        if(!expansion_test_app_benchmark(instance)) break;
         success = true;
     } while(false);
 
@@ -0,0 +1,30 @@
+let tests = require("tests");
+
+// Allocation stress: short-lived objects and strings created in a loop should
+// be collected automatically, without the script calling gc() itself
+let before = tests.gc_stats();
+
+let survivors = [];
+for (let i = 0; i < 2000; i++) {
+    let obj = { index: i, name: "object number " + i.toString() };
+    if (i % 100 === 0) {
+        survivors.push(obj);
+    }
+}
+
+let after = tests.gc_stats();
+tests.assert_eq(true, after.collections > before.collections);
+tests.assert_eq(true, after.cellsReclaimed > before.cellsReclaimed);
+tests.assert_eq(true, after.bytesReclaimed > before.bytesReclaimed);
+tests.assert_eq(20, survivors.length);
+tests.assert_eq("object number 1900", survivors[19].name);
+
+let histogram_total = 0;
+for (let i = 0; i < after.pauseHistogram.length; i++) {
+    histogram_total += after.pauseHistogram[i];
+}
+tests.assert_eq(after.collections, histogram_total);
+
+print("gc: collections", after.collections - before.collections,
+    "max pause us", after.pauseMaxUs,
+    "total pause us", after.pauseTotalUs - before.pauseTotalUs);
@@ -1,6 +1,7 @@
 #include <furi.h>
 #include "../test.h" // IWYU pragma: keep
 #include <bit_lib/bit_lib.h>
+#include <bit_lib/bit_lib_stream.h>
 
 MU_TEST(test_bit_lib_increment_index) {
     uint32_t index = 0;
@@ -708,6 +709,56 @@ MU_TEST(test_bit_lib_bytes_to_num_bcd) {
     mu_assert_int_eq(false, is_bcd_res);
 }
 
+MU_TEST(test_bit_lib_stream) {
+#define TEST_BIT_LIB_STREAM_DATA_SIZE 12
+    uint8_t data[TEST_BIT_LIB_STREAM_DATA_SIZE] = {0};
+    uint8_t stream_data[TEST_BIT_LIB_STREAM_DATA_SIZE];
+    BitLibStream* stream = bit_lib_stream_alloc(TEST_BIT_LIB_STREAM_DATA_SIZE * 8);
+
+    // Same window as bit_lib_push_bit, across several wraps
+    uint32_t seed = 0x1234567;
+    for(uint32_t i = 0; i < 1000; ++i) {
+        seed = seed * 1103515245 + 12345;
+        const bool bit = seed & 0x10000;
+
+        bit_lib_push_bit(data, TEST_BIT_LIB_STREAM_DATA_SIZE, bit);
+        mu_check(bit_lib_stream_push(stream, bit));
+
+        const size_t position = (seed >> 8) % (TEST_BIT_LIB_STREAM_DATA_SIZE * 8 - 32);
+        const uint8_t length = 1 + (seed >> 20) % 32;
+        mu_assert_int_eq(
+            bit_lib_get_bits_32(data, position, length),
+            bit_lib_stream_get_bits_32(stream, position, length));
+    }
+
+    bit_lib_stream_read(stream, stream_data, TEST_BIT_LIB_STREAM_DATA_SIZE);
+    mu_assert_mem_eq(data, stream_data, TEST_BIT_LIB_STREAM_DATA_SIZE);
+
+    // Preamble at the start and the end of the window
+    const BitLibStreamPattern patterns[] = {
+        {.position = 0, .length = 8, .value = 0x1D},
+        {.position = 88, .length = 8, .value = 0x1D},
+    };
+    bit_lib_stream_set_patterns(stream, patterns, COUNT_OF(patterns));
+    bit_lib_stream_reset(stream);
+
+    const uint8_t frame[] = {0x1D, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55};
+    uint32_t matches = 0;
+    for(uint32_t repeat = 0; repeat < 3; ++repeat) {
+        for(uint32_t i = 0; i < sizeof(frame) * 8; ++i) {
+            if(bit_lib_stream_push(stream, bit_lib_get_bit(frame, i))) {
+                matches++;
+                bit_lib_stream_read(stream, stream_data, TEST_BIT_LIB_STREAM_DATA_SIZE);
+                mu_assert_mem_eq(frame, stream_data, sizeof(frame));
+                mu_assert_int_eq(0x1D, stream_data[TEST_BIT_LIB_STREAM_DATA_SIZE - 1]);
+            }
+        }
+    }
+    mu_assert_int_eq(2, matches);
+
+    bit_lib_stream_free(stream);
+}
+
 MU_TEST_SUITE(test_bit_lib) {
     MU_RUN_TEST(test_bit_lib_increment_index);
     MU_RUN_TEST(test_bit_lib_is_set);
@@ -732,6 +783,7 @@ MU_TEST_SUITE(test_bit_lib) {
     MU_RUN_TEST(test_bit_lib_bytes_to_num_be);
     MU_RUN_TEST(test_bit_lib_bytes_to_num_le);
     MU_RUN_TEST(test_bit_lib_bytes_to_num_bcd);
+    MU_RUN_TEST(test_bit_lib_stream);
 }
 
 int run_minunit_test_bit_lib(void) {
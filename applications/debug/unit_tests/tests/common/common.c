@@ -2,6 +2,7 @@
 #include "../minunit_vars.h"
 
 #include <furi.h>
+#include <furi_hal.h>
 
 void minunit_print_progress(void) {
     static const char progress[] = {'\\', '|', '/', '-'};
@@ -40,3 +41,16 @@ int get_minunit_assert(void) {
 int get_minunit_status(void) {
     return minunit_status;
 }
+
+void test_bench_start(TestBench* bench) {
+    bench->start = DWT->CYCCNT;
+}
+
+void test_bench_stop(TestBench* bench) {
+    bench->cycles += DWT->CYCCNT - bench->start;
+}
+
+uint32_t test_bench_get_ns(const TestBench* bench, uint32_t count) {
+    return bench->cycles * 1000 / (count ? count : 1) /
+           furi_hal_cortex_instructions_per_microsecond();
+}
@@ -338,11 +338,133 @@ static void compress_test_heatshrink_tar() {
     furi_record_close(RECORD_STORAGE);
 }
 
+#define TAR_UNPACK_SRC_PATH     COMPRESS_UNIT_TESTS_PATH("tar_unpack_src")
+#define TAR_UNPACK_PATH         COMPRESS_UNIT_TESTS_PATH("tar_unpack.tar")
+#define TAR_UNPACK_EXTRACT_PATH COMPRESS_UNIT_TESTS_PATH("tar_unpack_out")
+#define TAR_UNPACK_DIR_COUNT    4
+#define TAR_UNPACK_FILE_COUNT   24
+#define TAR_UNPACK_BIG_FILE_LEN (96 * 1024)
+
+// Every file of source tree must have a counterpart with the same MD5 in output tree
+static void tar_unpack_compare_trees(Storage* api, const char* src_path, const char* out_path) {
+    uint8_t md5_src[16], md5_out[16];
+    FuriString* path = furi_string_alloc();
+    FuriString* path_out = furi_string_alloc();
+    File* file = storage_file_alloc(api);
+    FileInfo fileinfo;
+    uint32_t src_files = 0, out_files = 0;
+
+    DirWalk* dir_walk = dir_walk_alloc(api);
+    mu_assert(dir_walk_open(dir_walk, src_path), "Failed to open dirwalk");
+    while(dir_walk_read(dir_walk, path, &fileinfo) == DirWalkOK) {
+        if(file_info_is_dir(&fileinfo)) {
+            continue;
+        }
+        furi_string_printf(
+            path_out, "%s%s", out_path, furi_string_get_cstr(path) + strlen(src_path));
+        mu_assert(
+            md5_calc_file(file, furi_string_get_cstr(path), md5_src, NULL),
+            "Failed to calc md5");
+        mu_assert(
+            md5_calc_file(file, furi_string_get_cstr(path_out), md5_out, NULL),
+            "Unpacked file is missing");
+        mu_assert(memcmp(md5_src, md5_out, sizeof(md5_src)) == 0, "MD5 mismatch");
+        src_files++;
+    }
+    dir_walk_close(dir_walk);
+
+    // No extra files in output
+    mu_assert(dir_walk_open(dir_walk, out_path), "Failed to open dirwalk");
+    while(dir_walk_read(dir_walk, path, &fileinfo) == DirWalkOK) {
+        if(!file_info_is_dir(&fileinfo)) {
+            out_files++;
+        }
+    }
+    dir_walk_free(dir_walk);
+    mu_assert_int_eq(src_files, out_files);
+
+    storage_file_free(file);
+    furi_string_free(path_out);
+    furi_string_free(path);
+}
+
+static void tar_unpack_prepare(Storage* api) {
+    storage_simply_remove_recursive(api, TAR_UNPACK_SRC_PATH);
+    mu_assert(storage_simply_mkdir(api, TAR_UNPACK_SRC_PATH), "Failed to create source dir");
+
+    FuriString* path = furi_string_alloc();
+    File* file = storage_file_alloc(api);
+    uint8_t* data = malloc(TAR_UNPACK_BIG_FILE_LEN);
+    furi_hal_random_fill_buf(data, TAR_UNPACK_BIG_FILE_LEN);
+
+    // Many small files in nested folders, like resources bundle has
+    for(uint32_t dir = 0; dir < TAR_UNPACK_DIR_COUNT; dir++) {
+        furi_string_printf(path, "%s/dir%lu", TAR_UNPACK_SRC_PATH, dir);
+        mu_assert(storage_simply_mkdir(api, furi_string_get_cstr(path)), "Failed to create dir");
+
+        for(uint32_t i = 0; i < TAR_UNPACK_FILE_COUNT; i++) {
+            furi_string_printf(path, "%s/dir%lu/file%lu.txt", TAR_UNPACK_SRC_PATH, dir, i);
+            size_t size = (dir * TAR_UNPACK_FILE_COUNT + i) * 97 % 6000;
+            mu_assert(
+                storage_file_open(
+                    file, furi_string_get_cstr(path), FSAM_WRITE, FSOM_CREATE_ALWAYS),
+                "Failed to create file");
+            mu_assert(storage_file_write(file, data + i, size) == size, "Failed to write");
+            storage_file_close(file);
+        }
+    }
+
+    mu_assert(
+        storage_file_open(
+            file, TAR_UNPACK_SRC_PATH "/big_file.bin", FSAM_WRITE, FSOM_CREATE_ALWAYS),
+        "Failed to create file");
+    mu_assert(
+        storage_file_write(file, data, TAR_UNPACK_BIG_FILE_LEN) == TAR_UNPACK_BIG_FILE_LEN,
+        "Failed to write");
+    storage_file_close(file);
+
+    free(data);
+    storage_file_free(file);
+    furi_string_free(path);
+}
+
+static void compress_test_tar_unpack_to() {
+    Storage* api = furi_record_open(RECORD_STORAGE);
+    tar_unpack_prepare(api);
+
+    TarArchive* archive = tar_archive_alloc(api);
+    mu_assert(tar_archive_open(archive, TAR_UNPACK_PATH, TarOpenModeWrite), "Failed to open tar");
+    mu_assert(tar_archive_add_dir(archive, TAR_UNPACK_SRC_PATH, ""), "Failed to pack");
+    mu_assert(tar_archive_finalize(archive), "Failed to finalize tar");
+    tar_archive_free(archive);
+
+    storage_simply_remove_recursive(api, TAR_UNPACK_EXTRACT_PATH);
+    mu_assert(storage_simply_mkdir(api, TAR_UNPACK_EXTRACT_PATH), "Failed to create extract dir");
+
+    archive = tar_archive_alloc(api);
+    mu_assert(tar_archive_open(archive, TAR_UNPACK_PATH, TarOpenModeRead), "Failed to open tar");
+
+    mu_assert(tar_archive_unpack_to(archive, TAR_UNPACK_EXTRACT_PATH, NULL), "Failed to unpack");
+
+    int32_t files = 0;
+    tar_archive_get_unpack_stats(archive, &files, NULL);
+    tar_archive_free(archive);
+
+    mu_assert_int_eq(TAR_UNPACK_DIR_COUNT * TAR_UNPACK_FILE_COUNT + 1, files);
+    tar_unpack_compare_trees(api, TAR_UNPACK_SRC_PATH, TAR_UNPACK_EXTRACT_PATH);
+
+    storage_simply_remove_recursive(api, TAR_UNPACK_SRC_PATH);
+    storage_simply_remove_recursive(api, TAR_UNPACK_EXTRACT_PATH);
+    storage_simply_remove(api, TAR_UNPACK_PATH);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(test_compress) {
     MU_RUN_TEST(compress_test_random_comp_decomp);
     MU_RUN_TEST(compress_test_reference_comp_decomp);
     MU_RUN_TEST(compress_test_heatshrink_stream);
     MU_RUN_TEST(compress_test_heatshrink_tar);
+    MU_RUN_TEST(compress_test_tar_unpack_to);
 }
 
 int run_minunit_test_compress(void) {
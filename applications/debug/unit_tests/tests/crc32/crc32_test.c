@@ -0,0 +1,142 @@
+#include <furi.h>
+#include <furi_hal.h>
+#include <storage/storage.h>
+#include <toolbox/crc32_calc.h>
+
+#include "../test.h" // IWYU pragma: keep
+
+#define TAG "Crc32Test"
+
+#define CRC32_TEST_BUFFER_SIZE  (4096U)
+#define CRC32_TEST_BENCH_ROUNDS (64U)
+#define CRC32_TEST_FILE_PATH    EXT_PATH(".tmp/unit_tests/crc32.bin")
+
+static const char* const crc32_test_engine_names[Crc32EngineNum] = {
+    [Crc32EngineAuto] = "auto",
+    [Crc32EngineNibble] = "nibble",
+    [Crc32EngineSlicing8] = "slicing8",
+    [Crc32EngineHardware] = "hardware",
+};
+
+MU_TEST(crc32_test_check_value) {
+    const char* check = "123456789";
+    for(Crc32Engine engine = 0; engine < Crc32EngineNum; engine++) {
+        mu_assert_int_eq(0xCBF43926, crc32_calc_buffer_ex(engine, 0, check, strlen(check)));
+        mu_assert_int_eq(0, crc32_calc_buffer_ex(engine, 0, check, 0));
+    }
+}
+
+MU_TEST(crc32_test_engines_match_reference) {
+    uint8_t* buffer = malloc(CRC32_TEST_BUFFER_SIZE);
+    furi_hal_random_fill_buf(buffer, CRC32_TEST_BUFFER_SIZE);
+
+    // Every alignment and length around slicing and hardware boundaries, with chaining
+    for(size_t offset = 0; offset < 8; offset++) {
+        for(size_t size = 0; size < 200; size++) {
+            uint32_t expected = crc32_calc_buffer_ex(Crc32EngineNibble, 0, buffer + offset, size);
+            for(Crc32Engine engine = 0; engine < Crc32EngineNum; engine++) {
+                uint32_t crc = crc32_calc_buffer_ex(engine, 0, buffer + offset, size / 3);
+                crc = crc32_calc_buffer_ex(
+                    engine, crc, buffer + offset + size / 3, size - size / 3);
+                mu_assert_int_eq(expected, crc);
+            }
+        }
+    }
+
+    uint32_t expected = crc32_calc_buffer_ex(Crc32EngineNibble, 0, buffer, CRC32_TEST_BUFFER_SIZE);
+    for(Crc32Engine engine = 0; engine < Crc32EngineNum; engine++) {
+        mu_assert_int_eq(
+            expected, crc32_calc_buffer_ex(engine, 0, buffer, CRC32_TEST_BUFFER_SIZE));
+    }
+
+    free(buffer);
+}
+
+MU_TEST(crc32_test_hardware) {
+    uint32_t* buffer = malloc(CRC32_TEST_BUFFER_SIZE);
+    furi_hal_random_fill_buf((uint8_t*)buffer, CRC32_TEST_BUFFER_SIZE);
+
+    // Peripheral itself, without software fallback
+    uint32_t crc = 0x12345678;
+    mu_assert(
+        furi_hal_crc_calc32(&crc, buffer, CRC32_TEST_BUFFER_SIZE / 4, FuriWaitForever),
+        "CRC peripheral is not available");
+    mu_assert_int_eq(
+        crc32_calc_buffer_ex(Crc32EngineNibble, 0x12345678, buffer, CRC32_TEST_BUFFER_SIZE),
+        crc);
+
+    free(buffer);
+}
+
+MU_TEST(crc32_test_file) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+
+    // Not a multiple of file buffer size
+    const size_t size = CRC32_TEST_BUFFER_SIZE * 3 + 123;
+    uint8_t* buffer = malloc(size);
+    furi_hal_random_fill_buf(buffer, size);
+
+    mu_assert(storage_simply_mkdir(storage, EXT_PATH(".tmp")), "mkdir failed");
+    mu_assert(storage_simply_mkdir(storage, EXT_PATH(".tmp/unit_tests")), "mkdir failed");
+    mu_assert(
+        storage_file_open(file, CRC32_TEST_FILE_PATH, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS),
+        "Failed to create file");
+    mu_assert_int_eq(size, storage_file_write(file, buffer, size));
+
+    const Crc32Engine engine = crc32_calc_get_engine();
+    for(Crc32Engine test_engine = 0; test_engine < Crc32EngineNum; test_engine++) {
+        crc32_calc_set_engine(test_engine);
+        mu_assert_int_eq(
+            crc32_calc_buffer_ex(Crc32EngineNibble, 0, buffer, size),
+            crc32_calc_file(file, NULL, NULL));
+    }
+    crc32_calc_set_engine(engine);
+
+    storage_file_close(file);
+    storage_simply_remove(storage, CRC32_TEST_FILE_PATH);
+
+    free(buffer);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(crc32_test_bench) {
+    uint8_t* buffer = malloc(CRC32_TEST_BUFFER_SIZE);
+    furi_hal_random_fill_buf(buffer, CRC32_TEST_BUFFER_SIZE);
+
+    for(Crc32Engine engine = 0; engine < Crc32EngineNum; engine++) {
+        TestBench bench = {0};
+        uint32_t crc = 0;
+        test_bench_start(&bench);
+        for(size_t i = 0; i < CRC32_TEST_BENCH_ROUNDS; i++) {
+            crc = crc32_calc_buffer_ex(engine, crc, buffer, CRC32_TEST_BUFFER_SIZE);
+        }
+        test_bench_stop(&bench);
+        const uint32_t buffer_ns = test_bench_get_ns(&bench, CRC32_TEST_BENCH_ROUNDS);
+
+        FURI_LOG_I(
+            TAG,
+            "%s: %lu us per %u bytes",
+            crc32_test_engine_names[engine],
+            buffer_ns / 1000,
+            CRC32_TEST_BUFFER_SIZE);
+    }
+
+    free(buffer);
+}
+
+MU_TEST_SUITE(crc32_test_suite) {
+    MU_RUN_TEST(crc32_test_check_value);
+    MU_RUN_TEST(crc32_test_engines_match_reference);
+    MU_RUN_TEST(crc32_test_hardware);
+    MU_RUN_TEST(crc32_test_file);
+    MU_RUN_TEST(crc32_test_bench);
+}
+
+int run_minunit_test_crc32(void) {
+    MU_RUN_SUITE(crc32_test_suite);
+    return MU_EXIT_CODE;
+}
+
+TEST_API_DEFINE(run_minunit_test_crc32)
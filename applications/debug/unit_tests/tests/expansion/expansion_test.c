@@ -6,7 +6,7 @@
 #include <expansion/expansion_protocol.h>
 
 #define EXPANSION_TEST_GARBAGE_MAGIC      (0xB19AF)
-#define EXPANSION_TEST_GARBAGE_BUF_SIZE   (0x100U)
+#define EXPANSION_TEST_GARBAGE_BUF_SIZE   (0x200U)
 #define EXPANSION_TEST_GARBAGE_ITERATIONS (100U)
 
 MU_TEST(test_expansion_encoded_size) {
@@ -29,6 +29,12 @@ MU_TEST(test_expansion_encoded_size) {
         frame.content.data.size = i;
         mu_assert_int_eq(i + 2, expansion_frame_get_encoded_size(&frame));
     }
+
+    frame.header.type = ExpansionFrameTypeBulkData;
+    for(size_t i = 0; i <= EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE; ++i) {
+        frame.content.bulk_data.size = i;
+        mu_assert_int_eq(i + 3, expansion_frame_get_encoded_size(&frame));
+    }
 }
 
 MU_TEST(test_expansion_remaining_size) {
@@ -90,6 +96,24 @@ MU_TEST(test_expansion_remaining_size) {
     }
     mu_check(expansion_frame_get_remaining_size(&frame, 100, &remaining_size));
     mu_assert_int_eq(0, remaining_size);
+
+    frame.header.type = ExpansionFrameTypeBulkData;
+    frame.content.bulk_data.size = EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE;
+    mu_check(expansion_frame_get_remaining_size(&frame, 0, &remaining_size));
+    mu_assert_int_eq(1, remaining_size);
+    mu_check(expansion_frame_get_remaining_size(&frame, 1, &remaining_size));
+    mu_assert_int_eq(2, remaining_size);
+    mu_check(expansion_frame_get_remaining_size(&frame, 2, &remaining_size));
+    mu_assert_int_eq(1, remaining_size);
+    for(size_t i = 0; i <= EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE; ++i) {
+        mu_check(expansion_frame_get_remaining_size(&frame, i + 3, &remaining_size));
+        mu_assert_int_eq(EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE - i, remaining_size);
+    }
+    mu_check(expansion_frame_get_remaining_size(&frame, 1000, &remaining_size));
+    mu_assert_int_eq(0, remaining_size);
+
+    frame.content.bulk_data.size = EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE + 1;
+    mu_check(!expansion_frame_get_remaining_size(&frame, 3, &remaining_size));
 }
 
 typedef struct {
@@ -170,6 +194,54 @@ MU_TEST(test_expansion_encode_decode_frame) {
     mu_assert_mem_eq(&frame_in, &frame_out, encoded_size);
 }
 
+MU_TEST(test_expansion_encode_decode_bulk_frame) {
+    ExpansionFrame* frame_in = malloc(sizeof(ExpansionFrame));
+    ExpansionFrame* frame_out = malloc(sizeof(ExpansionFrame));
+    const size_t encoded_data_size = sizeof(ExpansionFrame) + sizeof(ExpansionFrameChecksum);
+    uint8_t* encoded_data = malloc(encoded_data_size);
+
+    frame_in->header.type = ExpansionFrameTypeBulkData;
+    frame_in->content.bulk_data.size = EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE;
+    furi_hal_random_fill_buf(frame_in->content.bulk_data.bytes, frame_in->content.bulk_data.size);
+
+    TestExpansionSendStream send_stream = {
+        .data_out = encoded_data,
+        .size_available = encoded_data_size,
+        .size_sent = 0,
+    };
+
+    const size_t encoded_size = expansion_frame_get_encoded_size(frame_in);
+
+    mu_assert_int_eq(
+        expansion_protocol_encode(frame_in, test_expansion_send_callback, &send_stream),
+        ExpansionProtocolStatusOk);
+    mu_assert_int_eq(encoded_size + sizeof(ExpansionFrameChecksum), send_stream.size_sent);
+
+    TestExpansionReceiveStream stream = {
+        .data_in = encoded_data,
+        .size_available = send_stream.size_sent,
+        .size_received = 0,
+    };
+
+    mu_assert_int_eq(
+        expansion_protocol_decode(frame_out, test_expansion_receive_callback, &stream),
+        ExpansionProtocolStatusOk);
+    mu_assert_int_eq(encoded_size + sizeof(ExpansionFrameChecksum), stream.size_received);
+    mu_assert_mem_eq(frame_in, frame_out, encoded_size);
+
+    // Corrupted payload byte must be caught by checksum
+    encoded_data[encoded_size / 2] ^= 0x01;
+    stream.size_available = send_stream.size_sent;
+    stream.size_received = 0;
+    mu_assert_int_eq(
+        expansion_protocol_decode(frame_out, test_expansion_receive_callback, &stream),
+        ExpansionProtocolStatusErrorChecksum);
+
+    free(encoded_data);
+    free(frame_out);
+    free(frame_in);
+}
+
 MU_TEST(test_expansion_garbage_input) {
     uint8_t garbage_data[EXPANSION_TEST_GARBAGE_BUF_SIZE];
     for(uint32_t i = 0; i < EXPANSION_TEST_GARBAGE_ITERATIONS; ++i) {
@@ -191,6 +263,7 @@ MU_TEST_SUITE(test_expansion_suite) {
     MU_RUN_TEST(test_expansion_encoded_size);
     MU_RUN_TEST(test_expansion_remaining_size);
     MU_RUN_TEST(test_expansion_encode_decode_frame);
+    MU_RUN_TEST(test_expansion_encode_decode_bulk_frame);
     MU_RUN_TEST(test_expansion_garbage_input);
 }
 
@@ -0,0 +1,180 @@
+#include <furi.h>
+#include <storage/storage.h>
+#include <gui/modules/file_browser_worker.h>
+
+#include "../test.h" // IWYU pragma: keep
+
+#define TAG "FileBrowserWorkerTest"
+
+#define TEST_DIR        EXT_PATH(".tmp/unit_tests/browser")
+#define TEST_FILE_COUNT 500
+#define TEST_DIR_COUNT  3
+#define TEST_PAGE_LEN   50
+#define TEST_TIMEOUT_MS 60000
+
+typedef struct {
+    FuriSemaphore* done;
+    uint32_t item_cnt;
+    uint32_t load_cnt;
+    uint32_t idx_errors;
+    uint32_t order_errors;
+    uint32_t next_idx;
+    bool last_is_folder;
+    FuriString* last_path;
+} BrowserTestContext;
+
+static void
+    browser_test_folder_cb(void* context, uint32_t item_cnt, int32_t file_idx, bool is_root) {
+    UNUSED(file_idx);
+    UNUSED(is_root);
+    BrowserTestContext* ctx = context;
+    ctx->item_cnt = item_cnt;
+    furi_semaphore_release(ctx->done);
+}
+
+static void browser_test_list_load_cb(void* context, uint32_t list_load_offset) {
+    BrowserTestContext* ctx = context;
+    ctx->load_cnt = 0;
+    ctx->next_idx = list_load_offset;
+    furi_string_reset(ctx->last_path);
+}
+
+static void browser_test_list_item_cb(
+    void* context,
+    FuriString* item_path,
+    uint32_t idx,
+    bool is_folder,
+    bool is_last) {
+    BrowserTestContext* ctx = context;
+
+    if(is_last) {
+        furi_semaphore_release(ctx->done);
+        return;
+    }
+
+    if(idx != ctx->next_idx) ctx->idx_errors++;
+    ctx->next_idx++;
+
+    // Large folders are delivered already sorted: folders first, then by name
+    if(!furi_string_empty(ctx->last_path)) {
+        if(ctx->last_is_folder == is_folder) {
+            if(furi_string_cmpi(ctx->last_path, item_path) > 0) ctx->order_errors++;
+        } else if(is_folder) {
+            ctx->order_errors++;
+        }
+    }
+    furi_string_set(ctx->last_path, item_path);
+    ctx->last_is_folder = is_folder;
+    ctx->load_cnt++;
+}
+
+static void browser_test_prepare(Storage* storage) {
+    storage_simply_remove_recursive(storage, TEST_DIR);
+    mu_assert(storage_simply_mkdir(storage, EXT_PATH(".tmp")), "mkdir failed");
+    mu_assert(storage_simply_mkdir(storage, EXT_PATH(".tmp/unit_tests")), "mkdir failed");
+    mu_assert(storage_simply_mkdir(storage, TEST_DIR), "mkdir failed");
+
+    File* file = storage_file_alloc(storage);
+    FuriString* path = furi_string_alloc();
+
+    for(uint32_t i = 0; i < TEST_FILE_COUNT; i++) {
+        // Mixed case and scrambled order, so directory order is not sorted
+        uint32_t key = (i * 2654435761UL) % 100000;
+        furi_string_printf(
+            path, "%s/%c%05lu_%lu.test", TEST_DIR, (char)(((i % 2) ? 'a' : 'A') + i % 26), key, i);
+        mu_assert(
+            storage_file_open(file, furi_string_get_cstr(path), FSAM_WRITE, FSOM_CREATE_ALWAYS),
+            "file create failed");
+        storage_file_close(file);
+    }
+
+    for(uint32_t i = 0; i < TEST_DIR_COUNT; i++) {
+        furi_string_printf(path, "%s/zdir%lu", TEST_DIR, TEST_DIR_COUNT - i);
+        mu_assert(storage_simply_mkdir(storage, furi_string_get_cstr(path)), "mkdir failed");
+    }
+
+    // Filtered out
+    furi_string_printf(path, "%s/skip.other", TEST_DIR);
+    mu_assert(
+        storage_file_open(file, furi_string_get_cstr(path), FSAM_WRITE, FSOM_CREATE_ALWAYS),
+        "file create failed");
+    storage_file_close(file);
+
+    furi_string_free(path);
+    storage_file_free(file);
+}
+
+static void browser_test_open_and_scroll(BrowserTestContext* ctx, const char* stage) {
+    FuriString* path = furi_string_alloc_set(TEST_DIR);
+
+    uint32_t tick_start = furi_get_tick();
+    BrowserWorker* worker = file_browser_worker_alloc(path, NULL, ".test", false, true);
+    file_browser_worker_set_callback_context(worker, ctx);
+    file_browser_worker_set_folder_callback(worker, browser_test_folder_cb);
+    file_browser_worker_set_list_callback(worker, browser_test_list_load_cb);
+    file_browser_worker_set_item_callback(worker, browser_test_list_item_cb);
+
+    mu_assert(
+        furi_semaphore_acquire(ctx->done, TEST_TIMEOUT_MS) == FuriStatusOk, "folder open timeout");
+    uint32_t open_ms = furi_get_tick() - tick_start;
+    mu_assert_int_eq(TEST_FILE_COUNT + TEST_DIR_COUNT, ctx->item_cnt);
+
+    // Jump to the middle and to the end, as fast scrolling does
+    const uint32_t offsets[] = {ctx->item_cnt / 2, ctx->item_cnt - TEST_PAGE_LEN, 0};
+    uint32_t scroll_ms_max = 0;
+    for(size_t i = 0; i < COUNT_OF(offsets); i++) {
+        tick_start = furi_get_tick();
+        file_browser_worker_load(worker, offsets[i], TEST_PAGE_LEN);
+        mu_assert(
+            furi_semaphore_acquire(ctx->done, TEST_TIMEOUT_MS) == FuriStatusOk, "load timeout");
+        scroll_ms_max = MAX(scroll_ms_max, furi_get_tick() - tick_start);
+        mu_assert_int_eq(TEST_PAGE_LEN, ctx->load_cnt);
+    }
+
+    // Page at offset 0 starts with folders
+    mu_assert(furi_string_end_with_str(ctx->last_path, ".test"), "unexpected last item");
+    mu_assert_int_eq(0, ctx->idx_errors);
+    mu_assert_int_eq(0, ctx->order_errors);
+
+    FURI_LOG_I(
+        TAG,
+        "%s: %lu items, open %lu ms, page load max %lu ms",
+        stage,
+        ctx->item_cnt,
+        open_ms,
+        scroll_ms_max);
+
+    file_browser_worker_free(worker);
+    furi_string_free(path);
+}
+
+MU_TEST(file_browser_worker_large_folder) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    browser_test_prepare(storage);
+
+    BrowserTestContext ctx = {
+        .done = furi_semaphore_alloc(1, 0),
+        .last_path = furi_string_alloc(),
+    };
+
+    // First open sorts the folder, second one uses cached index
+    browser_test_open_and_scroll(&ctx, "cold");
+    browser_test_open_and_scroll(&ctx, "cached");
+
+    furi_string_free(ctx.last_path);
+    furi_semaphore_free(ctx.done);
+
+    storage_simply_remove_recursive(storage, TEST_DIR);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST_SUITE(file_browser_worker) {
+    MU_RUN_TEST(file_browser_worker_large_folder);
+}
+
+int run_minunit_test_file_browser_worker(void) {
+    MU_RUN_SUITE(file_browser_worker);
+    return MU_EXIT_CODE;
+}
+
+TEST_API_DEFINE(run_minunit_test_file_browser_worker)
@@ -327,9 +327,66 @@ MU_TEST(flipper_format_file_test) {
     furi_record_close(RECORD_STORAGE);
 }
 
+#define FF_BENCH_BLOCKS 64
+
+MU_TEST(flipper_format_parse_bench) {
+    FlipperFormat* flipper_format = flipper_format_string_alloc();
+    FuriString* key = furi_string_alloc();
+    uint8_t block[16];
+
+    // MIFARE Classic 1K like dump
+    mu_check(flipper_format_write_header_cstr(flipper_format, test_filetype, test_version));
+    for(uint32_t i = 0; i < FF_BENCH_BLOCKS; i++) {
+        memset(block, i, sizeof(block));
+        furi_string_printf(key, "Block %lu", i);
+        mu_check(flipper_format_write_hex(
+            flipper_format, furi_string_get_cstr(key), block, sizeof(block)));
+    }
+
+    // Keys are looked up in order, as protocol parsers do
+    const size_t heap_free = memmgr_get_free_heap();
+    TestBench hex_bench = {0};
+    test_bench_start(&hex_bench);
+    mu_check(flipper_format_rewind(flipper_format));
+    for(uint32_t i = 0; i < FF_BENCH_BLOCKS; i++) {
+        furi_string_printf(key, "Block %lu", i);
+        mu_check(flipper_format_read_hex(
+            flipper_format, furi_string_get_cstr(key), block, sizeof(block)));
+        mu_assert_int_eq(i, block[15]);
+    }
+    test_bench_stop(&hex_bench);
+    mu_assert_int_eq(heap_free, memmgr_get_free_heap());
+
+    // Same values as strings, kept in arena until parsing is done
+    FuriStringArena* arena = furi_string_arena_alloc(1024);
+    TestBench string_bench = {0};
+    test_bench_start(&string_bench);
+    mu_check(flipper_format_rewind(flipper_format));
+    for(uint32_t i = 0; i < FF_BENCH_BLOCKS; i++) {
+        FuriString* value = furi_string_alloc_arena(arena);
+        furi_string_printf(key, "Block %lu", i);
+        mu_check(flipper_format_read_string(flipper_format, furi_string_get_cstr(key), value));
+        mu_assert_int_eq(47, furi_string_size(value));
+    }
+    furi_string_arena_reset(arena);
+    test_bench_stop(&string_bench);
+    furi_string_arena_free(arena);
+
+    FURI_LOG_I(
+        "FlipperFormatTest",
+        "%d blocks: read_hex %lu us, read_string to arena %lu us",
+        FF_BENCH_BLOCKS,
+        test_bench_get_ns(&hex_bench, 1) / 1000,
+        test_bench_get_ns(&string_bench, 1) / 1000);
+
+    furi_string_free(key);
+    flipper_format_free(flipper_format);
+}
+
 MU_TEST_SUITE(flipper_format_string_suite) {
     MU_RUN_TEST(flipper_format_string_test);
     MU_RUN_TEST(flipper_format_file_test);
+    MU_RUN_TEST(flipper_format_parse_bench);
 }
 
 int run_minunit_test_flipper_format_string(void) {
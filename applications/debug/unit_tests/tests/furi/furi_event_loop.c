@@ -203,3 +203,88 @@ void test_furi_event_loop(void) {
     furi_thread_free(producer_thread);
     furi_message_queue_free(data.mq);
 }
+
+#define EVENT_LOOP_TIMER_COUNT        (1000u)
+#define EVENT_LOOP_TIMER_INTERVAL_MAX (2000u)
+
+typedef struct TestFuriTimerData TestFuriTimerData;
+
+typedef struct {
+    TestFuriTimerData* data;
+    FuriEventLoopTimer* timer;
+    uint32_t expected;
+} TestFuriTimerItem;
+
+struct TestFuriTimerData {
+    FuriEventLoop* event_loop;
+    TestFuriTimerItem items[EVENT_LOOP_TIMER_COUNT];
+    TestBench arm_bench;
+    uint32_t fired;
+    uint32_t jitter_total;
+    uint32_t jitter_max;
+};
+
+static void test_furi_event_loop_timer_callback(void* context) {
+    TestFuriTimerItem* item = context;
+    TestFuriTimerData* data = item->data;
+
+    const uint32_t jitter = furi_get_tick() - item->expected;
+    data->jitter_total += jitter;
+    data->jitter_max = MAX(data->jitter_max, jitter);
+
+    if(++data->fired == EVENT_LOOP_TIMER_COUNT) {
+        furi_event_loop_stop(data->event_loop);
+    }
+}
+
+static void test_furi_event_loop_timer_arm(void* context) {
+    TestFuriTimerData* data = context;
+
+    test_bench_start(&data->arm_bench);
+    const uint32_t tick = furi_get_tick();
+
+    for(uint32_t i = 0; i < EVENT_LOOP_TIMER_COUNT; i++) {
+        // Spread intervals over several wheel levels
+        const uint32_t interval = 1 + (i * 7919u) % EVENT_LOOP_TIMER_INTERVAL_MAX;
+        data->items[i].expected = tick + interval;
+        furi_event_loop_timer_start(data->items[i].timer, interval);
+    }
+
+    test_bench_stop(&data->arm_bench);
+}
+
+void test_furi_event_loop_timer_wheel(void) {
+    TestFuriTimerData* data = malloc(sizeof(TestFuriTimerData));
+    data->event_loop = furi_event_loop_alloc();
+
+    for(uint32_t i = 0; i < EVENT_LOOP_TIMER_COUNT; i++) {
+        data->items[i].data = data;
+        data->items[i].timer = furi_event_loop_timer_alloc(
+            data->event_loop,
+            test_furi_event_loop_timer_callback,
+            FuriEventLoopTimerTypeOnce,
+            &data->items[i]);
+    }
+
+    furi_event_loop_pend_callback(data->event_loop, test_furi_event_loop_timer_arm, data);
+    furi_event_loop_run(data->event_loop);
+
+    FURI_LOG_I(
+        TAG,
+        "%lu timers: arm %lu ns each, jitter avg %lu/1000 max %lu ticks",
+        data->fired,
+        test_bench_get_ns(&data->arm_bench, EVENT_LOOP_TIMER_COUNT),
+        data->jitter_total * 1000 / EVENT_LOOP_TIMER_COUNT,
+        data->jitter_max);
+
+    mu_assert_int_eq(EVENT_LOOP_TIMER_COUNT, data->fired);
+    // Nothing else runs in this loop, timers must fire on time
+    mu_assert(data->jitter_max <= 5, "timer dispatch jitter is too high");
+
+    for(uint32_t i = 0; i < EVENT_LOOP_TIMER_COUNT; i++) {
+        furi_event_loop_timer_free(data->items[i].timer);
+    }
+
+    furi_event_loop_free(data->event_loop);
+    free(data);
+}
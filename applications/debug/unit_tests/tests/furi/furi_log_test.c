@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <string.h>
+#include <furi.h>
+#include "../test.h" // IWYU pragma: keep
+
+#define TAG "LogTest"
+
+#define LOG_BENCH_CALLS   64
+#define LOG_BENCH_TIMEOUT 1000
+
+// Longer than deferred string limit of 48 characters
+#define LOG_TEST_THREAD_NAME "LogTestThreadWithNameLongerThanDeferredStringLimit"
+#define LOG_TEST_ENABLED_LINE \
+    "Deferred logging enabled by LogTestThreadWithNameLongerThanDeferredStrin..."
+
+typedef struct {
+    size_t bytes;
+    bool marker_found;
+    bool enabled_found;
+} LogTestContext;
+
+static void test_log_handler(const uint8_t* data, size_t size, void* context) {
+    LogTestContext* ctx = context;
+    ctx->bytes += size;
+
+    char line[192];
+    size = MIN(size, sizeof(line) - 1);
+    memcpy(line, data, size);
+    line[size] = '\0';
+    if(strstr(line, "marker 42 0x1f str -1.50")) {
+        ctx->marker_found = true;
+    }
+    if(strstr(line, LOG_TEST_ENABLED_LINE)) {
+        ctx->enabled_found = true;
+    }
+}
+
+static int32_t test_log_enable_thread(void* context) {
+    UNUSED(context);
+    furi_log_set_deferred(true);
+    return 0;
+}
+
+static bool test_log_wait(const bool* found) {
+    uint32_t tick_start = furi_get_tick();
+    while(!*found && furi_get_tick() - tick_start < LOG_BENCH_TIMEOUT) {
+        furi_delay_ms(1);
+    }
+    return *found;
+}
+
+static uint32_t test_log_bench(bool deferred) {
+    furi_log_set_deferred(deferred);
+
+    TestBench bench = {0};
+    test_bench_start(&bench);
+    for(uint32_t i = 0; i < LOG_BENCH_CALLS; i++) {
+        FURI_LOG_I(TAG, "bench %lu %s %d", i, "arg", -1);
+    }
+    test_bench_stop(&bench);
+
+    // Let log thread drain the ring
+    furi_delay_ms(100);
+    return test_bench_get_ns(&bench, LOG_BENCH_CALLS);
+}
+
+void test_furi_log_deferred(void) {
+    const bool deferred = furi_log_is_deferred();
+    const FuriLogLevel level = furi_log_get_level();
+    furi_log_set_level(FuriLogLevelInfo);
+
+    LogTestContext context = {0};
+    FuriLogHandler handler = {.callback = test_log_handler, .context = &context};
+    mu_assert(furi_log_add_handler(handler), "handler add failed");
+
+    // Firmware logs with format in flash and thread name in RAM: binary record, cut name
+    furi_log_set_deferred(false);
+    FuriLogDeferredStats stats_before, stats_after;
+    furi_log_get_deferred_stats(&stats_before);
+    FuriThread* thread =
+        furi_thread_alloc_ex(LOG_TEST_THREAD_NAME, 1024, test_log_enable_thread, NULL);
+    furi_thread_start(thread);
+    furi_thread_join(thread);
+    furi_thread_free(thread);
+    mu_assert(test_log_wait(&context.enabled_found), "binary record not delivered");
+    furi_log_get_deferred_stats(&stats_after);
+    mu_assert(stats_after.binary > stats_before.binary, "binary record not captured");
+
+    // Test plugin is loaded to RAM: its formats are formatted at log site
+    stats_before = stats_after;
+    FURI_LOG_I(TAG, "marker %d 0x%lx %s %.2f", 42, 0x1FUL, "str", -1.5);
+    mu_assert(test_log_wait(&context.marker_found), "text record not delivered");
+    furi_log_get_deferred_stats(&stats_after);
+    mu_assert(stats_after.text > stats_before.text, "text record not captured");
+
+    const uint32_t dropped = furi_log_get_dropped();
+    const uint32_t ns_sync = test_log_bench(false);
+    const size_t bytes_sync = context.bytes;
+    const uint32_t ns_deferred = test_log_bench(true);
+    const size_t bytes_deferred = context.bytes - bytes_sync;
+
+    // Same output, timestamp may grow by a digit
+    if(furi_log_get_dropped() == dropped) {
+        mu_assert(bytes_deferred >= bytes_sync, "deferred output is lost");
+        mu_assert(bytes_deferred <= bytes_sync + LOG_BENCH_CALLS, "deferred output mismatch");
+    }
+    mu_assert(ns_deferred < ns_sync, "deferred logging is slower");
+
+    furi_log_set_deferred(deferred);
+    furi_log_remove_handler(handler);
+    furi_log_set_level(level);
+
+    FURI_LOG_I(
+        TAG,
+        "per call: sync %lu ns, deferred %lu ns, dropped %lu",
+        ns_sync,
+        ns_deferred,
+        furi_log_get_dropped() - dropped);
+}
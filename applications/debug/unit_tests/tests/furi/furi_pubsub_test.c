@@ -43,3 +43,364 @@ void test_furi_pubsub(void) {
     // delete pubsub case
     furi_pubsub_free(test_pubsub);
 }
+
+#define PUBSUB_NESTED_DEPTH 3
+
+typedef struct {
+    FuriPubSub* pubsub;
+    FuriPubSubSubscription* nested;
+    uint32_t calls;
+    uint32_t nested_calls;
+} PubSubReentryContext;
+
+static void test_pubsub_nested_handler(const void* arg, void* ctx) {
+    UNUSED(arg);
+    PubSubReentryContext* context = ctx;
+    context->nested_calls++;
+}
+
+static void test_pubsub_reentry_handler(const void* arg, void* ctx) {
+    PubSubReentryContext* context = ctx;
+    uint32_t depth = *(const uint32_t*)arg;
+    context->calls++;
+
+    // Publish and subscribe from callback, both used to deadlock on pubsub mutex
+    if(depth == 0 && !context->nested) {
+        context->nested =
+            furi_pubsub_subscribe(context->pubsub, test_pubsub_nested_handler, context);
+    }
+    if(depth < PUBSUB_NESTED_DEPTH) {
+        depth++;
+        furi_pubsub_publish(context->pubsub, &depth);
+    }
+}
+
+void test_furi_pubsub_reentry(void) {
+    PubSubReentryContext context = {.pubsub = furi_pubsub_alloc()};
+    FuriPubSubSubscription* subscription =
+        furi_pubsub_subscribe(context.pubsub, test_pubsub_reentry_handler, &context);
+
+    uint32_t depth = 0;
+    furi_pubsub_publish(context.pubsub, &depth);
+    mu_assert_int_eq(PUBSUB_NESTED_DEPTH + 1, context.calls);
+    // Nested subscription sees publishes made after it was added
+    mu_assert_int_eq(PUBSUB_NESTED_DEPTH, context.nested_calls);
+
+    furi_pubsub_unsubscribe(context.pubsub, context.nested);
+    furi_pubsub_unsubscribe(context.pubsub, subscription);
+    furi_pubsub_free(context.pubsub);
+}
+
+typedef struct {
+    FuriPubSub* pubsub;
+    FuriPubSubSubscription* removed;
+    FuriPubSubSubscription* added;
+    FuriSemaphore* in_callback;
+    FuriSemaphore* done;
+} PubSubUnsubscribeContext;
+
+static void test_pubsub_unsubscribe_dummy_handler(const void* arg, void* ctx) {
+    UNUSED(arg);
+    UNUSED(ctx);
+}
+
+static void test_pubsub_unsubscribe_handler(const void* arg, void* ctx) {
+    UNUSED(arg);
+    PubSubUnsubscribeContext* context = ctx;
+    if(context->added) return;
+
+    // Let other thread start unsubscribe, it waits for this publish to finish
+    furi_semaphore_release(context->in_callback);
+    furi_delay_ms(10);
+    context->added =
+        furi_pubsub_subscribe(context->pubsub, test_pubsub_unsubscribe_dummy_handler, NULL);
+}
+
+static int32_t test_pubsub_unsubscribe_publisher(void* ctx) {
+    PubSubUnsubscribeContext* context = ctx;
+    uint32_t value = 0;
+    furi_pubsub_publish(context->pubsub, &value);
+    furi_semaphore_release(context->done);
+    return 0;
+}
+
+static int32_t test_pubsub_unsubscribe_remover(void* ctx) {
+    PubSubUnsubscribeContext* context = ctx;
+    furi_check(furi_semaphore_acquire(context->in_callback, FuriWaitForever) == FuriStatusOk);
+    furi_pubsub_unsubscribe(context->pubsub, context->removed);
+    furi_semaphore_release(context->done);
+    return 0;
+}
+
+void test_furi_pubsub_unsubscribe_concurrent(void) {
+    PubSubUnsubscribeContext context = {
+        .pubsub = furi_pubsub_alloc(),
+        .in_callback = furi_semaphore_alloc(1, 0),
+        .done = furi_semaphore_alloc(2, 0),
+    };
+    FuriPubSubSubscription* subscription =
+        furi_pubsub_subscribe(context.pubsub, test_pubsub_unsubscribe_handler, &context);
+    context.removed =
+        furi_pubsub_subscribe(context.pubsub, test_pubsub_unsubscribe_dummy_handler, NULL);
+
+    FuriThread* publisher = furi_thread_alloc_ex(
+        "PubSubPublisher", 1024, test_pubsub_unsubscribe_publisher, &context);
+    FuriThread* remover =
+        furi_thread_alloc_ex("PubSubRemover", 1024, test_pubsub_unsubscribe_remover, &context);
+    furi_thread_start(remover);
+    furi_thread_start(publisher);
+
+    // Subscribe from callback while other thread unsubscribes used to deadlock
+    for(size_t i = 0; i < 2; i++) {
+        mu_assert(
+            furi_semaphore_acquire(context.done, 1000) == FuriStatusOk,
+            "Subscribe from callback deadlocked with unsubscribe");
+    }
+
+    furi_thread_join(publisher);
+    furi_thread_free(publisher);
+    furi_thread_join(remover);
+    furi_thread_free(remover);
+
+    mu_assert_pointers_not_eq(context.added, NULL);
+
+    furi_pubsub_unsubscribe(context.pubsub, context.added);
+    furi_pubsub_unsubscribe(context.pubsub, subscription);
+    furi_pubsub_free(context.pubsub);
+    furi_semaphore_free(context.done);
+    furi_semaphore_free(context.in_callback);
+}
+
+typedef struct {
+    FuriPubSub* pubsub;
+    FuriSemaphore* in_callback;
+    FuriSemaphore* resume;
+    FuriSemaphore* done;
+    uint32_t removed_calls;
+    bool unsubscribed;
+    bool late_calls;
+} PubSubPinnedContext;
+
+static void test_pubsub_pinned_blocking_handler(const void* arg, void* ctx) {
+    UNUSED(arg);
+    PubSubPinnedContext* context = ctx;
+    furi_semaphore_release(context->in_callback);
+    furi_check(furi_semaphore_acquire(context->resume, FuriWaitForever) == FuriStatusOk);
+}
+
+static void test_pubsub_pinned_removed_handler(const void* arg, void* ctx) {
+    UNUSED(arg);
+    PubSubPinnedContext* context = ctx;
+    // Subscription context must stay valid until unsubscribe returns
+    if(context->unsubscribed) context->late_calls = true;
+    context->removed_calls++;
+}
+
+static int32_t test_pubsub_pinned_publisher(void* ctx) {
+    PubSubPinnedContext* context = ctx;
+    uint32_t value = 0;
+    furi_pubsub_publish(context->pubsub, &value);
+    return 0;
+}
+
+typedef struct {
+    PubSubPinnedContext* context;
+    FuriPubSubSubscription* subscription;
+} PubSubPinnedRemover;
+
+static int32_t test_pubsub_pinned_remover(void* ctx) {
+    PubSubPinnedRemover* remover = ctx;
+    furi_pubsub_unsubscribe(remover->context->pubsub, remover->subscription);
+    remover->context->unsubscribed = true;
+    furi_semaphore_release(remover->context->done);
+    return 0;
+}
+
+void test_furi_pubsub_unsubscribe_pinned(void) {
+    PubSubPinnedContext context = {
+        .pubsub = furi_pubsub_alloc(),
+        .in_callback = furi_semaphore_alloc(1, 0),
+        .resume = furi_semaphore_alloc(1, 0),
+        .done = furi_semaphore_alloc(1, 0),
+    };
+    FuriPubSubSubscription* blocking =
+        furi_pubsub_subscribe(context.pubsub, test_pubsub_pinned_blocking_handler, &context);
+    PubSubPinnedRemover remover = {
+        .context = &context,
+        .subscription =
+            furi_pubsub_subscribe(context.pubsub, test_pubsub_pinned_removed_handler, &context),
+    };
+
+    // Publisher stays in the first callback with the list of both subscriptions pinned
+    FuriThread* publisher = furi_thread_alloc_ex(
+        "PubSubPublisher", 1024, test_pubsub_pinned_publisher, &context);
+    furi_thread_start(publisher);
+    mu_assert(
+        furi_semaphore_acquire(context.in_callback, 1000) == FuriStatusOk,
+        "Publisher not in callback");
+
+    // Subscribe swaps the pinned list out, unsubscribe then swaps out a list nobody pinned
+    FuriPubSubSubscription* added =
+        furi_pubsub_subscribe(context.pubsub, test_pubsub_unsubscribe_dummy_handler, NULL);
+    FuriThread* remover_thread =
+        furi_thread_alloc_ex("PubSubRemover", 1024, test_pubsub_pinned_remover, &remover);
+    furi_thread_start(remover_thread);
+    const bool returned_early = furi_semaphore_acquire(context.done, 50) == FuriStatusOk;
+
+    // Let the publisher go on to the removed subscription before checking anything
+    furi_semaphore_release(context.resume);
+    mu_assert(!returned_early, "Unsubscribe returned while publisher pinned older list");
+    mu_assert(
+        furi_semaphore_acquire(context.done, 1000) == FuriStatusOk,
+        "Unsubscribe did not return after publisher finished");
+
+    furi_thread_join(publisher);
+    furi_thread_free(publisher);
+    furi_thread_join(remover_thread);
+    furi_thread_free(remover_thread);
+
+    mu_assert_int_eq(1, context.removed_calls);
+    mu_assert(!context.late_calls, "Callback called after unsubscribe returned");
+
+    furi_pubsub_unsubscribe(context.pubsub, added);
+    furi_pubsub_unsubscribe(context.pubsub, blocking);
+    furi_pubsub_free(context.pubsub);
+    furi_semaphore_free(context.done);
+    furi_semaphore_free(context.resume);
+    furi_semaphore_free(context.in_callback);
+}
+
+#define PUBSUB_DEFERRED_COUNT      64
+#define PUBSUB_DEFERRED_QUEUE_SIZE 16
+
+typedef struct {
+    FuriPubSub* pubsub;
+    FuriEventLoop* event_loop;
+    uint32_t received;
+    uint32_t order_errors;
+} PubSubDeferredContext;
+
+static void test_pubsub_deferred_handler(const void* arg, void* ctx) {
+    PubSubDeferredContext* context = ctx;
+    if(*(const uint32_t*)arg != context->received) context->order_errors++;
+    context->received++;
+    if(context->received == PUBSUB_DEFERRED_QUEUE_SIZE) {
+        furi_event_loop_stop(context->event_loop);
+    }
+}
+
+void test_furi_pubsub_deferred(void) {
+    PubSubDeferredContext context = {
+        .pubsub = furi_pubsub_alloc(),
+        .event_loop = furi_event_loop_alloc(),
+    };
+
+    FuriPubSubSubscription* subscription = furi_pubsub_subscribe_deferred(
+        context.pubsub,
+        context.event_loop,
+        sizeof(uint32_t),
+        PUBSUB_DEFERRED_QUEUE_SIZE,
+        test_pubsub_deferred_handler,
+        &context);
+
+    // Nothing is delivered until event loop runs, overflow is dropped
+    for(uint32_t i = 0; i < PUBSUB_DEFERRED_COUNT; i++) {
+        furi_pubsub_publish(context.pubsub, &i);
+    }
+    mu_assert_int_eq(0, context.received);
+
+    furi_event_loop_run(context.event_loop);
+    mu_assert_int_eq(PUBSUB_DEFERRED_QUEUE_SIZE, context.received);
+    mu_assert_int_eq(0, context.order_errors);
+
+    FuriPubSubStats stats;
+    furi_pubsub_get_stats(context.pubsub, &stats);
+    mu_assert_int_eq(PUBSUB_DEFERRED_COUNT, stats.published);
+    mu_assert_int_eq(PUBSUB_DEFERRED_COUNT - PUBSUB_DEFERRED_QUEUE_SIZE, stats.dropped);
+    mu_assert_int_eq(PUBSUB_DEFERRED_QUEUE_SIZE, stats.queue_depth_max);
+
+    furi_pubsub_reset_stats(context.pubsub);
+    furi_pubsub_get_stats(context.pubsub, &stats);
+    mu_assert_int_eq(0, stats.published);
+
+    furi_pubsub_unsubscribe(context.pubsub, subscription);
+    furi_event_loop_free(context.event_loop);
+    furi_pubsub_free(context.pubsub);
+}
+
+#define PUBSUB_BENCH_PUBLISHERS 3
+#define PUBSUB_BENCH_MESSAGES   2000
+#define PUBSUB_BENCH_CHURN      200
+
+typedef struct {
+    FuriPubSub* pubsub;
+    volatile uint32_t received;
+    volatile uint32_t churn_received;
+} PubSubBenchContext;
+
+static void test_pubsub_bench_handler(const void* arg, void* ctx) {
+    UNUSED(arg);
+    PubSubBenchContext* context = ctx;
+    FURI_CRITICAL_ENTER();
+    context->received++;
+    FURI_CRITICAL_EXIT();
+}
+
+static void test_pubsub_bench_churn_handler(const void* arg, void* ctx) {
+    UNUSED(arg);
+    PubSubBenchContext* context = ctx;
+    FURI_CRITICAL_ENTER();
+    context->churn_received++;
+    FURI_CRITICAL_EXIT();
+}
+
+static int32_t test_pubsub_bench_publisher(void* ctx) {
+    PubSubBenchContext* context = ctx;
+    for(uint32_t i = 0; i < PUBSUB_BENCH_MESSAGES; i++) {
+        furi_pubsub_publish(context->pubsub, &i);
+        if(i % 64 == 0) furi_thread_yield();
+    }
+    return 0;
+}
+
+void test_furi_pubsub_contention(void) {
+    PubSubBenchContext context = {.pubsub = furi_pubsub_alloc()};
+    FuriPubSubSubscription* subscription =
+        furi_pubsub_subscribe(context.pubsub, test_pubsub_bench_handler, &context);
+
+    FuriThread* publishers[PUBSUB_BENCH_PUBLISHERS];
+    for(size_t i = 0; i < PUBSUB_BENCH_PUBLISHERS; i++) {
+        publishers[i] =
+            furi_thread_alloc_ex("PubSubBench", 1024, test_pubsub_bench_publisher, &context);
+        furi_thread_start(publishers[i]);
+    }
+
+    // Subscription list changes while publishers are running
+    for(size_t i = 0; i < PUBSUB_BENCH_CHURN; i++) {
+        FuriPubSubSubscription* churn =
+            furi_pubsub_subscribe(context.pubsub, test_pubsub_bench_churn_handler, &context);
+        furi_thread_yield();
+        furi_pubsub_unsubscribe(context.pubsub, churn);
+    }
+
+    for(size_t i = 0; i < PUBSUB_BENCH_PUBLISHERS; i++) {
+        furi_thread_join(publishers[i]);
+        furi_thread_free(publishers[i]);
+    }
+
+    mu_assert_int_eq(PUBSUB_BENCH_PUBLISHERS * PUBSUB_BENCH_MESSAGES, context.received);
+
+    FuriPubSubStats stats;
+    furi_pubsub_get_stats(context.pubsub, &stats);
+    mu_assert_int_eq(PUBSUB_BENCH_PUBLISHERS * PUBSUB_BENCH_MESSAGES, stats.published);
+    FURI_LOG_I(
+        "PubSubTest",
+        "%lu publishes, latency avg %lu us, max %lu us, churn deliveries %lu",
+        stats.published,
+        stats.latency_avg_us,
+        stats.latency_max_us,
+        context.churn_received);
+
+    furi_pubsub_unsubscribe(context.pubsub, subscription);
+    furi_pubsub_free(context.pubsub);
+}
@@ -6,8 +6,15 @@
 void test_furi_create_open(void);
 void test_furi_concurrent_access(void);
 void test_furi_pubsub(void);
+void test_furi_pubsub_reentry(void);
+void test_furi_pubsub_unsubscribe_concurrent(void);
+void test_furi_pubsub_unsubscribe_pinned(void);
+void test_furi_pubsub_deferred(void);
+void test_furi_pubsub_contention(void);
+void test_furi_log_deferred(void);
 void test_furi_memmgr(void);
 void test_furi_event_loop(void);
+void test_furi_event_loop_timer_wheel(void);
 void test_errno_saving(void);
 
 static int foo = 0;
@@ -33,6 +40,30 @@ MU_TEST(mu_test_furi_pubsub) {
     test_furi_pubsub();
 }
 
+MU_TEST(mu_test_furi_pubsub_reentry) {
+    test_furi_pubsub_reentry();
+}
+
+MU_TEST(mu_test_furi_pubsub_unsubscribe_concurrent) {
+    test_furi_pubsub_unsubscribe_concurrent();
+}
+
+MU_TEST(mu_test_furi_pubsub_unsubscribe_pinned) {
+    test_furi_pubsub_unsubscribe_pinned();
+}
+
+MU_TEST(mu_test_furi_pubsub_deferred) {
+    test_furi_pubsub_deferred();
+}
+
+MU_TEST(mu_test_furi_pubsub_contention) {
+    test_furi_pubsub_contention();
+}
+
+MU_TEST(mu_test_furi_log_deferred) {
+    test_furi_log_deferred();
+}
+
 MU_TEST(mu_test_furi_memmgr) {
     // this test is not accurate, but gives a basic understanding
     // that memory management is working fine
@@ -43,6 +74,10 @@ MU_TEST(mu_test_furi_event_loop) {
     test_furi_event_loop();
 }
 
+MU_TEST(mu_test_furi_event_loop_timer_wheel) {
+    test_furi_event_loop_timer_wheel();
+}
+
 MU_TEST(mu_test_errno_saving) {
     test_errno_saving();
 }
@@ -54,8 +89,15 @@ MU_TEST_SUITE(test_suite) {
     // v2 tests
     MU_RUN_TEST(mu_test_furi_create_open);
     MU_RUN_TEST(mu_test_furi_pubsub);
+    MU_RUN_TEST(mu_test_furi_pubsub_reentry);
+    MU_RUN_TEST(mu_test_furi_pubsub_unsubscribe_concurrent);
+    MU_RUN_TEST(mu_test_furi_pubsub_unsubscribe_pinned);
+    MU_RUN_TEST(mu_test_furi_pubsub_deferred);
+    MU_RUN_TEST(mu_test_furi_pubsub_contention);
+    MU_RUN_TEST(mu_test_furi_log_deferred);
     MU_RUN_TEST(mu_test_furi_memmgr);
     MU_RUN_TEST(mu_test_furi_event_loop);
+    MU_RUN_TEST(mu_test_furi_event_loop_timer_wheel);
     MU_RUN_TEST(mu_test_errno_saving);
 }
 
@@ -445,6 +445,93 @@ MU_TEST(mu_test_furi_string_utf8) {
     furi_string_free(utf8_string);
 }
 
+MU_TEST(mu_test_furi_string_arena) {
+    FuriStringArena* arena = furi_string_arena_alloc(128);
+
+    // short, long and growing strings
+    FuriString* key = furi_string_alloc_arena(arena);
+    furi_string_set(key, "Key");
+    FuriString* value = furi_string_alloc_arena(arena);
+    furi_string_printf(value, "%s %s %s %s %s", "00", "11", "22", "33", "44 55 66 77 88 99");
+    for(uint32_t i = 0; i < 100; i++) {
+        furi_string_cat_printf(key, "%02lX", i);
+    }
+    mu_assert_int_eq(203, furi_string_size(key));
+    mu_assert_string_eq("00 11 22 33 44 55 66 77 88 99", furi_string_get_cstr(value));
+
+    // content moves between arena and heap strings
+    FuriString* heap = furi_string_alloc_set(value);
+    furi_string_swap(heap, key);
+    mu_assert_int_eq(203, furi_string_size(heap));
+    mu_assert_string_eq("00 11 22 33 44 55 66 77 88 99", furi_string_get_cstr(key));
+    furi_string_free(heap);
+
+    heap = furi_string_alloc_move(value);
+    mu_assert_string_eq("00 11 22 33 44 55 66 77 88 99", furi_string_get_cstr(heap));
+    furi_string_free(heap);
+
+    // reset releases everything at once
+    furi_string_arena_reset(arena);
+    key = furi_string_alloc_arena(arena);
+    mu_check(furi_string_empty(key));
+    furi_string_free(key);
+
+    furi_string_arena_free(arena);
+}
+
+#define STRING_BENCH_COUNT 256
+
+static size_t furi_string_bench_fill(FuriString** strings, FuriStringArena* arena) {
+    for(uint32_t i = 0; i < STRING_BENCH_COUNT; i++) {
+        strings[i] = arena ? furi_string_alloc_arena(arena) : furi_string_alloc();
+        // Typical FlipperFormat key and value sizes
+        if(i % 2) {
+            furi_string_printf(strings[i], "Block %lu", i);
+        } else {
+            furi_string_printf(strings[i], "%02lX %02lX %02lX %02lX", i, i, i, i);
+        }
+    }
+    return memmgr_get_free_heap();
+}
+
+MU_TEST(mu_test_furi_string_bench) {
+    FuriString** strings = malloc(sizeof(FuriString*) * STRING_BENCH_COUNT);
+
+    // heap strings
+    TestBench heap_bench = {0};
+    size_t heap_free = memmgr_get_free_heap();
+    test_bench_start(&heap_bench);
+    const uint32_t heap_used = heap_free - furi_string_bench_fill(strings, NULL);
+    for(size_t i = 0; i < STRING_BENCH_COUNT; i++) {
+        furi_string_free(strings[i]);
+    }
+    test_bench_stop(&heap_bench);
+    mu_assert_int_eq(heap_free, memmgr_get_free_heap());
+
+    // arena strings
+    TestBench arena_bench = {0};
+    FuriStringArena* arena = furi_string_arena_alloc(2048);
+    heap_free = memmgr_get_free_heap();
+    test_bench_start(&arena_bench);
+    const uint32_t arena_used = heap_free - furi_string_bench_fill(strings, arena);
+    furi_string_arena_reset(arena);
+    test_bench_stop(&arena_bench);
+    furi_string_arena_free(arena);
+
+    free(strings);
+
+    FURI_LOG_I(
+        "FuriStringTest",
+        "%d short strings: heap %lu bytes %lu ns each, arena %lu bytes %lu ns each",
+        STRING_BENCH_COUNT,
+        heap_used,
+        test_bench_get_ns(&heap_bench, STRING_BENCH_COUNT),
+        arena_used,
+        test_bench_get_ns(&arena_bench, STRING_BENCH_COUNT));
+    // Short strings are inline: single allocation each, no separate buffer
+    mu_check(heap_used <= STRING_BENCH_COUNT * 48);
+}
+
 MU_TEST_SUITE(test_suite) {
     MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
 
@@ -460,6 +547,8 @@ MU_TEST_SUITE(test_suite) {
     MU_RUN_TEST(mu_test_furi_string_start_end);
     MU_RUN_TEST(mu_test_furi_string_trim);
     MU_RUN_TEST(mu_test_furi_string_utf8);
+    MU_RUN_TEST(mu_test_furi_string_arena);
+    MU_RUN_TEST(mu_test_furi_string_bench);
 }
 
 int run_minunit_test_furi_string(void) {
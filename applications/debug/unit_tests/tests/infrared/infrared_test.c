@@ -1,6 +1,7 @@
 #include <furi.h>
 #include <flipper_format.h>
 #include <infrared.h>
+#include <infrared_worker.h>
 #include <common/infrared_common_i.h>
 #include "../test.h" // IWYU pragma: keep
 
@@ -8,6 +9,13 @@
 #define IR_TEST_FILE_PREFIX "test_"
 #define IR_TEST_FILE_SUFFIX ".irtest"
 
+#define TAG "InfraredTest"
+
+#define IR_TEST_REPLAY_ROUNDS 50
+
+#define IR_TEST_OVERRUN_MESSAGES 64
+#define IR_TEST_OVERRUN_TAIL     4
+
 typedef struct {
     InfraredDecoderHandler* decoder_handler;
     InfraredEncoderHandler* encoder_handler;
@@ -400,6 +408,163 @@ static void infrared_test_run_decoder(InfraredProtocol protocol, uint32_t test_i
     mu_assert(message_counter == messages_count, "decoded less than expected");
 }
 
+static void infrared_test_replay_check(
+    const InfraredMessage* message_decoded,
+    const InfraredMessage* messages,
+    uint32_t messages_count,
+    uint32_t* message_counter) {
+    if(!message_decoded) return;
+    mu_assert(*message_counter < messages_count, "decoded more than expected during replay");
+    infrared_test_compare_message_results(message_decoded, &messages[*message_counter]);
+    ++*message_counter;
+}
+
+/* Replays a capture several times and logs decoder throughput,
+ * each round must decode exactly the expected messages */
+static void infrared_test_run_decoder_replay(InfraredProtocol protocol, uint32_t test_index) {
+    uint32_t* timings;
+    uint32_t timings_count;
+    InfraredMessage* messages;
+    uint32_t messages_count;
+
+    FuriString* buf;
+    buf = furi_string_alloc();
+
+    mu_assert(
+        infrared_test_prepare_file(infrared_get_protocol_name(protocol)),
+        "Failed to prepare test file");
+
+    furi_string_printf(buf, "decoder_input%ld", test_index);
+    mu_assert(
+        infrared_test_load_raw_signal(
+            test->ff, furi_string_get_cstr(buf), &timings, &timings_count),
+        "Failed to load raw signal from file");
+
+    furi_string_printf(buf, "decoder_expected%ld", test_index);
+    mu_assert(
+        infrared_test_load_messages(
+            test->ff, furi_string_get_cstr(buf), &messages, &messages_count),
+        "Failed to load messages from file");
+
+    flipper_format_buffered_file_close(test->ff);
+    furi_string_free(buf);
+
+    TestBench bench = {0};
+
+    for(uint32_t round = 0; round < IR_TEST_REPLAY_ROUNDS; ++round) {
+        bool level = 0;
+        uint32_t message_counter = 0;
+        infrared_reset_decoder(test->decoder_handler);
+        test_bench_start(&bench);
+        for(uint32_t i = 0; i < timings_count; ++i) {
+            if(timings[i] > INFRARED_RAW_RX_TIMING_DELAY_US) {
+                infrared_test_replay_check(
+                    infrared_check_decoder_ready(test->decoder_handler),
+                    messages,
+                    messages_count,
+                    &message_counter);
+            }
+            infrared_test_replay_check(
+                infrared_decode(test->decoder_handler, level, timings[i]),
+                messages,
+                messages_count,
+                &message_counter);
+            level = !level;
+        }
+        infrared_test_replay_check(
+            infrared_check_decoder_ready(test->decoder_handler),
+            messages,
+            messages_count,
+            &message_counter);
+        test_bench_stop(&bench);
+        mu_assert(message_counter == messages_count, "decoded less than expected during replay");
+    }
+
+    const uint32_t edges = timings_count * IR_TEST_REPLAY_ROUNDS;
+    const uint32_t frames = messages_count * IR_TEST_REPLAY_ROUNDS;
+    const uint32_t edge_ns = test_bench_get_ns(&bench, edges);
+    FURI_LOG_I(
+        TAG,
+        "%s replay: %lu edges, %lu edges/s, %lu cycles per frame",
+        infrared_get_protocol_name(protocol),
+        edges,
+        edge_ns ? 1000000000UL / edge_ns : edges,
+        (uint32_t)(bench.cycles / (frames ? frames : 1)));
+
+    free(timings);
+    free(messages);
+}
+
+static void infrared_test_worker_rx_callback(void* context, InfraredWorkerSignal* signal) {
+    FuriMessageQueue* queue = context;
+    if(infrared_worker_signal_is_decoded(signal)) {
+        furi_message_queue_put(queue, infrared_worker_get_decoded_signal(signal), 0);
+    }
+}
+
+static void infrared_test_worker_feed(
+    InfraredWorker* worker,
+    const uint32_t* timings,
+    uint32_t timings_count,
+    bool level) {
+    for(uint32_t i = 0; i < timings_count; ++i) {
+        infrared_worker_rx_callback(worker, level, timings[i]);
+        level = !level;
+    }
+}
+
+static void infrared_test_run_worker_overrun(void) {
+    const InfraredMessage message = {
+        .protocol = InfraredProtocolNEC,
+        .address = 0x42,
+        .command = 0x11,
+        .repeat = false,
+    };
+
+    uint32_t timings_count = 200;
+    uint32_t* timings = malloc(sizeof(uint32_t) * timings_count);
+    bool start_level = false;
+    infrared_reset_encoder(test->encoder_handler, &message);
+    infrared_test_run_encoder_fill_array(
+        test->encoder_handler, timings, &timings_count, &start_level);
+
+    FuriMessageQueue* queue =
+        furi_message_queue_alloc(IR_TEST_OVERRUN_MESSAGES + 1, sizeof(InfraredMessage));
+    InfraredWorker* worker = infrared_worker_alloc();
+    infrared_worker_rx_set_received_signal_callback(
+        worker, infrared_test_worker_rx_callback, queue);
+    infrared_worker_rx_start(worker);
+
+    // Keep the worker thread from draining, so the capture buffer overruns mid-message
+    furi_kernel_lock();
+    for(uint32_t i = 0; i < IR_TEST_OVERRUN_MESSAGES; ++i) {
+        infrared_test_worker_feed(worker, timings, timings_count, start_level);
+    }
+    furi_kernel_unlock();
+    furi_delay_ms(100);
+
+    mu_assert(infrared_worker_rx_get_overrun_count(worker) > 0, "overrun was not forced");
+
+    // Messages after the overrun must decode to exactly what was sent
+    for(uint32_t i = 0; i < IR_TEST_OVERRUN_TAIL; ++i) {
+        infrared_test_worker_feed(worker, timings, timings_count, start_level);
+        furi_delay_ms(20);
+    }
+
+    uint32_t decoded = 0;
+    InfraredMessage message_decoded;
+    while(furi_message_queue_get(queue, &message_decoded, 0) == FuriStatusOk) {
+        infrared_test_compare_message_results(&message_decoded, &message);
+        ++decoded;
+    }
+    mu_assert(decoded >= IR_TEST_OVERRUN_TAIL, "messages after overrun were not decoded");
+
+    infrared_worker_rx_stop(worker);
+    infrared_worker_free(worker);
+    furi_message_queue_free(queue);
+    free(timings);
+}
+
 MU_TEST(infrared_test_decoder_samsung32) {
     infrared_test_run_decoder(InfraredProtocolSamsung32, 1);
 }
@@ -523,6 +688,17 @@ MU_TEST(infrared_test_encoder_decoder_all) {
     infrared_test_run_encoder_decoder(InfraredProtocolPioneer, 1);
 }
 
+MU_TEST(infrared_test_decoder_replay) {
+    infrared_test_run_decoder_replay(InfraredProtocolSIRC, 1);
+    infrared_test_run_decoder_replay(InfraredProtocolSamsung32, 1);
+    infrared_test_run_decoder_replay(InfraredProtocolNECext, 1);
+    infrared_test_run_decoder_replay(InfraredProtocolRC6, 2);
+}
+
+MU_TEST(infrared_test_worker_overrun) {
+    infrared_test_run_worker_overrun();
+}
+
 MU_TEST_SUITE(infrared_test) {
     MU_SUITE_CONFIGURE(&infrared_test_alloc, &infrared_test_free);
 
@@ -543,6 +719,8 @@ MU_TEST_SUITE(infrared_test) {
     MU_RUN_TEST(infrared_test_decoder_pioneer);
     MU_RUN_TEST(infrared_test_decoder_mixed);
     MU_RUN_TEST(infrared_test_encoder_decoder_all);
+    MU_RUN_TEST(infrared_test_decoder_replay);
+    MU_RUN_TEST(infrared_test_worker_overrun);
 }
 
 int run_minunit_test_infrared(void) {
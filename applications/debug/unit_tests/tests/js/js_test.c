@@ -72,12 +72,16 @@ MU_TEST(js_test_event_loop) {
 MU_TEST(js_test_storage) {
     js_test_run(JS_SCRIPT_PATH("storage"));
 }
+MU_TEST(js_test_gc) {
+    js_test_run(JS_SCRIPT_PATH("gc"));
+}
 
 MU_TEST_SUITE(test_js) {
     MU_RUN_TEST(js_test_basic);
     MU_RUN_TEST(js_test_math);
     MU_RUN_TEST(js_test_event_loop);
     MU_RUN_TEST(js_test_storage);
+    MU_RUN_TEST(js_test_gc);
 }
 
 int run_minunit_test_js(void) {
@@ -0,0 +1,204 @@
+#include <furi.h>
+#include <flipper_format/flipper_format.h>
+#include <toolbox/hex.h>
+#include <toolbox/key_index.h>
+#include <toolbox/stream/file_stream.h>
+#include "../test.h" // IWYU pragma: keep
+
+#define TAG "KeyIndexTest"
+
+// Index is generated next to the source at build time
+#define KEY_INDEX_TEST_SOURCE EXT_PATH("unit_tests/key_index/aid.nfc")
+#define KEY_INDEX_TEST_INDEX  EXT_PATH("unit_tests/key_index/aid.idx")
+
+// Copy of the source changed after its index was built
+#define KEY_INDEX_TEST_STALE_SOURCE EXT_PATH("unit_tests/key_index/stale.nfc")
+#define KEY_INDEX_TEST_STALE_INDEX  EXT_PATH("unit_tests/key_index/stale.idx")
+#define KEY_INDEX_TEST_STALE_LINE   "\nFFFFFFFFFF: Stale entry\n"
+
+#define KEY_INDEX_TEST_KEY_SIZE_MAX (16)
+
+static bool key_index_test_text_find(Storage* storage, const char* key, FuriString* value) {
+    FlipperFormat* file = flipper_format_file_alloc(storage);
+    FuriString* filetype = furi_string_alloc();
+    uint32_t version = 0;
+
+    bool found = flipper_format_file_open_existing(file, KEY_INDEX_TEST_SOURCE) &&
+                 flipper_format_read_header(file, filetype, &version) &&
+                 flipper_format_read_string(file, key, value);
+
+    furi_string_free(filetype);
+    flipper_format_free(file);
+    return found;
+}
+
+static bool key_index_test_parse_key(FuriString* line, uint8_t* key, size_t* key_size) {
+    const size_t separator = furi_string_search_char(line, ':');
+    if(separator == FURI_STRING_FAILURE || separator % 2 ||
+       separator / 2 > KEY_INDEX_TEST_KEY_SIZE_MAX)
+        return false;
+
+    const char* line_str = furi_string_get_cstr(line);
+    for(size_t i = 0; i < separator / 2; i++) {
+        if(!hex_char_to_uint8(line_str[i * 2], line_str[i * 2 + 1], &key[i])) return false;
+    }
+    *key_size = separator / 2;
+    furi_string_left(line, separator);
+
+    return true;
+}
+
+MU_TEST(key_index_lookup_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    Stream* stream = file_stream_alloc(storage);
+    FuriString* line = furi_string_alloc();
+    FuriString* text_value = furi_string_alloc();
+    FuriString* index_value = furi_string_alloc();
+
+    mu_assert(
+        file_stream_open(stream, KEY_INDEX_TEST_SOURCE, FSAM_READ, FSOM_OPEN_EXISTING),
+        "Failed to open source file");
+
+    uint32_t lookups = 0;
+    TestBench text_bench = {0};
+    TestBench index_bench = {0};
+
+    while(stream_read_line(stream, line)) {
+        uint8_t key[KEY_INDEX_TEST_KEY_SIZE_MAX];
+        size_t key_size = 0;
+        if(!key_index_test_parse_key(line, key, &key_size)) continue;
+
+        test_bench_start(&text_bench);
+        const bool text_found =
+            key_index_test_text_find(storage, furi_string_get_cstr(line), text_value);
+        test_bench_stop(&text_bench);
+
+        test_bench_start(&index_bench);
+        const KeyIndexStatus status = key_index_find(
+            storage, KEY_INDEX_TEST_INDEX, KEY_INDEX_TEST_SOURCE, key, key_size, index_value);
+        test_bench_stop(&index_bench);
+
+        mu_assert(text_found, "Key not found in source");
+        mu_assert_int_eq(KeyIndexStatusOk, status);
+        mu_assert_string_eq(furi_string_get_cstr(text_value), furi_string_get_cstr(index_value));
+        lookups++;
+    }
+
+    mu_assert(lookups > 100, "Too few keys in source");
+
+    const uint32_t text_us = test_bench_get_ns(&text_bench, lookups) / 1000;
+    const uint32_t index_us = test_bench_get_ns(&index_bench, lookups) / 1000;
+    FURI_LOG_I(TAG, "%lu lookups, text %luus, index %luus avg", lookups, text_us, index_us);
+    mu_assert(index_us < text_us, "Index lookup is slower than text scan");
+
+    furi_string_free(index_value);
+    furi_string_free(text_value);
+    furi_string_free(line);
+    stream_free(stream);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(key_index_missing_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FuriString* value = furi_string_alloc();
+
+    const uint8_t absent_key[] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+    mu_assert_int_eq(
+        KeyIndexStatusNotFound,
+        key_index_find(
+            storage, KEY_INDEX_TEST_INDEX, NULL, absent_key, sizeof(absent_key), value));
+
+    const uint8_t long_key[KEY_INDEX_TEST_KEY_SIZE_MAX + 1] = {0xA0};
+    mu_assert_int_eq(
+        KeyIndexStatusNotFound,
+        key_index_find(storage, KEY_INDEX_TEST_INDEX, NULL, long_key, sizeof(long_key), value));
+
+    // Not an index file
+    mu_assert_int_eq(
+        KeyIndexStatusError,
+        key_index_find(
+            storage, KEY_INDEX_TEST_SOURCE, NULL, absent_key, sizeof(absent_key), value));
+
+    mu_assert_int_eq(
+        KeyIndexStatusError,
+        key_index_find(
+            storage,
+            EXT_PATH("unit_tests/key_index/missing.idx"),
+            NULL,
+            absent_key,
+            sizeof(absent_key),
+            value));
+
+    furi_string_free(value);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(key_index_stale_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    FuriString* value = furi_string_alloc();
+    const uint8_t key[] = {0xA0, 0x00, 0x00, 0x00, 0x03, 0x10, 0x10};
+    const uint8_t stale_key[] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+    storage_simply_remove(storage, KEY_INDEX_TEST_STALE_SOURCE);
+    storage_simply_remove(storage, KEY_INDEX_TEST_STALE_INDEX);
+    mu_assert_int_eq(
+        FSE_OK, storage_common_copy(storage, KEY_INDEX_TEST_SOURCE, KEY_INDEX_TEST_STALE_SOURCE));
+
+    // Missing index is built from the source
+    mu_assert_int_eq(
+        KeyIndexStatusOk,
+        key_index_find(
+            storage,
+            KEY_INDEX_TEST_STALE_INDEX,
+            KEY_INDEX_TEST_STALE_SOURCE,
+            key,
+            sizeof(key),
+            value));
+    mu_assert_string_eq("VISA Debit/Credit (Classic)", furi_string_get_cstr(value));
+
+    mu_assert(
+        storage_file_open(file, KEY_INDEX_TEST_STALE_SOURCE, FSAM_WRITE, FSOM_OPEN_APPEND),
+        "Failed to open source copy");
+    const size_t line_size = strlen(KEY_INDEX_TEST_STALE_LINE);
+    mu_assert_int_eq(line_size, storage_file_write(file, KEY_INDEX_TEST_STALE_LINE, line_size));
+    storage_file_close(file);
+
+    // Index used as is does not know about the change
+    mu_assert_int_eq(
+        KeyIndexStatusNotFound,
+        key_index_find(
+            storage, KEY_INDEX_TEST_STALE_INDEX, NULL, stale_key, sizeof(stale_key), value));
+
+    // Changed source is detected and index is rebuilt
+    mu_assert_int_eq(
+        KeyIndexStatusOk,
+        key_index_find(
+            storage,
+            KEY_INDEX_TEST_STALE_INDEX,
+            KEY_INDEX_TEST_STALE_SOURCE,
+            stale_key,
+            sizeof(stale_key),
+            value));
+    mu_assert_string_eq("Stale entry", furi_string_get_cstr(value));
+
+    mu_assert_int_eq(FSE_OK, storage_common_remove(storage, KEY_INDEX_TEST_STALE_SOURCE));
+    mu_assert_int_eq(FSE_OK, storage_common_remove(storage, KEY_INDEX_TEST_STALE_INDEX));
+
+    furi_string_free(value);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST_SUITE(key_index) {
+    MU_RUN_TEST(key_index_lookup_test);
+    MU_RUN_TEST(key_index_missing_test);
+    MU_RUN_TEST(key_index_stale_test);
+}
+
+int run_minunit_test_key_index(void) {
+    MU_RUN_SUITE(key_index);
+    return MU_EXIT_CODE;
+}
+
+TEST_API_DEFINE(run_minunit_test_key_index)
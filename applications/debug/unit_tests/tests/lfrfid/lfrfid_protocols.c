@@ -3,9 +3,14 @@
 #include <toolbox/protocols/protocol_dict.h>
 #include <lfrfid/protocols/lfrfid_protocols.h>
 #include <toolbox/pulse_protocols/pulse_glue.h>
+#include <toolbox/varint.h>
+#include <lfrfid/lfrfid_raw_file.h>
+#include <storage/storage.h>
 
 #define LF_RFID_READ_TIMING_MULTIPLIER 8
 
+#define TAG "LfRfidProtocolsTest"
+
 #define EM_TEST_DATA                    {0x58, 0x00, 0x85, 0x64, 0x02}
 #define EM_TEST_DATA_SIZE               5
 #define EM_TEST_EMULATION_TIMINGS_COUNT (64 * 2)
@@ -526,6 +531,242 @@ MU_TEST(test_lfrfid_protocol_fdxb_read_simple) {
     protocol_dict_free(dict);
 }
 
+#define REPLAY_TEST_DATA_SIZE_MAX 12
+#define REPLAY_TEST_TIMINGS_MAX   20000
+
+typedef struct {
+    LFRFIDProtocol protocol;
+    uint8_t data[REPLAY_TEST_DATA_SIZE_MAX];
+} LfRfidReplayTestCase;
+
+// Decoders matching preambles on BitLibStream, data fits decoded bit size
+static const LfRfidReplayTestCase replay_test_cases[] = {
+    {LFRFIDProtocolFDXB, FDXB_TEST_DATA},
+    {LFRFIDProtocolViking, {0x12, 0x34, 0x56, 0x78}},
+    {LFRFIDProtocolHidGeneric, {0x02, 0x00, 0x00, 0x07, 0x35, 0x20}},
+    {LFRFIDProtocolHidExGeneric,
+     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x23, 0x45, 0x60}},
+};
+
+MU_TEST(test_lfrfid_protocol_stream_decoders_replay) {
+    ProtocolDict* encoder = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
+    ProtocolDict* decoder = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
+    PulseGlue* pulse_glue = pulse_glue_alloc();
+
+    TestBench bench = {0};
+    uint32_t pulses = 0;
+
+    for(size_t i = 0; i < COUNT_OF(replay_test_cases); i++) {
+        const LfRfidReplayTestCase* test_case = &replay_test_cases[i];
+        const size_t data_size = protocol_dict_get_data_size(encoder, test_case->protocol);
+
+        protocol_dict_set_data(encoder, test_case->protocol, test_case->data, data_size);
+        mu_check(protocol_dict_encoder_start(encoder, test_case->protocol));
+        protocol_dict_decoders_start(decoder);
+        pulse_glue_reset(pulse_glue);
+
+        ProtocolId protocol = PROTOCOL_NO;
+        for(size_t j = 0; j < REPLAY_TEST_TIMINGS_MAX && protocol == PROTOCOL_NO; j++) {
+            LevelDuration level_duration =
+                protocol_dict_encoder_yield(encoder, test_case->protocol);
+            bool pulse_pop = pulse_glue_push(
+                pulse_glue,
+                level_duration_get_level(level_duration),
+                level_duration_get_duration(level_duration) * LF_RFID_READ_TIMING_MULTIPLIER);
+
+            if(pulse_pop) {
+                uint32_t length, period;
+                pulse_glue_pop(pulse_glue, &length, &period);
+
+                test_bench_start(&bench);
+                protocol = protocol_dict_decoders_feed(decoder, true, period);
+                if(protocol == PROTOCOL_NO) {
+                    protocol = protocol_dict_decoders_feed(decoder, false, length - period);
+                }
+                test_bench_stop(&bench);
+                pulses++;
+            }
+        }
+
+        mu_assert_int_eq(test_case->protocol, protocol);
+        uint8_t received_data[REPLAY_TEST_DATA_SIZE_MAX] = {0};
+        protocol_dict_get_data(decoder, protocol, received_data, data_size);
+        mu_assert_mem_eq(test_case->data, received_data, data_size);
+    }
+
+    FURI_LOG_I(
+        TAG,
+        "%lu pulses, %lu ns per pulse for all decoders",
+        pulses,
+        test_bench_get_ns(&bench, pulses));
+
+    pulse_glue_free(pulse_glue);
+    protocol_dict_free(decoder);
+    protocol_dict_free(encoder);
+}
+
+typedef struct {
+    LFRFIDProtocol protocol;
+    const int8_t* timings;
+    size_t timings_count;
+} LfRfidReadTimeTestCase;
+
+static const LfRfidReadTimeTestCase read_time_test_cases[] = {
+    {LFRFIDProtocolEM4100, em_test_timings, EM_TEST_EMULATION_TIMINGS_COUNT},
+    {LFRFIDProtocolH10301, hid10301_test_timings, HID10301_TEST_EMULATION_TIMINGS_COUNT},
+    {LFRFIDProtocolIOProxXSF, ioprox_xsf_test_timings, IOPROX_XSF_TEST_EMULATION_TIMINGS_COUNT},
+    {LFRFIDProtocolFDXB, fdxb_test_timings, FDXB_TEST_EMULATION_TIMINGS_COUNT},
+};
+
+MU_TEST(test_lfrfid_protocol_parallel_read_time) {
+    ProtocolDict* dict = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
+    PulseGlue* pulse_glue = pulse_glue_alloc();
+
+    // Same feature filter as LFRFIDWorkerReadTypeExperimentalParallel
+    const uint32_t feature = LFRFIDFeatureASK | LFRFIDFeaturePSK;
+
+    for(size_t i = 0; i < COUNT_OF(read_time_test_cases); i++) {
+        const LfRfidReadTimeTestCase* test_case = &read_time_test_cases[i];
+
+        protocol_dict_decoders_start(dict);
+        pulse_glue_reset(pulse_glue);
+
+        ProtocolId protocol = PROTOCOL_NO;
+        uint32_t signal_time_us = 0;
+
+        for(size_t j = 0; j < test_case->timings_count * 10 && protocol == PROTOCOL_NO; j++) {
+            const int8_t timing = test_case->timings[j % test_case->timings_count];
+            const uint32_t duration = abs(timing) * LF_RFID_READ_TIMING_MULTIPLIER;
+            signal_time_us += duration;
+
+            if(pulse_glue_push(pulse_glue, timing >= 0, duration)) {
+                uint32_t length, period;
+                pulse_glue_pop(pulse_glue, &length, &period);
+
+                protocol = protocol_dict_decoders_feed_by_feature(dict, feature, true, period);
+                if(protocol == PROTOCOL_NO) {
+                    protocol = protocol_dict_decoders_feed_by_feature(
+                        dict, feature, false, length - period);
+                }
+            }
+        }
+
+        mu_assert_int_eq(test_case->protocol, protocol);
+        FURI_LOG_I(
+            TAG,
+            "%s: first read after %luus of signal",
+            protocol_dict_get_name(dict, protocol),
+            signal_time_us);
+    }
+
+    pulse_glue_free(pulse_glue);
+    protocol_dict_free(dict);
+}
+
+#define LF_RFID_RAW_TEST_FILE        EXT_PATH("unit_tests/lfrfid_raw_test.raw")
+#define LF_RFID_RAW_TEST_BUFFER_SIZE (2048)
+#define LF_RFID_RAW_TEST_PAIR_COUNT  (20000)
+#define LF_RFID_RAW_TEST_BATCH       (64)
+
+// EM4100 capture: encoder timings with a bit of jitter, same pair layout as raw worker
+static void lfrfid_raw_test_pair(size_t index, uint32_t* pulse, uint32_t* duration) {
+    const int8_t high = em_test_timings[(index * 2) % EM_TEST_EMULATION_TIMINGS_COUNT];
+    const int8_t low = em_test_timings[(index * 2 + 1) % EM_TEST_EMULATION_TIMINGS_COUNT];
+    *pulse = abs(high) * LF_RFID_READ_TIMING_MULTIPLIER + index % 3;
+    *duration = *pulse + abs(low) * LF_RFID_READ_TIMING_MULTIPLIER + index % 5;
+}
+
+MU_TEST(test_lfrfid_raw_file_round_trip) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    LFRFIDRawFile* file = lfrfid_raw_file_alloc(storage);
+    uint8_t* buffer = malloc(LF_RFID_RAW_TEST_BUFFER_SIZE);
+
+    mu_assert(lfrfid_raw_file_open_write(file, LF_RFID_RAW_TEST_FILE), "Failed to open file");
+    mu_assert(
+        lfrfid_raw_file_write_header(file, 125000, 0.5f, LF_RFID_RAW_TEST_BUFFER_SIZE),
+        "Failed to write header");
+
+    // Plain format: size and data of every buffer
+    size_t plain_size = 0;
+    size_t buffer_size = 0;
+    for(size_t i = 0; i < LF_RFID_RAW_TEST_PAIR_COUNT; i++) {
+        uint32_t pulse, duration;
+        lfrfid_raw_test_pair(i, &pulse, &duration);
+        if(buffer_size + 10 > LF_RFID_RAW_TEST_BUFFER_SIZE) {
+            mu_assert(lfrfid_raw_file_write_buffer(file, buffer, buffer_size), "Write failed");
+            plain_size += buffer_size + sizeof(uint32_t);
+            buffer_size = 0;
+        }
+        buffer_size += varint_uint32_pack(pulse, &buffer[buffer_size]);
+        buffer_size += varint_uint32_pack(duration, &buffer[buffer_size]);
+    }
+    mu_assert(lfrfid_raw_file_write_buffer(file, buffer, buffer_size), "Write failed");
+    plain_size += buffer_size + sizeof(uint32_t);
+
+    // Index is written on free
+    lfrfid_raw_file_free(file);
+
+    FileInfo file_info;
+    mu_assert_int_eq(FSE_OK, storage_common_stat(storage, LF_RFID_RAW_TEST_FILE, &file_info));
+    FURI_LOG_I(TAG, "Raw file: %lu bytes, plain %u", (uint32_t)file_info.size, plain_size);
+    mu_assert(file_info.size < plain_size, "Raw file is bigger than plain format");
+
+    file = lfrfid_raw_file_alloc(storage);
+    mu_assert(lfrfid_raw_file_open_read(file, LF_RFID_RAW_TEST_FILE), "Failed to open file");
+
+    float frequency, duty_cycle;
+    mu_assert(lfrfid_raw_file_read_header(file, &frequency, &duty_cycle), "Invalid header");
+    mu_assert_double_eq(125000, frequency);
+
+    uint32_t pulse[LF_RFID_RAW_TEST_BATCH];
+    uint32_t duration[LF_RFID_RAW_TEST_BATCH];
+    bool pass_end = false;
+    size_t index = 0;
+    size_t read_count = 0;
+
+    // Only reading is measured, not the checks
+    TestBench bench = {0};
+    while(!pass_end) {
+        test_bench_start(&bench);
+        const size_t count =
+            lfrfid_raw_file_read_pairs(file, duration, pulse, LF_RFID_RAW_TEST_BATCH, &pass_end);
+        test_bench_stop(&bench);
+        mu_assert(count > 0, "Read failed");
+        read_count += count;
+
+        for(size_t i = 0; i < count; i++, index++) {
+            // Reader starts over from the first pair after the end of the file
+            if(index == LF_RFID_RAW_TEST_PAIR_COUNT) index = 0;
+
+            uint32_t expected_pulse, expected_duration;
+            lfrfid_raw_test_pair(index, &expected_pulse, &expected_duration);
+            mu_assert_int_eq(expected_pulse, pulse[i]);
+            mu_assert_int_eq(expected_duration, duration[i]);
+        }
+    }
+    FURI_LOG_I(
+        TAG,
+        "Raw file: %u pairs read in %luus",
+        read_count,
+        test_bench_get_ns(&bench, 1) / 1000);
+
+    const uint32_t seek_index = LF_RFID_RAW_TEST_PAIR_COUNT * 2 / 3;
+    mu_assert(lfrfid_raw_file_seek(file, seek_index), "Seek failed");
+    mu_assert_int_eq(1, lfrfid_raw_file_read_pairs(file, duration, pulse, 1, NULL));
+
+    uint32_t expected_pulse, expected_duration;
+    lfrfid_raw_test_pair(seek_index, &expected_pulse, &expected_duration);
+    mu_assert_int_eq(expected_pulse, pulse[0]);
+    mu_assert_int_eq(expected_duration, duration[0]);
+
+    mu_assert(!lfrfid_raw_file_seek(file, LF_RFID_RAW_TEST_PAIR_COUNT), "Seek past end");
+
+    lfrfid_raw_file_free(file);
+    storage_simply_remove(storage, LF_RFID_RAW_TEST_FILE);
+    free(buffer);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(test_lfrfid_protocols_suite) {
     MU_RUN_TEST(test_lfrfid_protocol_em_read_simple);
     MU_RUN_TEST(test_lfrfid_protocol_em_emulate_simple);
@@ -540,6 +781,11 @@ MU_TEST_SUITE(test_lfrfid_protocols_suite) {
 
     MU_RUN_TEST(test_lfrfid_protocol_fdxb_read_simple);
     MU_RUN_TEST(test_lfrfid_protocol_fdxb_emulate_simple);
+
+    MU_RUN_TEST(test_lfrfid_protocol_stream_decoders_replay);
+    MU_RUN_TEST(test_lfrfid_protocol_parallel_read_time);
+
+    MU_RUN_TEST(test_lfrfid_raw_file_round_trip);
 }
 
 int run_minunit_test_lfrfid_protocols(void) {
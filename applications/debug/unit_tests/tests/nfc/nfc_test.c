@@ -4,6 +4,8 @@
 
 #include <nfc/nfc_device.h>
 #include <nfc/helpers/nfc_data_generator.h>
+#include <nfc/helpers/mf_classic_dict_attack_stage.h>
+#include <nfc/helpers/mf_classic_key_index.h>
 #include <nfc/nfc_poller.h>
 #include <nfc/nfc_listener.h>
 #include <nfc/protocols/iso14443_3a/iso14443_3a.h>
@@ -32,6 +34,10 @@
 
 #define NFC_TEST_NFC_DEV_PATH                  EXT_PATH("unit_tests/nfc/nfc_device_test.nfc")
 #define NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH EXT_PATH("unit_tests/mf_dict.nfc")
+#define NFC_TEST_MF_CLASSIC_KEY_INDEX_PATH     EXT_PATH("unit_tests/nfc/mf_classic_keys.idx")
+
+#define NFC_TEST_KEY_INDEX_SITES          (4)
+#define NFC_TEST_KEY_INDEX_CARDS_PER_SITE (8)
 
 #define NFC_TEST_FLAG_WORKER_DONE (1)
 
@@ -387,6 +393,60 @@ static void mf_ultralight_write(void) {
     nfc_free(poller);
 }
 
+static void mf_ultralight_read_latency(void) {
+    Nfc* poller = nfc_alloc();
+    Nfc* listener = nfc_alloc();
+
+    NfcDevice* nfc_device = nfc_device_alloc();
+    nfc_data_generator_fill_data(NfcDataGeneratorTypeNTAG216, nfc_device);
+
+    MfUltralightData* data =
+        (MfUltralightData*)nfc_device_get_data(nfc_device, NfcProtocolMfUltralight);
+    const uint16_t last_user_page = mf_ultralight_get_config_page_num(data->type) - 2;
+    for(uint16_t i = 4; i <= last_user_page; i++) {
+        furi_hal_random_fill_buf(data->page[i].data, sizeof(MfUltralightPage));
+    }
+
+    NfcListener* mfu_listener = nfc_listener_alloc(listener, NfcProtocolMfUltralight, data);
+    nfc_listener_start(mfu_listener, NULL, NULL);
+
+    const uint8_t pwd_page = mf_ultralight_get_pwd_page_num(data->type);
+    TestBench read_bench = {0};
+
+    // Every READ window, pwd and pack must still be hidden
+    for(uint16_t i = 0; i < data->pages_total; i++) {
+        MfUltralightPage page = {};
+        test_bench_start(&read_bench);
+        MfUltralightError error = mf_ultralight_poller_sync_read_page(poller, i, &page);
+        test_bench_stop(&read_bench);
+        mu_assert(error == MfUltralightErrorNone, "mf_ultralight_poller_sync_read_page() failed");
+
+        MfUltralightPage expected = data->page[i];
+        if(i == pwd_page || i == pwd_page + 1) memset(&expected, 0, sizeof(expected));
+        mu_assert(memcmp(&page, &expected, sizeof(page)) == 0, "Page data not matches");
+    }
+
+    FURI_LOG_I(
+        TAG, "READ: %luus avg", test_bench_get_ns(&read_bench, data->pages_total) / 1000);
+
+    // Written page must not be served from stale response
+    MfUltralightPage page = {};
+    furi_hal_random_fill_buf(page.data, sizeof(MfUltralightPage));
+    MfUltralightError error = mf_ultralight_poller_sync_write_page(poller, 4, &page);
+    mu_assert(error == MfUltralightErrorNone, "mf_ultralight_poller_sync_write_page() failed");
+
+    MfUltralightPage page_read = {};
+    error = mf_ultralight_poller_sync_read_page(poller, 4, &page_read);
+    mu_assert(error == MfUltralightErrorNone, "mf_ultralight_poller_sync_read_page() failed");
+    mu_assert(memcmp(&page, &page_read, sizeof(page)) == 0, "Written page not matches");
+
+    nfc_listener_stop(mfu_listener);
+    nfc_listener_free(mfu_listener);
+    nfc_device_free(nfc_device);
+    nfc_free(listener);
+    nfc_free(poller);
+}
+
 static void mf_classic_reader(void) {
     Nfc* poller = nfc_alloc();
     Nfc* listener = nfc_alloc();
@@ -583,6 +643,403 @@ MU_TEST(mf_classic_send_frame_test) {
     nfc_free(poller);
 }
 
+typedef struct {
+    const MfClassicDeviceKeys* keys;
+    uint8_t sector;
+    MfClassicKeyType key_type;
+    FuriThreadId thread_id;
+} NfcTestMfClassicReadSectorContext;
+
+// Sector by sector read mode, keys are given out in the same order as the NFC app key cache
+static NfcCommand mf_classic_read_sector_callback(NfcGenericEvent event, void* context) {
+    NfcTestMfClassicReadSectorContext* read_ctx = context;
+    const MfClassicPollerEvent* mfc_event = event.event_data;
+    NfcCommand command = NfcCommandContinue;
+
+    if(mfc_event->type == MfClassicPollerEventTypeRequestMode) {
+        mfc_event->data->poller_mode.mode = MfClassicPollerModeRead;
+    } else if(mfc_event->type == MfClassicPollerEventTypeRequestReadSector) {
+        MfClassicPollerEventDataReadSectorRequest* request =
+            &mfc_event->data->read_sector_request_data;
+        request->key_provided = false;
+        while(read_ctx->sector < MF_CLASSIC_TOTAL_SECTORS_MAX && !request->key_provided) {
+            request->sector_num = read_ctx->sector;
+            request->key_type = read_ctx->key_type;
+            if(read_ctx->key_type == MfClassicKeyTypeA) {
+                request->key = read_ctx->keys->key_a[read_ctx->sector];
+                request->key_provided = FURI_BIT(read_ctx->keys->key_a_mask, read_ctx->sector);
+                read_ctx->key_type = MfClassicKeyTypeB;
+            } else {
+                request->key = read_ctx->keys->key_b[read_ctx->sector];
+                request->key_provided = FURI_BIT(read_ctx->keys->key_b_mask, read_ctx->sector);
+                read_ctx->key_type = MfClassicKeyTypeA;
+                read_ctx->sector++;
+            }
+        }
+    } else if(
+        mfc_event->type == MfClassicPollerEventTypeSuccess ||
+        mfc_event->type == MfClassicPollerEventTypeCardLost) {
+        command = NfcCommandStop;
+    }
+
+    if(command == NfcCommandStop) {
+        furi_thread_flags_set(read_ctx->thread_id, NFC_TEST_FLAG_WORKER_DONE);
+    }
+
+    return command;
+}
+
+typedef struct {
+    const MfClassicDeviceKeys* keys;
+    MfClassicPollerEventDataReadFastStats stats;
+    bool success;
+    FuriThreadId thread_id;
+} NfcTestMfClassicReadFastContext;
+
+static NfcCommand mf_classic_read_fast_callback(NfcGenericEvent event, void* context) {
+    NfcTestMfClassicReadFastContext* read_ctx = context;
+    const MfClassicPollerEvent* mfc_event = event.event_data;
+    NfcCommand command = NfcCommandContinue;
+
+    if(mfc_event->type == MfClassicPollerEventTypeRequestMode) {
+        mfc_event->data->poller_mode.mode = MfClassicPollerModeReadFast;
+        mfc_event->data->poller_mode.keys = read_ctx->keys;
+    } else if(mfc_event->type == MfClassicPollerEventTypeSuccess) {
+        read_ctx->stats = mfc_event->data->read_fast_stats;
+        read_ctx->success = true;
+        command = NfcCommandStop;
+    } else if(mfc_event->type == MfClassicPollerEventTypeCardLost) {
+        command = NfcCommandStop;
+    }
+
+    if(command == NfcCommandStop) {
+        furi_thread_flags_set(read_ctx->thread_id, NFC_TEST_FLAG_WORKER_DONE);
+    }
+
+    return command;
+}
+
+static bool mf_classic_read_fast_test_read(
+    Nfc* poller,
+    const MfClassicDeviceKeys* keys,
+    const MfClassicData* data,
+    MfClassicPollerEventDataReadFastStats* stats) {
+    NfcTestMfClassicReadFastContext read_ctx = {
+        .keys = keys,
+        .thread_id = furi_thread_get_current_id(),
+    };
+
+    NfcPoller* mfc_poller = nfc_poller_alloc(poller, NfcProtocolMfClassic);
+    nfc_poller_start(mfc_poller, mf_classic_read_fast_callback, &read_ctx);
+    furi_thread_flags_wait(NFC_TEST_FLAG_WORKER_DONE, FuriFlagWaitAny, FuriWaitForever);
+    nfc_poller_stop(mfc_poller);
+    const bool data_match = mf_classic_is_equal(nfc_poller_get_data(mfc_poller), data);
+    nfc_poller_free(mfc_poller);
+
+    *stats = read_ctx.stats;
+    return read_ctx.success && data_match;
+}
+
+MU_TEST(mf_classic_read_fast_test) {
+    Nfc* poller = nfc_alloc();
+    Nfc* listener = nfc_alloc();
+
+    NfcDevice* nfc_device = nfc_device_alloc();
+    nfc_data_generator_fill_data(NfcDataGeneratorTypeMfClassic4k_4b, nfc_device);
+    MfClassicData* data = (MfClassicData*)nfc_device_get_data(nfc_device, NfcProtocolMfClassic);
+
+    // Even sectors share one key A, odd sectors keep the default one
+    const uint64_t shared_key = 0xA0A1A2A3A4A5;
+    MfClassicDeviceKeys keys = {};
+    for(uint8_t sector = 0; sector < MF_CLASSIC_TOTAL_SECTORS_MAX; sector++) {
+        if(sector % 2 == 0) {
+            mf_classic_set_key_found(data, sector, MfClassicKeyTypeA, shared_key);
+        }
+        MfClassicSectorTrailer* sec_tr = mf_classic_get_sector_trailer_by_sector(data, sector);
+        keys.key_a[sector] = sec_tr->key_a;
+        keys.key_b[sector] = sec_tr->key_b;
+    }
+    keys.key_a_mask = data->key_a_mask;
+    keys.key_b_mask = data->key_b_mask;
+
+    for(uint16_t block = 0; block < mf_classic_get_total_block_num(data->type); block++) {
+        if(block == 0 || mf_classic_is_sector_trailer(block)) continue;
+        furi_hal_random_fill_buf(data->block[block].data, sizeof(MfClassicBlock));
+    }
+
+    NfcListener* mfc_listener = nfc_listener_alloc(listener, NfcProtocolMfClassic, data);
+    nfc_listener_start(mfc_listener, NULL, NULL);
+
+    NfcPoller* mfc_poller = nfc_poller_alloc(poller, NfcProtocolMfClassic);
+    NfcTestMfClassicReadSectorContext read_ctx = {
+        .keys = &keys,
+        .thread_id = furi_thread_get_current_id(),
+    };
+    nfc_poller_start(mfc_poller, mf_classic_read_sector_callback, &read_ctx);
+    furi_thread_flags_wait(NFC_TEST_FLAG_WORKER_DONE, FuriFlagWaitAny, FuriWaitForever);
+    nfc_poller_stop(mfc_poller);
+    mu_assert(
+        mf_classic_is_equal(nfc_poller_get_data(mfc_poller), data),
+        "Sector read data not matches");
+    nfc_poller_free(mfc_poller);
+
+    // All keys are known: one full auth, every other sector is entered with a nested one
+    const uint8_t sectors_total = mf_classic_get_total_sectors_num(data->type);
+    MfClassicPollerEventDataReadFastStats stats = {};
+    mu_assert(
+        mf_classic_read_fast_test_read(poller, &keys, data, &stats),
+        "Fast read data not matches");
+    FURI_LOG_I(
+        TAG,
+        "4K fast read: %u auth (%u nested), %u reselect",
+        stats.auth_count,
+        stats.nested_auth_count,
+        stats.reselect_count);
+    mu_assert(stats.reselect_count == 0, "Fast read reselected the card");
+    mu_assert(stats.auth_count - stats.nested_auth_count == 1, "Fast read lost the session");
+    mu_assert(stats.auth_count >= sectors_total, "Fast read skipped sectors");
+    mu_assert(stats.auth_count <= sectors_total * 2, "Fast read authenticated too often");
+    const uint16_t known_keys_auth_count = stats.auth_count;
+
+    // The sync API runs the same fast read
+    MfClassicData* mfc_data = mf_classic_alloc();
+    MfClassicError error = mf_classic_poller_sync_read(poller, &keys, mfc_data);
+    mu_assert(error == MfClassicErrorNone, "mf_classic_poller_sync_read() failed");
+    mu_assert(mf_classic_is_equal(mfc_data, data), "Sync fast read data not matches");
+    mf_classic_free(mfc_data);
+
+    // Keys of the last sectors are found from the keys of other sectors,
+    // at most one wrong guess per sector, it costs one auth and one reselect
+    FURI_BIT_CLEAR(keys.key_a_mask, MF_CLASSIC_TOTAL_SECTORS_MAX - 2);
+    FURI_BIT_CLEAR(keys.key_a_mask, MF_CLASSIC_TOTAL_SECTORS_MAX - 1);
+    mu_assert(
+        mf_classic_read_fast_test_read(poller, &keys, data, &stats),
+        "Key reuse read data not matches");
+    mu_assert(
+        stats.auth_count - stats.nested_auth_count == stats.reselect_count + 1u,
+        "Key reuse read has full auth without reselect");
+    mu_assert(stats.reselect_count <= 2, "Key reuse read reselected too often");
+    mu_assert(
+        stats.auth_count <= known_keys_auth_count + stats.reselect_count,
+        "Key reuse read authenticated too often");
+
+    nfc_listener_stop(mfc_listener);
+    nfc_listener_free(mfc_listener);
+    nfc_device_free(nfc_device);
+    nfc_free(listener);
+    nfc_free(poller);
+}
+
+// Access cards of one site share keys and manufacturer data, UIDs are random
+static void mf_classic_key_index_test_fill_card(
+    NfcDevice* nfc_device,
+    MfClassicData* data,
+    uint8_t site) {
+    nfc_data_generator_fill_data(NfcDataGeneratorTypeMfClassic1k_4b, nfc_device);
+    mf_classic_copy(data, nfc_device_get_data(nfc_device, NfcProtocolMfClassic));
+
+    memset(&data->block[0].data[8], 0xC0 | site, 8);
+    for(uint8_t sector = 0; sector < mf_classic_get_total_sectors_num(data->type); sector++) {
+        if(sector < 4) {
+            mf_classic_set_key_found(data, sector, MfClassicKeyTypeA, 0xA0A1A2A3A400 | site);
+        }
+        mf_classic_set_key_found(
+            data, sector, MfClassicKeyTypeB, 0xB0B1B2B3B400 | (site << 4) | (sector % 2));
+    }
+}
+
+static void mf_classic_key_index_test_forget_keys(MfClassicData* data, bool sector_0_known) {
+    data->key_a_mask = 0;
+    data->key_b_mask = 0;
+    memset(data->block_read_mask, 0, sizeof(data->block_read_mask));
+
+    if(sector_0_known) {
+        FURI_BIT_SET(data->key_a_mask, 0);
+        mf_classic_set_block_read(data, 0, &data->block[0]);
+    }
+}
+
+MU_TEST(mf_classic_key_index_test) {
+    NfcDevice* nfc_device = nfc_device_alloc();
+    MfClassicData* card = mf_classic_alloc();
+    MfClassicData* card_seen = mf_classic_alloc();
+    MfClassicKeyIndex* key_index = mf_classic_key_index_alloc(512);
+
+    TestBench add_bench = {0};
+    for(uint8_t site = 0; site < NFC_TEST_KEY_INDEX_SITES; site++) {
+        for(size_t i = 0; i < NFC_TEST_KEY_INDEX_CARDS_PER_SITE; i++) {
+            mf_classic_key_index_test_fill_card(nfc_device, card, site);
+            test_bench_start(&add_bench);
+            const bool is_new_card = mf_classic_key_index_add(key_index, card);
+            test_bench_stop(&add_bench);
+            mu_assert(is_new_card, "New card is reported as read before");
+        }
+    }
+
+    MfClassicKey keys[16];
+    size_t cold_suggested = 0;
+    size_t cold_hits = 0;
+    size_t warm_suggested = 0;
+    size_t warm_hits = 0;
+    TestBench lookup_bench = {0};
+    for(uint8_t site = 0; site < NFC_TEST_KEY_INDEX_SITES; site++) {
+        mf_classic_key_index_test_fill_card(nfc_device, card, site);
+        mf_classic_copy(card_seen, card);
+
+        // Before the first auth only the card family is known
+        mf_classic_key_index_test_forget_keys(card_seen, false);
+        test_bench_start(&lookup_bench);
+        size_t keys_num = mf_classic_key_index_lookup(key_index, card_seen, keys, COUNT_OF(keys));
+        test_bench_stop(&lookup_bench);
+        mu_assert(keys_num > 0, "No keys for known card family");
+        cold_suggested += keys_num;
+        cold_hits += mf_classic_key_index_update_stats(key_index, keys, keys_num, card);
+
+        // Manufacturer block and sector 0 key point to the site: FF key and two site keys B
+        mf_classic_key_index_test_forget_keys(card_seen, true);
+        keys_num = mf_classic_key_index_lookup(key_index, card_seen, keys, 3);
+        mu_assert(keys_num == 3, "Wrong key count");
+        const size_t hits = mf_classic_key_index_update_stats(key_index, keys, keys_num, card);
+        mu_assert(hits == 3, "Site keys are not ranked first");
+        warm_suggested += keys_num;
+        warm_hits += hits;
+    }
+
+    FURI_LOG_I(
+        TAG,
+        "Key index: %zu entries, add %luus/card, lookup %luus",
+        mf_classic_key_index_get_size(key_index),
+        test_bench_get_ns(
+            &add_bench, NFC_TEST_KEY_INDEX_SITES * NFC_TEST_KEY_INDEX_CARDS_PER_SITE) /
+            1000,
+        test_bench_get_ns(&lookup_bench, NFC_TEST_KEY_INDEX_SITES) / 1000);
+    FURI_LOG_I(
+        TAG,
+        "Family only: %zu of %zu keys hit, sector 0 known: %zu of %zu",
+        cold_hits,
+        cold_suggested,
+        warm_hits,
+        warm_suggested);
+
+    mu_assert(
+        mf_classic_key_index_save(key_index, NFC_TEST_MF_CLASSIC_KEY_INDEX_PATH),
+        "mf_classic_key_index_save() failed");
+    MfClassicKeyIndex* key_index_loaded = mf_classic_key_index_alloc(512);
+    mu_assert(
+        mf_classic_key_index_load(key_index_loaded, NFC_TEST_MF_CLASSIC_KEY_INDEX_PATH),
+        "mf_classic_key_index_load() failed");
+    mu_assert(
+        mf_classic_key_index_get_size(key_index_loaded) ==
+            mf_classic_key_index_get_size(key_index),
+        "Loaded index size not matches");
+    mu_assert(
+        memcmp(
+            mf_classic_key_index_get_stats(key_index_loaded),
+            mf_classic_key_index_get_stats(key_index),
+            sizeof(MfClassicKeyIndexStats)) == 0,
+        "Loaded index stats not matches");
+
+    // Index that does not fit is not loaded partially
+    MfClassicKeyIndex* key_index_small = mf_classic_key_index_alloc(8);
+    mu_assert(
+        !mf_classic_key_index_load(key_index_small, NFC_TEST_MF_CLASSIC_KEY_INDEX_PATH),
+        "Index over capacity loaded");
+    mu_assert(mf_classic_key_index_get_size(key_index_small) == 0, "Index is not empty");
+
+    // Card read again does not outweigh cards of another site with the same family
+    mf_classic_key_index_reset(key_index);
+    mf_classic_key_index_test_fill_card(nfc_device, card, 0);
+    mu_assert(mf_classic_key_index_add(key_index, card), "New card is reported as read before");
+    const size_t key_index_size = mf_classic_key_index_get_size(key_index);
+    for(size_t i = 0; i < NFC_TEST_KEY_INDEX_CARDS_PER_SITE; i++) {
+        mu_assert(!mf_classic_key_index_add(key_index, card), "Card read again is counted");
+    }
+    mu_assert(
+        mf_classic_key_index_get_size(key_index) == key_index_size,
+        "Card read again added entries");
+    for(size_t i = 0; i < 2; i++) {
+        mf_classic_key_index_test_fill_card(nfc_device, card, 1);
+        mf_classic_key_index_add(key_index, card);
+    }
+    mf_classic_copy(card_seen, card);
+    mf_classic_key_index_test_forget_keys(card_seen, false);
+    mu_assert(mf_classic_key_index_lookup(key_index, card_seen, keys, 3) == 3, "Wrong key count");
+    mu_assert(
+        mf_classic_key_index_update_stats(key_index, keys, 3, card) == 3,
+        "Card read again outweighs other cards");
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    mu_assert(
+        storage_simply_remove(storage, NFC_TEST_MF_CLASSIC_KEY_INDEX_PATH),
+        "storage_simply_remove() failed");
+    furi_record_close(RECORD_STORAGE);
+
+    mf_classic_key_index_free(key_index_small);
+    mf_classic_key_index_free(key_index_loaded);
+    mf_classic_key_index_free(key_index);
+    mf_classic_free(card_seen);
+    mf_classic_free(card);
+    nfc_device_free(nfc_device);
+}
+
+typedef struct {
+    uint32_t stages_with_keys;
+    MfClassicDictAttackStage prepared[MfClassicDictAttackStageSystemDict + 1];
+    size_t prepared_num;
+} NfcTestMfClassicDictAttackStageContext;
+
+static bool
+    mf_classic_dict_attack_stage_test_prepare(MfClassicDictAttackStage stage, void* context) {
+    NfcTestMfClassicDictAttackStageContext* ctx = context;
+    furi_check(ctx->prepared_num < COUNT_OF(ctx->prepared));
+    ctx->prepared[ctx->prepared_num++] = stage;
+    return FURI_BIT(ctx->stages_with_keys, stage);
+}
+
+static MfClassicDictAttackStage mf_classic_dict_attack_stage_test_enter(
+    NfcTestMfClassicDictAttackStageContext* ctx,
+    MfClassicDictAttackStage stage) {
+    ctx->prepared_num = 0;
+    return mf_classic_dict_attack_stage_enter(
+        stage, mf_classic_dict_attack_stage_test_prepare, ctx);
+}
+
+MU_TEST(mf_classic_dict_attack_stage_test) {
+    NfcTestMfClassicDictAttackStageContext ctx = {};
+
+    // No key index suggestions and no CUID dictionary: the key index is queried again
+    ctx.stages_with_keys = (1UL << MfClassicDictAttackStageKeyIndexRequery) |
+                           (1UL << MfClassicDictAttackStageUserDict) |
+                           (1UL << MfClassicDictAttackStageSystemDict);
+    MfClassicDictAttackStage stage =
+        mf_classic_dict_attack_stage_test_enter(&ctx, MfClassicDictAttackStageKeyIndex);
+    mu_assert(stage == MfClassicDictAttackStageKeyIndexRequery, "Requery stage not entered");
+    mu_assert(ctx.prepared_num == 3, "Wrong prepared stage count");
+    mu_assert(ctx.prepared[0] == MfClassicDictAttackStageKeyIndex, "Key index not prepared");
+    mu_assert(ctx.prepared[1] == MfClassicDictAttackStageCuidDict, "CUID dict not prepared");
+
+    // The scene moves on to the stage after the completed one
+    stage = mf_classic_dict_attack_stage_test_enter(&ctx, (MfClassicDictAttackStage)(stage + 1));
+    mu_assert(stage == MfClassicDictAttackStageUserDict, "User dict stage not entered");
+    mu_assert(ctx.prepared_num == 1, "Wrong prepared stage count");
+    stage = mf_classic_dict_attack_stage_test_enter(&ctx, (MfClassicDictAttackStage)(stage + 1));
+    mu_assert(stage == MfClassicDictAttackStageSystemDict, "System dict stage not entered");
+
+    // Key index stage done, no CUID dictionary and nothing new in the key index
+    ctx.stages_with_keys = 0;
+    stage = mf_classic_dict_attack_stage_test_enter(&ctx, MfClassicDictAttackStageCuidDict);
+    mu_assert(stage == MfClassicDictAttackStageSystemDict, "System dict is not the last resort");
+    mu_assert(ctx.prepared_num == 4, "Wrong prepared stage count");
+    mu_assert(ctx.prepared[1] == MfClassicDictAttackStageKeyIndexRequery, "Requery stage skipped");
+    mu_assert(ctx.prepared[2] == MfClassicDictAttackStageUserDict, "User dict stage skipped");
+
+    // A CUID dictionary is tried right after the key index
+    ctx.stages_with_keys = 1UL << MfClassicDictAttackStageCuidDict;
+    stage = mf_classic_dict_attack_stage_test_enter(&ctx, MfClassicDictAttackStageKeyIndex);
+    mu_assert(stage == MfClassicDictAttackStageCuidDict, "CUID dict stage not entered");
+    mu_assert(ctx.prepared_num == 2, "Wrong prepared stage count");
+}
+
 MU_TEST(mf_classic_dict_test) {
     Storage* storage = furi_record_open(RECORD_STORAGE);
     if(storage_common_stat(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, NULL) == FSE_OK) {
@@ -835,6 +1292,7 @@ MU_TEST_SUITE(nfc) {
     MU_RUN_TEST(mf_ultralight_c_reader);
 
     MU_RUN_TEST(mf_ultralight_write);
+    MU_RUN_TEST(mf_ultralight_read_latency);
 
     MU_RUN_TEST(iso14443_3a_4b_file_test);
     MU_RUN_TEST(iso14443_3a_7b_file_test);
@@ -863,6 +1321,9 @@ MU_TEST_SUITE(nfc) {
     MU_RUN_TEST(mf_classic_write);
     MU_RUN_TEST(mf_classic_value_block);
     MU_RUN_TEST(mf_classic_send_frame_test);
+    MU_RUN_TEST(mf_classic_read_fast_test);
+    MU_RUN_TEST(mf_classic_key_index_test);
+    MU_RUN_TEST(mf_classic_dict_attack_stage_test);
     MU_RUN_TEST(mf_classic_dict_test);
     MU_RUN_TEST(felica_read);
     MU_RUN_TEST(felica_read_auth);
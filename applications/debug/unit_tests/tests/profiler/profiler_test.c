@@ -0,0 +1,101 @@
+#include <furi.h>
+#include <furi_hal.h>
+
+#include "../test.h" // IWYU pragma: keep
+
+#include <toolbox/profiler.h>
+
+#define PROFILER_TEST_FREQUENCY   (1000)
+#define PROFILER_TEST_DURATION_MS (100)
+#define PROFILER_TEST_DEPTH       (256)
+
+static ProfilerZone test_profiler_zone = {.name = "test_profiler_zone"};
+
+static void test_profiler_zone_busy(uint32_t us) {
+    ProfilerZoneScope scope = profiler_zone_enter(&test_profiler_zone);
+    furi_delay_us(us);
+    profiler_zone_leave(&scope);
+}
+
+static void test_profiler_zone_macro(void) {
+    PROFILER_ZONE("test_profiler_zone_macro");
+    furi_delay_us(10);
+}
+
+MU_TEST(test_profiler_zones) {
+    // Disabled zones collect nothing
+    profiler_zones_set_enabled(false);
+    test_profiler_zone_busy(10);
+    mu_assert_int_eq(0, test_profiler_zone.count);
+
+    profiler_zones_set_enabled(true);
+    test_profiler_zone_busy(100);
+    test_profiler_zone_busy(200);
+    test_profiler_zone_busy(300);
+    test_profiler_zone_macro();
+    profiler_zones_set_enabled(false);
+
+    const uint32_t cycles_per_us = furi_hal_cortex_instructions_per_microsecond();
+    mu_assert_int_eq(3, test_profiler_zone.count);
+    mu_assert(test_profiler_zone.cycles_min >= 100 * cycles_per_us, "min is too low");
+    mu_assert(test_profiler_zone.cycles_min < 200 * cycles_per_us, "min is too high");
+    mu_assert(test_profiler_zone.cycles_max >= 300 * cycles_per_us, "max is too low");
+    mu_assert(test_profiler_zone.cycles_total >= 600 * cycles_per_us, "total is too low");
+
+    profiler_zones_dump();
+
+    profiler_zones_reset();
+    mu_assert_int_eq(0, test_profiler_zone.count);
+    mu_assert_int_eq(0, test_profiler_zone.cycles_max);
+}
+
+MU_TEST(test_profiler_sampler) {
+    ProfilerSampler* sampler = profiler_sampler_alloc(PROFILER_TEST_DEPTH);
+    ProfilerSample* samples = malloc(sizeof(ProfilerSample) * PROFILER_TEST_DEPTH);
+
+    mu_assert(profiler_sampler_start(sampler, PROFILER_TEST_FREQUENCY), "sampler start failed");
+    // Second sampler can not get the timer
+    ProfilerSampler* sampler_busy = profiler_sampler_alloc(PROFILER_TEST_DEPTH);
+    mu_assert(!profiler_sampler_start(sampler_busy, PROFILER_TEST_FREQUENCY), "timer is shared");
+    profiler_sampler_free(sampler_busy);
+
+    // Busy loop, so samples land in this thread
+    const uint32_t start = furi_get_tick();
+    while(furi_get_tick() - start < PROFILER_TEST_DURATION_MS) {
+    }
+
+    profiler_sampler_stop(sampler);
+
+    const uint32_t count = profiler_sampler_read(sampler, samples, PROFILER_TEST_DEPTH);
+    const FuriThreadId thread = furi_thread_get_current_id();
+
+    uint32_t own = 0;
+    for(size_t i = 0; i < count; i++) {
+        if(samples[i].thread == thread) {
+            mu_assert(samples[i].pc, "thread sample without pc");
+            own++;
+        }
+    }
+
+    FURI_LOG_I("TestProfiler", "%lu samples, %lu in test thread", count, own);
+
+    mu_assert_int_eq(0, profiler_sampler_get_dropped(sampler));
+    mu_assert(count >= PROFILER_TEST_DURATION_MS * 9 / 10, "too few samples");
+    mu_assert(own >= count / 2, "test thread is not sampled");
+    mu_assert_int_eq(0, profiler_sampler_read(sampler, samples, PROFILER_TEST_DEPTH));
+
+    free(samples);
+    profiler_sampler_free(sampler);
+}
+
+MU_TEST_SUITE(test_profiler_suite) {
+    MU_RUN_TEST(test_profiler_zones);
+    MU_RUN_TEST(test_profiler_sampler);
+}
+
+int run_minunit_test_profiler(void) {
+    MU_RUN_SUITE(test_profiler_suite);
+    return MU_EXIT_CODE;
+}
+
+TEST_API_DEFINE(run_minunit_test_profiler)
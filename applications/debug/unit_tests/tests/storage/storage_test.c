@@ -1,5 +1,6 @@
 #include "../test.h" // IWYU pragma: keep
 #include <furi.h>
+#include <furi_hal_rtc.h>
 #include <storage/storage.h>
 
 // DO NOT USE THIS IN PRODUCTION CODE
@@ -738,6 +739,53 @@ MU_TEST(test_md5_calc) {
     furi_record_close(RECORD_STORAGE);
 }
 
+MU_TEST(test_storage_common_changes) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    const char* path = UNIT_TESTS_PATH("changes.test");
+    uint32_t changes_before = 0;
+    uint32_t changes_after = 0;
+
+    storage_simply_remove(storage, path);
+    mu_assert_int_eq(FSE_OK, storage_common_changes(storage, path, &changes_before));
+
+    // Two writes within one second: timestamp may stay the same, counter may not
+    mu_check(storage_file_create(storage, path, "1"));
+    mu_assert_int_eq(FSE_OK, storage_common_changes(storage, path, &changes_after));
+    mu_check(changes_after != changes_before);
+
+    changes_before = changes_after;
+    mu_assert_int_eq(FSE_OK, storage_common_remove(storage, path));
+    mu_assert_int_eq(FSE_OK, storage_common_changes(storage, path, &changes_after));
+    mu_check(changes_after != changes_before);
+
+    // Reading does not count as modification
+    changes_before = changes_after;
+    mu_assert_int_eq(FSE_NOT_EXIST, storage_common_stat(storage, path, NULL));
+    mu_assert_int_eq(FSE_OK, storage_common_changes(storage, path, &changes_after));
+    mu_assert_int_eq(changes_before, changes_after);
+
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(test_storage_common_modified) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    const char* path = UNIT_TESTS_PATH("modified.test");
+    uint32_t modified = 0;
+
+    storage_simply_remove(storage, path);
+    mu_assert_int_eq(FSE_NOT_EXIST, storage_common_modified(storage, path, &modified));
+
+    // FAT keeps time with 2 second resolution
+    const uint32_t now = furi_hal_rtc_get_timestamp();
+    mu_check(storage_file_create(storage, path, "1"));
+    mu_assert_int_eq(FSE_OK, storage_common_modified(storage, path, &modified));
+    mu_check(modified + 2 >= now);
+    mu_check(modified <= furi_hal_rtc_get_timestamp());
+
+    mu_assert_int_eq(FSE_OK, storage_common_remove(storage, path));
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(test_data_path) {
     MU_RUN_TEST(test_storage_data_path);
     MU_RUN_TEST(test_storage_data_path_apps);
@@ -745,6 +793,8 @@ MU_TEST_SUITE(test_data_path) {
 
 MU_TEST_SUITE(test_storage_common) {
     MU_RUN_TEST(test_storage_common_migrate);
+    MU_RUN_TEST(test_storage_common_changes);
+    MU_RUN_TEST(test_storage_common_modified);
 }
 
 MU_TEST_SUITE(test_md5_calc_suite) {
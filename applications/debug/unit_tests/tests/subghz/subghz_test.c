@@ -19,6 +19,8 @@
 #define TEST_RANDOM_DIR_NAME    EXT_PATH("unit_tests/subghz/test_random_raw.sub")
 #define TEST_RANDOM_COUNT_PARSE 329
 #define TEST_TIMEOUT            10000
+#define TEST_BENCH_LEVELS       1024
+#define TEST_BENCH_ROUNDS       32
 
 static SubGhzEnvironment* environment_handler;
 static SubGhzReceiver* receiver_handler;
@@ -209,6 +211,77 @@ static bool subghz_encoder_test(const char* path) {
     return subghz_test_decoder_count ? true : false;
 }
 
+static void subghz_test_bench_callback(SubGhzProtocolDecoderBase* decoder_base, void* context) {
+    UNUSED(decoder_base);
+    uint32_t* count = context;
+    (*count)++;
+}
+
+static bool subghz_decoder_benchmark_test(const char* path) {
+    bool result = false;
+    FuriString* protocol_name = furi_string_alloc();
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* fff_data_file = flipper_format_file_alloc(storage);
+    LevelDuration* levels = malloc(sizeof(LevelDuration) * TEST_BENCH_LEVELS);
+
+    do {
+        if(!flipper_format_file_open_existing(fff_data_file, path)) break;
+        if(!flipper_format_read_string(fff_data_file, "Protocol", protocol_name)) break;
+
+        const SubGhzProtocol* protocol = subghz_protocol_registry_get_by_name(
+            &subghz_protocol_registry, furi_string_get_cstr(protocol_name));
+        if(!protocol) break;
+
+        // Render the key into levels first, so only the decoder is measured
+        SubGhzTransmitter* transmitter = subghz_transmitter_alloc_init(
+            environment_handler, furi_string_get_cstr(protocol_name));
+        subghz_transmitter_deserialize(transmitter, fff_data_file);
+        size_t levels_num = 0;
+        while(levels_num < TEST_BENCH_LEVELS) {
+            LevelDuration level_duration = subghz_transmitter_yield(transmitter);
+            if(level_duration_is_reset(level_duration)) break;
+            levels[levels_num++] = level_duration;
+        }
+        subghz_transmitter_free(transmitter);
+        if(levels_num == 0) break;
+
+        uint32_t frames = 0;
+        SubGhzProtocolDecoderBase* decoder = protocol->decoder->alloc(environment_handler);
+        subghz_protocol_decoder_base_set_decoder_callback(
+            decoder, subghz_test_bench_callback, &frames);
+        protocol->decoder->reset(decoder);
+
+        TestBench bench = {0};
+        test_bench_start(&bench);
+        for(size_t round = 0; round < TEST_BENCH_ROUNDS; round++) {
+            for(size_t i = 0; i < levels_num; i++) {
+                protocol->decoder->feed(
+                    decoder,
+                    level_duration_get_level(levels[i]),
+                    level_duration_get_duration(levels[i]));
+            }
+        }
+        test_bench_stop(&bench);
+        protocol->decoder->free(decoder);
+
+        FURI_LOG_I(
+            TAG,
+            "%s: %zu levels, %lu frames, %lu ns per level",
+            furi_string_get_cstr(protocol_name),
+            levels_num,
+            frames,
+            test_bench_get_ns(&bench, levels_num * TEST_BENCH_ROUNDS));
+        result = frames > 0;
+    } while(false);
+
+    free(levels);
+    flipper_format_free(fff_data_file);
+    furi_record_close(RECORD_STORAGE);
+    furi_string_free(protocol_name);
+
+    return result;
+}
+
 MU_TEST(subghz_keystore_test) {
     mu_assert(
         subghz_environment_load_keystore(environment_handler, KEYSTORE_DIR_NAME),
@@ -833,6 +906,21 @@ MU_TEST(subghz_encoder_dickert_test) {
         "Test encoder " SUBGHZ_PROTOCOL_DICKERT_MAHS_NAME " error\r\n");
 }
 
+MU_TEST(subghz_decoder_benchmark) {
+    static const char* const paths[] = {
+        EXT_PATH("unit_tests/subghz/came.sub"),
+        EXT_PATH("unit_tests/subghz/nice_flo.sub"),
+        EXT_PATH("unit_tests/subghz/ansonic.sub"),
+        EXT_PATH("unit_tests/subghz/holtek.sub"),
+        EXT_PATH("unit_tests/subghz/gate_tx.sub"),
+        EXT_PATH("unit_tests/subghz/linear.sub"),
+    };
+
+    for(size_t i = 0; i < COUNT_OF(paths); i++) {
+        mu_assert(subghz_decoder_benchmark_test(paths[i]), "Decoder benchmark error\r\n");
+    }
+}
+
 MU_TEST(subghz_random_test) {
     mu_assert(subghz_decode_random_test(TEST_RANDOM_DIR_NAME), "Random test error\r\n");
 }
@@ -914,6 +1002,8 @@ MU_TEST_SUITE(subghz) {
     MU_RUN_TEST(subghz_encoder_mastercode_test);
     MU_RUN_TEST(subghz_encoder_dickert_test);
 
+    MU_RUN_TEST(subghz_decoder_benchmark);
+
     MU_RUN_TEST(subghz_random_test);
     subghz_test_deinit();
 }
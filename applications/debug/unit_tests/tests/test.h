@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdint.h>
+
 // Framework
 #include "minunit.h"
 
@@ -10,3 +12,16 @@ int get_minunit_run(void);
 int get_minunit_assert(void);
 
 int get_minunit_status(void);
+
+/** CPU cycle counter, accumulates time of code between start and stop */
+typedef struct {
+    uint64_t cycles;
+    uint32_t start;
+} TestBench;
+
+void test_bench_start(TestBench* bench);
+
+void test_bench_stop(TestBench* bench);
+
+/** Get accumulated time divided by count, in nanoseconds */
+uint32_t test_bench_get_ns(const TestBench* bench, uint32_t count);
@@ -13,6 +13,8 @@
 
 #define WORKER_TAG TAG "Worker"
 
+#define STRING_BATCH_LEN 64
+
 #define BADUSB_ASCII_TO_KEY(script, x) \
     (((uint8_t)x < 128) ? (script->layout[(uint8_t)x]) : HID_KEYBOARD_NONE)
 
@@ -136,20 +138,23 @@ int32_t ducky_error(BadUsbScript* bad_usb, const char* text, ...) {
 }
 
 bool ducky_string(BadUsbScript* bad_usb, const char* param) {
+    uint16_t keycodes[STRING_BATCH_LEN];
+    size_t keycodes_len = 0;
     uint32_t i = 0;
 
+    // Whole string goes out as batches of back-to-back reports
     while(param[i] != '\0') {
         if(param[i] != '\n') {
-            uint16_t keycode = BADUSB_ASCII_TO_KEY(bad_usb, param[i]);
-            if(keycode != HID_KEYBOARD_NONE) {
-                bad_usb->hid->kb_press(bad_usb->hid_inst, keycode);
-                bad_usb->hid->kb_release(bad_usb->hid_inst, keycode);
-            }
+            keycodes[keycodes_len++] = BADUSB_ASCII_TO_KEY(bad_usb, param[i]);
         } else {
-            bad_usb->hid->kb_press(bad_usb->hid_inst, HID_KEYBOARD_RETURN);
-            bad_usb->hid->kb_release(bad_usb->hid_inst, HID_KEYBOARD_RETURN);
+            keycodes[keycodes_len++] = HID_KEYBOARD_RETURN;
         }
         i++;
+
+        if((keycodes_len == COUNT_OF(keycodes)) || (param[i] == '\0')) {
+            bad_usb->hid->kb_type(bad_usb->hid_inst, keycodes, keycodes_len);
+            keycodes_len = 0;
+        }
     }
     bad_usb->stringdelay = 0;
     return true;
@@ -656,6 +661,7 @@ static void bad_usb_script_set_default_keyboard_layout(BadUsbScript* bad_usb) {
 
 BadUsbScript* bad_usb_script_open(FuriString* file_path, BadUsbHidInterface interface) {
     furi_assert(file_path);
+    ducky_check_key_tables();
 
     BadUsbScript* bad_usb = malloc(sizeof(BadUsbScript));
     bad_usb->file_path = furi_string_alloc();
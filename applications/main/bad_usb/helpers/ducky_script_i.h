@@ -16,7 +16,7 @@ extern "C" {
 #define SCRIPT_STATE_STRING_START (-5)
 #define SCRIPT_STATE_WAIT_FOR_BTN (-6)
 
-#define FILE_BUFFER_LEN 16
+#define FILE_BUFFER_LEN 128
 
 struct BadUsbScript {
     FuriHalUsbHidConfig hid_cfg;
@@ -51,6 +51,8 @@ uint32_t ducky_get_command_len(const char* line);
 
 bool ducky_is_line_end(const char chr);
 
+void ducky_check_key_tables(void);
+
 uint16_t ducky_get_keycode_by_name(const char* param);
 
 uint16_t ducky_get_media_keycode_by_name(const char* param);
@@ -6,60 +6,28 @@ typedef struct {
     uint16_t keycode;
 } DuckyKey;
 
+// Key tables must stay sorted by name in strcmp() order, lookups are binary searches.
+// Debug builds verify that in ducky_check_key_tables().
 static const DuckyKey ducky_keys[] = {
-    {"CTRL-ALT", KEY_MOD_LEFT_CTRL | KEY_MOD_LEFT_ALT},
-    {"CTRL-SHIFT", KEY_MOD_LEFT_CTRL | KEY_MOD_LEFT_SHIFT},
-    {"ALT-SHIFT", KEY_MOD_LEFT_ALT | KEY_MOD_LEFT_SHIFT},
-    {"ALT-GUI", KEY_MOD_LEFT_ALT | KEY_MOD_LEFT_GUI},
-    {"GUI-SHIFT", KEY_MOD_LEFT_GUI | KEY_MOD_LEFT_SHIFT},
-    {"GUI-CTRL", KEY_MOD_LEFT_GUI | KEY_MOD_LEFT_CTRL},
-
-    {"CTRL", KEY_MOD_LEFT_CTRL},
-    {"CONTROL", KEY_MOD_LEFT_CTRL},
-    {"SHIFT", KEY_MOD_LEFT_SHIFT},
     {"ALT", KEY_MOD_LEFT_ALT},
-    {"GUI", KEY_MOD_LEFT_GUI},
-    {"WINDOWS", KEY_MOD_LEFT_GUI},
-
-    {"DOWNARROW", HID_KEYBOARD_DOWN_ARROW},
-    {"DOWN", HID_KEYBOARD_DOWN_ARROW},
-    {"LEFTARROW", HID_KEYBOARD_LEFT_ARROW},
-    {"LEFT", HID_KEYBOARD_LEFT_ARROW},
-    {"RIGHTARROW", HID_KEYBOARD_RIGHT_ARROW},
-    {"RIGHT", HID_KEYBOARD_RIGHT_ARROW},
-    {"UPARROW", HID_KEYBOARD_UP_ARROW},
-    {"UP", HID_KEYBOARD_UP_ARROW},
-
-    {"ENTER", HID_KEYBOARD_RETURN},
+    {"ALT-GUI", KEY_MOD_LEFT_ALT | KEY_MOD_LEFT_GUI},
+    {"ALT-SHIFT", KEY_MOD_LEFT_ALT | KEY_MOD_LEFT_SHIFT},
+    {"APP", HID_KEYBOARD_APPLICATION},
+    {"BACKSPACE", HID_KEYBOARD_DELETE},
     {"BREAK", HID_KEYBOARD_PAUSE},
-    {"PAUSE", HID_KEYBOARD_PAUSE},
     {"CAPSLOCK", HID_KEYBOARD_CAPS_LOCK},
+    {"CONTROL", KEY_MOD_LEFT_CTRL},
+    {"CTRL", KEY_MOD_LEFT_CTRL},
+    {"CTRL-ALT", KEY_MOD_LEFT_CTRL | KEY_MOD_LEFT_ALT},
+    {"CTRL-SHIFT", KEY_MOD_LEFT_CTRL | KEY_MOD_LEFT_SHIFT},
     {"DELETE", HID_KEYBOARD_DELETE_FORWARD},
-    {"BACKSPACE", HID_KEYBOARD_DELETE},
+    {"DOWN", HID_KEYBOARD_DOWN_ARROW},
+    {"DOWNARROW", HID_KEYBOARD_DOWN_ARROW},
     {"END", HID_KEYBOARD_END},
+    {"ENTER", HID_KEYBOARD_RETURN},
     {"ESC", HID_KEYBOARD_ESCAPE},
     {"ESCAPE", HID_KEYBOARD_ESCAPE},
-    {"HOME", HID_KEYBOARD_HOME},
-    {"INSERT", HID_KEYBOARD_INSERT},
-    {"NUMLOCK", HID_KEYPAD_NUMLOCK},
-    {"PAGEUP", HID_KEYBOARD_PAGE_UP},
-    {"PAGEDOWN", HID_KEYBOARD_PAGE_DOWN},
-    {"PRINTSCREEN", HID_KEYBOARD_PRINT_SCREEN},
-    {"SCROLLLOCK", HID_KEYBOARD_SCROLL_LOCK},
-    {"SPACE", HID_KEYBOARD_SPACEBAR},
-    {"TAB", HID_KEYBOARD_TAB},
-    {"MENU", HID_KEYBOARD_APPLICATION},
-    {"APP", HID_KEYBOARD_APPLICATION},
-
     {"F1", HID_KEYBOARD_F1},
-    {"F2", HID_KEYBOARD_F2},
-    {"F3", HID_KEYBOARD_F3},
-    {"F4", HID_KEYBOARD_F4},
-    {"F5", HID_KEYBOARD_F5},
-    {"F6", HID_KEYBOARD_F6},
-    {"F7", HID_KEYBOARD_F7},
-    {"F8", HID_KEYBOARD_F8},
-    {"F9", HID_KEYBOARD_F9},
     {"F10", HID_KEYBOARD_F10},
     {"F11", HID_KEYBOARD_F11},
     {"F12", HID_KEYBOARD_F12},
@@ -70,64 +38,114 @@ static const DuckyKey ducky_keys[] = {
     {"F17", HID_KEYBOARD_F17},
     {"F18", HID_KEYBOARD_F18},
     {"F19", HID_KEYBOARD_F19},
+    {"F2", HID_KEYBOARD_F2},
     {"F20", HID_KEYBOARD_F20},
     {"F21", HID_KEYBOARD_F21},
     {"F22", HID_KEYBOARD_F22},
     {"F23", HID_KEYBOARD_F23},
     {"F24", HID_KEYBOARD_F24},
+    {"F3", HID_KEYBOARD_F3},
+    {"F4", HID_KEYBOARD_F4},
+    {"F5", HID_KEYBOARD_F5},
+    {"F6", HID_KEYBOARD_F6},
+    {"F7", HID_KEYBOARD_F7},
+    {"F8", HID_KEYBOARD_F8},
+    {"F9", HID_KEYBOARD_F9},
+    {"GUI", KEY_MOD_LEFT_GUI},
+    {"GUI-CTRL", KEY_MOD_LEFT_GUI | KEY_MOD_LEFT_CTRL},
+    {"GUI-SHIFT", KEY_MOD_LEFT_GUI | KEY_MOD_LEFT_SHIFT},
+    {"HOME", HID_KEYBOARD_HOME},
+    {"INSERT", HID_KEYBOARD_INSERT},
+    {"LEFT", HID_KEYBOARD_LEFT_ARROW},
+    {"LEFTARROW", HID_KEYBOARD_LEFT_ARROW},
+    {"MENU", HID_KEYBOARD_APPLICATION},
+    {"NUMLOCK", HID_KEYPAD_NUMLOCK},
+    {"PAGEDOWN", HID_KEYBOARD_PAGE_DOWN},
+    {"PAGEUP", HID_KEYBOARD_PAGE_UP},
+    {"PAUSE", HID_KEYBOARD_PAUSE},
+    {"PRINTSCREEN", HID_KEYBOARD_PRINT_SCREEN},
+    {"RIGHT", HID_KEYBOARD_RIGHT_ARROW},
+    {"RIGHTARROW", HID_KEYBOARD_RIGHT_ARROW},
+    {"SCROLLLOCK", HID_KEYBOARD_SCROLL_LOCK},
+    {"SHIFT", KEY_MOD_LEFT_SHIFT},
+    {"SPACE", HID_KEYBOARD_SPACEBAR},
+    {"TAB", HID_KEYBOARD_TAB},
+    {"UP", HID_KEYBOARD_UP_ARROW},
+    {"UPARROW", HID_KEYBOARD_UP_ARROW},
+    {"WINDOWS", KEY_MOD_LEFT_GUI},
 };
 
 static const DuckyKey ducky_media_keys[] = {
-    {"POWER", HID_CONSUMER_POWER},
-    {"REBOOT", HID_CONSUMER_RESET},
-    {"SLEEP", HID_CONSUMER_SLEEP},
-    {"LOGOFF", HID_CONSUMER_AL_LOGOFF},
-
-    {"EXIT", HID_CONSUMER_AC_EXIT},
-    {"HOME", HID_CONSUMER_AC_HOME},
     {"BACK", HID_CONSUMER_AC_BACK},
+    {"BRIGHT_DOWN", HID_CONSUMER_BRIGHTNESS_DECREMENT},
+    {"BRIGHT_UP", HID_CONSUMER_BRIGHTNESS_INCREMENT},
+    {"EJECT", HID_CONSUMER_EJECT},
+    {"EXIT", HID_CONSUMER_AC_EXIT},
+    {"FN", HID_CONSUMER_FN_GLOBE},
     {"FORWARD", HID_CONSUMER_AC_FORWARD},
-    {"REFRESH", HID_CONSUMER_AC_REFRESH},
-
-    {"SNAPSHOT", HID_CONSUMER_SNAPSHOT},
-
-    {"PLAY", HID_CONSUMER_PLAY},
+    {"HOME", HID_CONSUMER_AC_HOME},
+    {"LOGOFF", HID_CONSUMER_AL_LOGOFF},
+    {"MUTE", HID_CONSUMER_MUTE},
+    {"NEXT_TRACK", HID_CONSUMER_SCAN_NEXT_TRACK},
     {"PAUSE", HID_CONSUMER_PAUSE},
+    {"PLAY", HID_CONSUMER_PLAY},
     {"PLAY_PAUSE", HID_CONSUMER_PLAY_PAUSE},
-    {"NEXT_TRACK", HID_CONSUMER_SCAN_NEXT_TRACK},
+    {"POWER", HID_CONSUMER_POWER},
     {"PREV_TRACK", HID_CONSUMER_SCAN_PREVIOUS_TRACK},
+    {"REBOOT", HID_CONSUMER_RESET},
+    {"REFRESH", HID_CONSUMER_AC_REFRESH},
+    {"SLEEP", HID_CONSUMER_SLEEP},
+    {"SNAPSHOT", HID_CONSUMER_SNAPSHOT},
     {"STOP", HID_CONSUMER_STOP},
-    {"EJECT", HID_CONSUMER_EJECT},
-
-    {"MUTE", HID_CONSUMER_MUTE},
-    {"VOLUME_UP", HID_CONSUMER_VOLUME_INCREMENT},
     {"VOLUME_DOWN", HID_CONSUMER_VOLUME_DECREMENT},
-
-    {"FN", HID_CONSUMER_FN_GLOBE},
-    {"BRIGHT_UP", HID_CONSUMER_BRIGHTNESS_INCREMENT},
-    {"BRIGHT_DOWN", HID_CONSUMER_BRIGHTNESS_DECREMENT},
+    {"VOLUME_UP", HID_CONSUMER_VOLUME_INCREMENT},
 };
 
-uint16_t ducky_get_keycode_by_name(const char* param) {
-    for(size_t i = 0; i < COUNT_OF(ducky_keys); i++) {
-        size_t key_cmd_len = strlen(ducky_keys[i].name);
-        if((strncmp(param, ducky_keys[i].name, key_cmd_len) == 0) &&
-           (ducky_is_line_end(param[key_cmd_len]))) {
-            return ducky_keys[i].keycode;
+static const DuckyKey*
+    ducky_find_key(const DuckyKey* keys, size_t keys_count, const char* param) {
+    size_t param_len = 0;
+    while(!ducky_is_line_end(param[param_len])) {
+        param_len++;
+    }
+
+    size_t low = 0;
+    size_t high = keys_count;
+    while(low < high) {
+        size_t mid = low + (high - low) / 2;
+        int res = strncmp(keys[mid].name, param, param_len);
+        if(res == 0 && keys[mid].name[param_len] != '\0') {
+            res = 1; // Same prefix, but table entry is longer
+        }
+
+        if(res == 0) {
+            return &keys[mid];
+        } else if(res < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
         }
     }
 
-    return HID_KEYBOARD_NONE;
+    return NULL;
 }
 
-uint16_t ducky_get_media_keycode_by_name(const char* param) {
-    for(size_t i = 0; i < COUNT_OF(ducky_media_keys); i++) {
-        size_t key_cmd_len = strlen(ducky_media_keys[i].name);
-        if((strncmp(param, ducky_media_keys[i].name, key_cmd_len) == 0) &&
-           (ducky_is_line_end(param[key_cmd_len]))) {
-            return ducky_media_keys[i].keycode;
-        }
+static void ducky_check_key_table(const DuckyKey* keys, size_t keys_count) {
+    for(size_t i = 1; i < keys_count; i++) {
+        furi_assert(strcmp(keys[i - 1].name, keys[i].name) < 0, "Key table is not sorted");
     }
+}
+
+void ducky_check_key_tables(void) {
+    ducky_check_key_table(ducky_keys, COUNT_OF(ducky_keys));
+    ducky_check_key_table(ducky_media_keys, COUNT_OF(ducky_media_keys));
+}
 
-    return HID_CONSUMER_UNASSIGNED;
+uint16_t ducky_get_keycode_by_name(const char* param) {
+    const DuckyKey* key = ducky_find_key(ducky_keys, COUNT_OF(ducky_keys), param);
+    return key ? key->keycode : HID_KEYBOARD_NONE;
+}
+
+uint16_t ducky_get_media_keycode_by_name(const char* param) {
+    const DuckyKey* key = ducky_find_key(ducky_media_keys, COUNT_OF(ducky_media_keys), param);
+    return key ? key->keycode : HID_CONSUMER_UNASSIGNED;
 }
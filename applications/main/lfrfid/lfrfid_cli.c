@@ -17,6 +17,8 @@
 static void lfrfid_cli_print_usage(void) {
     printf("Usage:\r\n");
     printf("rfid read <optional: normal | indala>         - read in ASK/PSK mode\r\n");
+    printf(
+        "rfid read all                                 - EXPERIMENTAL one pass ASK+PSK read\r\n");
     printf("rfid <write | emulate> <key_type> <key_data>  - write or emulate a card\r\n");
     printf("rfid raw_read <ask | psk> <filename>          - read and save raw data to a file\r\n");
     printf(
@@ -55,6 +57,10 @@ static void lfrfid_cli_read(Cli* cli, FuriString* args) {
             furi_string_cmp_str(type_string, "psk") == 0) {
             // psk
             type = LFRFIDWorkerReadTypePSKOnly;
+        } else if(furi_string_cmp_str(type_string, "all") == 0) {
+            // ask and psk in one pass, not verified on hardware
+            printf("EXPERIMENTAL: ASK tags are read on PSK carrier, use normal if unsure\r\n");
+            type = LFRFIDWorkerReadTypeExperimentalParallel;
         } else {
             lfrfid_cli_print_usage();
             furi_string_free(type_string);
@@ -11,8 +11,6 @@ static const uint32_t mf_classic_key_cache_file_version = 1;
 
 struct MfClassicKeyCache {
     MfClassicDeviceKeys keys;
-    MfClassicKeyType current_key_type;
-    uint8_t current_sector;
 };
 
 static void nfc_get_key_cache_file_path(const uint8_t* uid, size_t uid_len, FuriString* path) {
@@ -166,47 +164,15 @@ void mf_classic_key_cache_load_from_data(MfClassicKeyCache* instance, const MfCl
     }
 }
 
-bool mf_classic_key_cahce_get_next_key(
-    MfClassicKeyCache* instance,
-    uint8_t* sector_num,
-    MfClassicKey* key,
-    MfClassicKeyType* key_type) {
+const MfClassicDeviceKeys* mf_classic_key_cache_get_keys(const MfClassicKeyCache* instance) {
     furi_assert(instance);
-    furi_assert(sector_num);
-    furi_assert(key);
-    furi_assert(key_type);
-
-    bool next_key_found = false;
-    for(uint8_t i = instance->current_sector; i < MF_CLASSIC_TOTAL_SECTORS_MAX; i++) {
-        if(FURI_BIT(instance->keys.key_a_mask, i)) {
-            FURI_BIT_CLEAR(instance->keys.key_a_mask, i);
-            *key = instance->keys.key_a[i];
-            *key_type = MfClassicKeyTypeA;
-            *sector_num = i;
-
-            next_key_found = true;
-            break;
-        }
-        if(FURI_BIT(instance->keys.key_b_mask, i)) {
-            FURI_BIT_CLEAR(instance->keys.key_b_mask, i);
-            *key = instance->keys.key_b[i];
-            *key_type = MfClassicKeyTypeB;
-            *sector_num = i;
-
-            next_key_found = true;
-            instance->current_sector = i;
-            break;
-        }
-    }
 
-    return next_key_found;
+    return &instance->keys;
 }
 
 void mf_classic_key_cache_reset(MfClassicKeyCache* instance) {
     furi_assert(instance);
 
-    instance->current_key_type = MfClassicKeyTypeA;
-    instance->current_sector = 0;
     instance->keys.key_a_mask = 0;
     instance->keys.key_b_mask = 0;
 }
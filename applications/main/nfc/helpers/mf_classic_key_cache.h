@@ -16,11 +16,7 @@ bool mf_classic_key_cache_load(MfClassicKeyCache* instance, const uint8_t* uid,
 
 void mf_classic_key_cache_load_from_data(MfClassicKeyCache* instance, const MfClassicData* data);
 
-bool mf_classic_key_cahce_get_next_key(
-    MfClassicKeyCache* instance,
-    uint8_t* sector_num,
-    MfClassicKey* key,
-    MfClassicKeyType* key_type);
+const MfClassicDeviceKeys* mf_classic_key_cache_get_keys(const MfClassicKeyCache* instance);
 
 bool mf_classic_key_cache_save(MfClassicKeyCache* instance, const MfClassicData* data);
 
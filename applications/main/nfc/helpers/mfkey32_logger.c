@@ -1,12 +1,25 @@
 #include "mfkey32_logger.h"
 
+#include <furi.h>
 #include <m-array.h>
 
 #include <bit_lib/bit_lib.h>
 #include <stream/stream.h>
 #include <stream/buffered_file_stream.h>
 
+#define TAG "Mfkey32Logger"
+
 #define MFKEY32_LOGGER_MAX_NONCES_SAVED (100)
+#define MFKEY32_LOGGER_QUEUE_SIZE       (32)
+#define MFKEY32_LOGGER_DEDUP_SIZE       (8)
+
+typedef struct {
+    uint8_t sector_num;
+    MfClassicKeyType key_type;
+    uint32_t nt;
+    uint32_t nr;
+    uint32_t ar;
+} Mfkey32LoggerNonce;
 
 typedef struct {
     bool is_filled;
@@ -21,6 +34,14 @@ typedef struct {
     uint32_t ar1;
 } Mfkey32LoggerParams;
 
+// Each counter is only updated by one side of the nonce queue
+typedef struct {
+    uint32_t nonces_captured;
+    uint32_t nonces_duplicate;
+    uint32_t nonces_queue_full;
+    uint32_t nonces_log_full;
+} Mfkey32LoggerStats;
+
 ARRAY_DEF(Mfkey32LoggerParams, Mfkey32LoggerParams, M_POD_OPLIST);
 
 struct Mfkey32Logger {
@@ -28,12 +49,22 @@ struct Mfkey32Logger {
     Mfkey32LoggerParams_t params_arr;
     size_t nonces_saves;
     size_t params_collected;
+
+    // Listener side: nonces are queued as is, pairing is done by the reader of the queue
+    FuriMessageQueue* nonce_queue;
+    Mfkey32LoggerNonce recent[MFKEY32_LOGGER_DEDUP_SIZE];
+    size_t recent_num;
+    size_t recent_pos;
+    Mfkey32LoggerStats stats;
 };
 
 Mfkey32Logger* mfkey32_logger_alloc(uint32_t cuid) {
     Mfkey32Logger* instance = malloc(sizeof(Mfkey32Logger));
     instance->cuid = cuid;
     Mfkey32LoggerParams_init(instance->params_arr);
+    Mfkey32LoggerParams_reserve(instance->params_arr, MFKEY32_LOGGER_MAX_NONCES_SAVED);
+    instance->nonce_queue =
+        furi_message_queue_alloc(MFKEY32_LOGGER_QUEUE_SIZE, sizeof(Mfkey32LoggerNonce));
 
     return instance;
 }
@@ -42,13 +73,22 @@ void mfkey32_logger_free(Mfkey32Logger* instance) {
     furi_assert(instance);
     furi_assert(instance->params_arr);
 
+    FURI_LOG_I(
+        TAG,
+        "Nonces captured %lu, duplicate %lu, dropped %lu (queue full %lu)",
+        instance->stats.nonces_captured,
+        instance->stats.nonces_duplicate,
+        instance->stats.nonces_queue_full + instance->stats.nonces_log_full,
+        instance->stats.nonces_queue_full);
+
+    furi_message_queue_free(instance->nonce_queue);
     Mfkey32LoggerParams_clear(instance->params_arr);
     free(instance);
 }
 
 static bool mfkey32_logger_add_nonce_to_existing_params(
     Mfkey32Logger* instance,
-    MfClassicAuthContext* auth_context) {
+    const Mfkey32LoggerNonce* nonce) {
     bool nonce_added = false;
     do {
         if(Mfkey32LoggerParams_size(instance->params_arr) == 0) break;
@@ -59,13 +99,12 @@ static bool mfkey32_logger_add_nonce_to_existing_params(
             Mfkey32LoggerParams* params = Mfkey32LoggerParams_ref(it);
             if(params->is_filled) continue;
 
-            uint8_t sector_num = mf_classic_get_sector_by_block(auth_context->block_num);
-            if(params->sector_num != sector_num) continue;
-            if(params->key_type != auth_context->key_type) continue;
+            if(params->sector_num != nonce->sector_num) continue;
+            if(params->key_type != nonce->key_type) continue;
 
-            params->nt1 = bit_lib_bytes_to_num_be(auth_context->nt.data, sizeof(MfClassicNt));
-            params->nr1 = bit_lib_bytes_to_num_be(auth_context->nr.data, sizeof(MfClassicNr));
-            params->ar1 = bit_lib_bytes_to_num_be(auth_context->ar.data, sizeof(MfClassicAr));
+            params->nt1 = nonce->nt;
+            params->nr1 = nonce->nr;
+            params->ar1 = nonce->ar;
             params->is_filled = true;
 
             instance->params_collected++;
@@ -78,71 +117,102 @@ static bool mfkey32_logger_add_nonce_to_existing_params(
     return nonce_added;
 }
 
+static void mfkey32_logger_process_nonces(Mfkey32Logger* instance) {
+    Mfkey32LoggerNonce nonce;
+    while(furi_message_queue_get(instance->nonce_queue, &nonce, 0) == FuriStatusOk) {
+        bool nonce_added = mfkey32_logger_add_nonce_to_existing_params(instance, &nonce);
+        if(!nonce_added && (instance->nonces_saves < MFKEY32_LOGGER_MAX_NONCES_SAVED)) {
+            Mfkey32LoggerParams params = {
+                .is_filled = false,
+                .cuid = instance->cuid,
+                .sector_num = nonce.sector_num,
+                .key_type = nonce.key_type,
+                .nt0 = nonce.nt,
+                .nr0 = nonce.nr,
+                .ar0 = nonce.ar,
+            };
+            Mfkey32LoggerParams_push_back(instance->params_arr, params);
+            instance->nonces_saves++;
+        } else if(!nonce_added) {
+            instance->stats.nonces_log_full++;
+        }
+    }
+}
+
 void mfkey32_logger_add_nonce(Mfkey32Logger* instance, MfClassicAuthContext* auth_context) {
     furi_assert(instance);
     furi_assert(auth_context);
 
-    bool nonce_added = mfkey32_logger_add_nonce_to_existing_params(instance, auth_context);
-    if(!nonce_added && (instance->nonces_saves < MFKEY32_LOGGER_MAX_NONCES_SAVED)) {
-        uint8_t sector_num = mf_classic_get_sector_by_block(auth_context->block_num);
-        Mfkey32LoggerParams params = {
-            .is_filled = false,
-            .cuid = instance->cuid,
-            .sector_num = sector_num,
-            .key_type = auth_context->key_type,
-            .nt0 = bit_lib_bytes_to_num_be(auth_context->nt.data, sizeof(MfClassicNt)),
-            .nr0 = bit_lib_bytes_to_num_be(auth_context->nr.data, sizeof(MfClassicNr)),
-            .ar0 = bit_lib_bytes_to_num_be(auth_context->ar.data, sizeof(MfClassicAr)),
-        };
-        Mfkey32LoggerParams_push_back(instance->params_arr, params);
-        instance->nonces_saves++;
+    const Mfkey32LoggerNonce nonce = {
+        .sector_num = mf_classic_get_sector_by_block(auth_context->block_num),
+        .key_type = auth_context->key_type,
+        .nt = bit_lib_bytes_to_num_be(auth_context->nt.data, sizeof(MfClassicNt)),
+        .nr = bit_lib_bytes_to_num_be(auth_context->nr.data, sizeof(MfClassicNr)),
+        .ar = bit_lib_bytes_to_num_be(auth_context->ar.data, sizeof(MfClassicAr)),
+    };
+    instance->stats.nonces_captured++;
+
+    // Readers repeat the same failed auth, identical nonces give mfkey32 nothing
+    for(size_t i = 0; i < instance->recent_num; i++) {
+        const Mfkey32LoggerNonce* recent = &instance->recent[i];
+        if(recent->nt == nonce.nt && recent->nr == nonce.nr && recent->ar == nonce.ar) {
+            instance->stats.nonces_duplicate++;
+            return;
+        }
+    }
+    instance->recent[instance->recent_pos] = nonce;
+    instance->recent_pos = (instance->recent_pos + 1) % MFKEY32_LOGGER_DEDUP_SIZE;
+    if(instance->recent_num < MFKEY32_LOGGER_DEDUP_SIZE) instance->recent_num++;
+
+    if(furi_message_queue_put(instance->nonce_queue, &nonce, 0) != FuriStatusOk) {
+        instance->stats.nonces_queue_full++;
     }
 }
 
 size_t mfkey32_logger_get_params_num(Mfkey32Logger* instance) {
     furi_assert(instance);
 
+    mfkey32_logger_process_nonces(instance);
+
     return instance->params_collected;
 }
 
 bool mfkey32_logger_save_params(Mfkey32Logger* instance, const char* path) {
     furi_assert(instance);
     furi_assert(path);
-    furi_assert(instance->params_collected > 0);
     furi_assert(instance->params_arr);
 
+    mfkey32_logger_process_nonces(instance);
+    furi_assert(instance->params_collected > 0);
+
+    // Whole log is converted to text first and written in one go
+    FuriString* temp_str = furi_string_alloc();
+    Mfkey32LoggerParams_it_t it;
+    for(Mfkey32LoggerParams_it(it, instance->params_arr); !Mfkey32LoggerParams_end_p(it);
+        Mfkey32LoggerParams_next(it)) {
+        Mfkey32LoggerParams* params = Mfkey32LoggerParams_ref(it);
+        if(!params->is_filled) continue;
+        furi_string_cat_printf(
+            temp_str,
+            "Sec %d key %c cuid %08lx nt0 %08lx nr0 %08lx ar0 %08lx nt1 %08lx nr1 %08lx ar1 %08lx\n",
+            params->sector_num,
+            params->key_type == MfClassicKeyTypeA ? 'A' : 'B',
+            params->cuid,
+            params->nt0,
+            params->nr0,
+            params->ar0,
+            params->nt1,
+            params->nr1,
+            params->ar1);
+    }
+
     bool params_saved = false;
     Storage* storage = furi_record_open(RECORD_STORAGE);
     Stream* stream = buffered_file_stream_alloc(storage);
-    FuriString* temp_str = furi_string_alloc();
 
     do {
         if(!buffered_file_stream_open(stream, path, FSAM_WRITE, FSOM_OPEN_APPEND)) break;
-
-        bool params_write_success = true;
-        Mfkey32LoggerParams_it_t it;
-        for(Mfkey32LoggerParams_it(it, instance->params_arr); !Mfkey32LoggerParams_end_p(it);
-            Mfkey32LoggerParams_next(it)) {
-            Mfkey32LoggerParams* params = Mfkey32LoggerParams_ref(it);
-            if(!params->is_filled) continue;
-            furi_string_printf(
-                temp_str,
-                "Sec %d key %c cuid %08lx nt0 %08lx nr0 %08lx ar0 %08lx nt1 %08lx nr1 %08lx ar1 %08lx\n",
-                params->sector_num,
-                params->key_type == MfClassicKeyTypeA ? 'A' : 'B',
-                params->cuid,
-                params->nt0,
-                params->nr0,
-                params->ar0,
-                params->nt1,
-                params->nr1,
-                params->ar1);
-            if(!stream_write_string(stream, temp_str)) {
-                params_write_success = false;
-                break;
-            }
-        }
-        if(!params_write_success) break;
+        if(stream_write_string(stream, temp_str) != furi_string_size(temp_str)) break;
 
         params_saved = true;
     } while(false);
@@ -158,6 +228,8 @@ bool mfkey32_logger_save_params(Mfkey32Logger* instance, const char* path) {
 void mfkey32_logger_get_params_data(Mfkey32Logger* instance, FuriString* str) {
     furi_assert(instance);
     furi_assert(str);
+
+    mfkey32_logger_process_nonces(instance);
     furi_assert(instance->params_collected > 0);
 
     furi_string_reset(str);
@@ -1,18 +1,27 @@
 #include "nfc_emv_parser.h"
 #include <flipper_format/flipper_format.h>
+#include <toolbox/key_index.h>
+
+#define NFC_EMV_PARSER_ASSETS_PATH EXT_PATH("nfc/assets")
 
 static const char* nfc_resources_header = "Flipper EMV resources";
 static const uint32_t nfc_resources_file_version = 1;
 
-static bool nfc_emv_parser_search_data(
+static bool nfc_emv_parser_search_text(
     Storage* storage,
     const char* file_name,
-    FuriString* key,
+    const uint8_t* key,
+    size_t key_size,
     FuriString* data) {
     bool parsed = false;
     FlipperFormat* file = flipper_format_file_alloc(storage);
     FuriString* temp_str;
     temp_str = furi_string_alloc();
+    FuriString* key_str;
+    key_str = furi_string_alloc();
+    for(size_t i = 0; i < key_size; i++) {
+        furi_string_cat_printf(key_str, "%02X", key[i]);
+    }
 
     do {
         // Open file
@@ -23,60 +32,69 @@ static bool nfc_emv_parser_search_data(
         if(furi_string_cmp_str(temp_str, nfc_resources_header) ||
            (version != nfc_resources_file_version))
             break;
-        if(!flipper_format_read_string(file, furi_string_get_cstr(key), data)) break;
+        if(!flipper_format_read_string(file, furi_string_get_cstr(key_str), data)) break;
         parsed = true;
     } while(false);
 
+    furi_string_free(key_str);
     furi_string_free(temp_str);
     flipper_format_free(file);
     return parsed;
 }
 
+static bool nfc_emv_parser_search_data(
+    Storage* storage,
+    const char* name,
+    const uint8_t* key,
+    size_t key_size,
+    FuriString* data) {
+    FuriString* path = furi_string_alloc_printf("%s/%s.idx", NFC_EMV_PARSER_ASSETS_PATH, name);
+    FuriString* source_path =
+        furi_string_alloc_printf("%s/%s.nfc", NFC_EMV_PARSER_ASSETS_PATH, name);
+
+    // Binary search in index, rebuilt when asset is changed after it was compiled
+    KeyIndexStatus status = key_index_find(
+        storage,
+        furi_string_get_cstr(path),
+        furi_string_get_cstr(source_path),
+        key,
+        key_size,
+        data);
+
+    // Index can't be read or rebuilt: scan the text file
+    if(status == KeyIndexStatusError) {
+        if(nfc_emv_parser_search_text(
+               storage, furi_string_get_cstr(source_path), key, key_size, data)) {
+            status = KeyIndexStatusOk;
+        }
+    }
+
+    furi_string_free(source_path);
+    furi_string_free(path);
+    return status == KeyIndexStatusOk;
+}
+
 bool nfc_emv_parser_get_aid_name(
     Storage* storage,
     const uint8_t* aid,
     uint8_t aid_len,
     FuriString* aid_name) {
     furi_assert(storage);
-    bool parsed = false;
-    FuriString* key;
-    key = furi_string_alloc();
-    for(uint8_t i = 0; i < aid_len; i++) {
-        furi_string_cat_printf(key, "%02X", aid[i]);
-    }
-    if(nfc_emv_parser_search_data(storage, EXT_PATH("nfc/assets/aid.nfc"), key, aid_name)) {
-        parsed = true;
-    }
-    furi_string_free(key);
-    return parsed;
+    return nfc_emv_parser_search_data(storage, "aid", aid, aid_len, aid_name);
 }
 
 bool nfc_emv_parser_get_country_name(
     Storage* storage,
     uint16_t country_code,
     FuriString* country_name) {
-    bool parsed = false;
-    FuriString* key;
-    key = furi_string_alloc_printf("%04X", country_code);
-    if(nfc_emv_parser_search_data(
-           storage, EXT_PATH("nfc/assets/country_code.nfc"), key, country_name)) {
-        parsed = true;
-    }
-    furi_string_free(key);
-    return parsed;
+    const uint8_t key[] = {country_code >> 8, country_code & 0xFF};
+    return nfc_emv_parser_search_data(storage, "country_code", key, sizeof(key), country_name);
 }
 
 bool nfc_emv_parser_get_currency_name(
     Storage* storage,
     uint16_t currency_code,
     FuriString* currency_name) {
-    bool parsed = false;
-    FuriString* key;
-    key = furi_string_alloc_printf("%04X", currency_code);
-    if(nfc_emv_parser_search_data(
-           storage, EXT_PATH("nfc/assets/currency_code.nfc"), key, currency_name)) {
-        parsed = true;
-    }
-    furi_string_free(key);
-    return parsed;
+    const uint8_t key[] = {currency_code >> 8, currency_code & 0xFF};
+    return nfc_emv_parser_search_data(storage, "currency_code", key, sizeof(key), currency_name);
 }
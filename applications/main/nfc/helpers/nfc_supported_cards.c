@@ -11,12 +11,16 @@
 #include <furi.h>
 #include <path.h>
 #include <m-array.h>
+#include <bit_lib/bit_lib.h>
 
 #define TAG "NfcSupportedCards"
 
 #define NFC_SUPPORTED_CARDS_PLUGINS_PATH  APP_DATA_PATH("plugins")
 #define NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX "_parser.fal"
 
+// Number of plugins kept mapped in memory between read and parse calls
+#define NFC_SUPPORTED_CARDS_RESIDENT_MAX (3)
+
 typedef enum {
     NfcSupportedCardsPluginFeatureHasVerify = (1U << 0),
     NfcSupportedCardsPluginFeatureHasRead = (1U << 1),
@@ -27,6 +31,8 @@ typedef struct {
     FuriString* name;
     NfcProtocol protocol;
     NfcSupportedCardsPluginFeature feature;
+    // Copy of plugin manifest with keys and aids owned by cache, NULL if there is none
+    NfcSupportedCardsPluginManifest* manifest;
 } NfcSupportedCardsPluginCache;
 
 ARRAY_DEF(NfcSupportedCardsPluginCache, NfcSupportedCardsPluginCache, M_POD_OPLIST);
@@ -45,11 +51,21 @@ typedef struct {
     FlipperApplication* app;
 } NfcSupportedCardsLoadContext;
 
+typedef struct {
+    FlipperApplication* app;
+    const NfcSupportedCardsPlugin* plugin;
+    const NfcSupportedCardsPluginCache* plugin_cache;
+} NfcSupportedCardsResident;
+
 struct NfcSupportedCards {
     CompositeApiResolver* api_resolver;
+    Storage* storage;
     NfcSupportedCardsPluginCache_t plugins_cache_arr;
     NfcSupportedCardsLoadState load_state;
     NfcSupportedCardsLoadContext* load_context;
+    // Mapped plugins, most recently used first
+    NfcSupportedCardsResident resident[NFC_SUPPORTED_CARDS_RESIDENT_MAX];
+    size_t resident_count;
 };
 
 NfcSupportedCards* nfc_supported_cards_alloc(void) {
@@ -59,23 +75,40 @@ NfcSupportedCards* nfc_supported_cards_alloc(void) {
     composite_api_resolver_add(instance->api_resolver, firmware_api_interface);
     composite_api_resolver_add(instance->api_resolver, nfc_application_api_interface);
 
+    instance->storage = furi_record_open(RECORD_STORAGE);
+
     NfcSupportedCardsPluginCache_init(instance->plugins_cache_arr);
 
     return instance;
 }
 
+static void nfc_supported_cards_manifest_free(NfcSupportedCardsPluginManifest* manifest) {
+    free((void*)manifest->keys);
+    free((void*)manifest->aids);
+    free(manifest);
+}
+
 void nfc_supported_cards_free(NfcSupportedCards* instance) {
     furi_assert(instance);
 
+    for(size_t i = 0; i < instance->resident_count; i++) {
+        flipper_application_free(instance->resident[i].app);
+    }
+
     NfcSupportedCardsPluginCache_it_t iter;
     for(NfcSupportedCardsPluginCache_it(iter, instance->plugins_cache_arr);
         !NfcSupportedCardsPluginCache_end_p(iter);
         NfcSupportedCardsPluginCache_next(iter)) {
         NfcSupportedCardsPluginCache* plugin_cache = NfcSupportedCardsPluginCache_ref(iter);
         furi_string_free(plugin_cache->name);
+        if(plugin_cache->manifest) {
+            nfc_supported_cards_manifest_free(plugin_cache->manifest);
+        }
     }
     NfcSupportedCardsPluginCache_clear(instance->plugins_cache_arr);
 
+    furi_record_close(RECORD_STORAGE);
+
     composite_api_resolver_free(instance->api_resolver);
     free(instance);
 }
@@ -105,33 +138,29 @@ static void nfc_supported_cards_load_context_free(NfcSupportedCardsLoadContext*
     free(instance);
 }
 
-static const NfcSupportedCardsPlugin* nfc_supported_cards_get_plugin(
-    NfcSupportedCardsLoadContext* instance,
-    const char* name,
-    const ElfApiInterface* api_interface) {
-    furi_assert(instance);
+static const NfcSupportedCardsPlugin*
+    nfc_supported_cards_load_plugin(FlipperApplication* app, const char* name) {
+    furi_assert(app);
     furi_assert(name);
 
     const NfcSupportedCardsPlugin* plugin = NULL;
     FuriString* plugin_path = furi_string_alloc_printf(
         "%s/%s%s", NFC_SUPPORTED_CARDS_PLUGINS_PATH, name, NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX);
     do {
-        if(instance->app) flipper_application_free(instance->app);
-        instance->app = flipper_application_alloc(instance->storage, api_interface);
-
-        if(flipper_application_preload(instance->app, furi_string_get_cstr(plugin_path)) !=
+        if(flipper_application_preload(app, furi_string_get_cstr(plugin_path)) !=
            FlipperApplicationPreloadStatusSuccess)
             break;
-        if(!flipper_application_is_plugin(instance->app)) break;
-        if(flipper_application_map_to_memory(instance->app) != FlipperApplicationLoadStatusSuccess)
-            break;
+        if(!flipper_application_is_plugin(app)) break;
+        if(flipper_application_map_to_memory(app) != FlipperApplicationLoadStatusSuccess) break;
         const FlipperAppPluginDescriptor* descriptor =
-            flipper_application_plugin_get_descriptor(instance->app);
+            flipper_application_plugin_get_descriptor(app);
 
         if(descriptor == NULL) break;
 
         if(strcmp(descriptor->appid, NFC_SUPPORTED_CARD_PLUGIN_APP_ID) != 0) break;
-        if(descriptor->ep_api_version != NFC_SUPPORTED_CARD_PLUGIN_API_VERSION) break;
+        if(descriptor->ep_api_version < NFC_SUPPORTED_CARD_PLUGIN_API_VERSION_MIN ||
+           descriptor->ep_api_version > NFC_SUPPORTED_CARD_PLUGIN_API_VERSION)
+            break;
 
         plugin = descriptor->entry_point;
     } while(false);
@@ -140,6 +169,29 @@ static const NfcSupportedCardsPlugin* nfc_supported_cards_get_plugin(
     return plugin;
 }
 
+static const NfcSupportedCardsPluginManifest* nfc_supported_cards_get_plugin_manifest(
+    FlipperApplication* app,
+    const NfcSupportedCardsPlugin* plugin) {
+    const FlipperAppPluginDescriptor* descriptor = flipper_application_plugin_get_descriptor(app);
+
+    // The manifest field is past the end of older plugin structs
+    if(descriptor->ep_api_version < NFC_SUPPORTED_CARD_PLUGIN_API_VERSION_MANIFEST) return NULL;
+
+    return plugin->manifest;
+}
+
+static const NfcSupportedCardsPlugin* nfc_supported_cards_get_plugin(
+    NfcSupportedCardsLoadContext* instance,
+    const char* name,
+    const ElfApiInterface* api_interface) {
+    furi_assert(instance);
+
+    if(instance->app) flipper_application_free(instance->app);
+    instance->app = flipper_application_alloc(instance->storage, api_interface);
+
+    return nfc_supported_cards_load_plugin(instance->app, name);
+}
+
 static const NfcSupportedCardsPlugin* nfc_supported_cards_get_next_plugin(
     NfcSupportedCardsLoadContext* instance,
     const ElfApiInterface* api_interface) {
@@ -171,6 +223,40 @@ static const NfcSupportedCardsPlugin* nfc_supported_cards_get_next_plugin(
     return plugin;
 }
 
+static NfcSupportedCardsPluginManifest*
+    nfc_supported_cards_manifest_copy(const NfcSupportedCardsPluginManifest* manifest) {
+    const size_t sectors_max = mf_classic_get_total_sectors_num(MfClassicType4k);
+    for(size_t i = 0; i < manifest->keys_count; i++) {
+        // Keep the plugin without manifest, so it is never skipped by mistake
+        if(manifest->keys[i].sector >= sectors_max) {
+            FURI_LOG_W(TAG, "Invalid manifest key sector: %u", manifest->keys[i].sector);
+            return NULL;
+        }
+    }
+
+    NfcSupportedCardsPluginManifest* copy = malloc(sizeof(NfcSupportedCardsPluginManifest));
+    *copy = *manifest;
+
+    // Plugin is unloaded right after scan, so pointed data must be copied as well
+    copy->keys = NULL;
+    if(manifest->keys_count) {
+        const size_t keys_size = manifest->keys_count * sizeof(NfcSupportedCardsPluginKey);
+        NfcSupportedCardsPluginKey* keys = malloc(keys_size);
+        memcpy(keys, manifest->keys, keys_size);
+        copy->keys = keys;
+    }
+
+    copy->aids = NULL;
+    if(manifest->aids_count) {
+        const size_t aids_size = manifest->aids_count * sizeof(MfDesfireApplicationId);
+        MfDesfireApplicationId* aids = malloc(aids_size);
+        memcpy(aids, manifest->aids, aids_size);
+        copy->aids = aids;
+    }
+
+    return copy;
+}
+
 void nfc_supported_cards_load_cache(NfcSupportedCards* instance) {
     furi_assert(instance);
 
@@ -200,6 +286,11 @@ void nfc_supported_cards_load_cache(NfcSupportedCards* instance) {
             if(plugin->parse) {
                 plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasParse;
             }
+            const NfcSupportedCardsPluginManifest* manifest =
+                nfc_supported_cards_get_plugin_manifest(instance->load_context->app, plugin);
+            if(manifest) {
+                plugin_cache.manifest = nfc_supported_cards_manifest_copy(manifest);
+            }
             NfcSupportedCardsPluginCache_push_back(instance->plugins_cache_arr, plugin_cache);
         }
 
@@ -217,31 +308,192 @@ void nfc_supported_cards_load_cache(NfcSupportedCards* instance) {
     } while(false);
 }
 
+static bool nfc_supported_cards_match_id(
+    const NfcSupportedCardsPluginManifest* manifest,
+    const NfcDevice* device) {
+    const NfcProtocol protocol = nfc_device_get_protocol(device);
+
+    bool match = false;
+
+    do {
+        if(manifest->uid_len) {
+            size_t uid_len = 0;
+            nfc_device_get_uid(device, &uid_len);
+            if(uid_len != manifest->uid_len) break;
+        }
+
+        if(manifest->sak_mask || manifest->atqa_mask[0] || manifest->atqa_mask[1]) {
+            if((protocol != NfcProtocolIso14443_3a) &&
+               !nfc_protocol_has_parent(protocol, NfcProtocolIso14443_3a))
+                break;
+
+            const Iso14443_3aData* data = nfc_device_get_data(device, NfcProtocolIso14443_3a);
+            if((iso14443_3a_get_sak(data) ^ manifest->sak) & manifest->sak_mask) break;
+
+            uint8_t atqa[2];
+            iso14443_3a_get_atqa(data, atqa);
+            if((atqa[0] ^ manifest->atqa[0]) & manifest->atqa_mask[0]) break;
+            if((atqa[1] ^ manifest->atqa[1]) & manifest->atqa_mask[1]) break;
+        }
+
+        if(manifest->mf_classic_types) {
+            if(protocol != NfcProtocolMfClassic) break;
+
+            const MfClassicData* data = nfc_device_get_data(device, NfcProtocolMfClassic);
+            const uint32_t type = NFC_SUPPORTED_CARD_PLUGIN_MF_CLASSIC_TYPE(data->type);
+            if(!(manifest->mf_classic_types & type)) break;
+        }
+
+        match = true;
+    } while(false);
+
+    return match;
+}
+
+static bool nfc_supported_cards_match_keys(
+    const NfcSupportedCardsPluginManifest* manifest,
+    const NfcDevice* device) {
+    if(nfc_device_get_protocol(device) != NfcProtocolMfClassic) return false;
+
+    const MfClassicData* data = nfc_device_get_data(device, NfcProtocolMfClassic);
+    const uint32_t type = NFC_SUPPORTED_CARD_PLUGIN_MF_CLASSIC_TYPE(data->type);
+
+    bool match = false;
+
+    for(size_t i = 0; i < manifest->keys_count; i++) {
+        const NfcSupportedCardsPluginKey* key = &manifest->keys[i];
+        if(key->types && !(key->types & type)) continue;
+
+        // Compared the same way parsers do, regardless of whether the key was found
+        const MfClassicSectorTrailer* sec_tr =
+            mf_classic_get_sector_trailer_by_sector(data, key->sector);
+        const MfClassicKey* sec_key =
+            (key->key_type == MfClassicKeyTypeA) ? &sec_tr->key_a : &sec_tr->key_b;
+        if(bit_lib_bytes_to_num_be(sec_key->data, COUNT_OF(sec_key->data)) == key->key) {
+            match = true;
+            break;
+        }
+    }
+
+    return match;
+}
+
+static bool nfc_supported_cards_match_aids(
+    const NfcSupportedCardsPluginManifest* manifest,
+    const NfcDevice* device) {
+    if(nfc_device_get_protocol(device) != NfcProtocolMfDesfire) return false;
+
+    const MfDesfireData* data = nfc_device_get_data(device, NfcProtocolMfDesfire);
+
+    bool match = false;
+
+    for(size_t i = 0; i < manifest->aids_count; i++) {
+        if(mf_desfire_get_application(data, &manifest->aids[i])) {
+            match = true;
+            break;
+        }
+    }
+
+    return match;
+}
+
+static bool nfc_supported_cards_match(
+    const NfcSupportedCardsPluginCache* plugin_cache,
+    const NfcDevice* device,
+    bool has_data) {
+    const NfcSupportedCardsPluginManifest* manifest = plugin_cache->manifest;
+
+    bool match = false;
+
+    do {
+        if(plugin_cache->protocol != nfc_device_get_protocol(device)) break;
+        if(manifest == NULL) {
+            match = true;
+            break;
+        }
+
+        if(!nfc_supported_cards_match_id(manifest, device)) break;
+
+        if(has_data) {
+            if(manifest->keys_count && !nfc_supported_cards_match_keys(manifest, device)) break;
+            if(manifest->aids_count && !nfc_supported_cards_match_aids(manifest, device)) break;
+        }
+
+        match = true;
+    } while(false);
+
+    return match;
+}
+
+static const NfcSupportedCardsPlugin* nfc_supported_cards_get_resident(
+    NfcSupportedCards* instance,
+    const NfcSupportedCardsPluginCache* plugin_cache) {
+    size_t index = 0;
+    while(index < instance->resident_count) {
+        if(instance->resident[index].plugin_cache == plugin_cache) break;
+        index++;
+    }
+
+    NfcSupportedCardsResident resident = {};
+
+    if(index < instance->resident_count) {
+        resident = instance->resident[index];
+    } else {
+        const ElfApiInterface* api_interface = composite_api_resolver_get(instance->api_resolver);
+        resident.app = flipper_application_alloc(instance->storage, api_interface);
+        resident.plugin = nfc_supported_cards_load_plugin(
+            resident.app, furi_string_get_cstr(plugin_cache->name));
+        resident.plugin_cache = plugin_cache;
+
+        if(resident.plugin == NULL) {
+            flipper_application_free(resident.app);
+            return NULL;
+        }
+
+        FURI_LOG_D(TAG, "Mapped %s", furi_string_get_cstr(plugin_cache->name));
+
+        if(instance->resident_count < NFC_SUPPORTED_CARDS_RESIDENT_MAX) {
+            index = instance->resident_count++;
+        } else {
+            // Evict least recently used, its slot is overwritten by shift below
+            index = NFC_SUPPORTED_CARDS_RESIDENT_MAX - 1;
+            flipper_application_free(instance->resident[index].app);
+        }
+    }
+
+    memmove(&instance->resident[1], &instance->resident[0], index * sizeof(resident));
+    instance->resident[0] = resident;
+
+    return resident.plugin;
+}
+
 bool nfc_supported_cards_read(NfcSupportedCards* instance, NfcDevice* device, Nfc* nfc) {
     furi_assert(instance);
     furi_assert(device);
     furi_assert(nfc);
 
     bool card_read = false;
-    NfcProtocol protocol = nfc_device_get_protocol(device);
 
     do {
         if(instance->load_state != NfcSupportedCardsLoadStateSuccess) break;
 
-        instance->load_context = nfc_supported_cards_load_context_alloc();
+        const uint32_t start = furi_get_tick();
+        size_t skipped = 0;
 
         NfcSupportedCardsPluginCache_it_t iter;
         for(NfcSupportedCardsPluginCache_it(iter, instance->plugins_cache_arr);
             !NfcSupportedCardsPluginCache_end_p(iter);
             NfcSupportedCardsPluginCache_next(iter)) {
-            NfcSupportedCardsPluginCache* plugin_cache = NfcSupportedCardsPluginCache_ref(iter);
-            if(plugin_cache->protocol != protocol) continue;
+            const NfcSupportedCardsPluginCache* plugin_cache =
+                NfcSupportedCardsPluginCache_cref(iter);
             if((plugin_cache->feature & NfcSupportedCardsPluginFeatureHasRead) == 0) continue;
+            if(!nfc_supported_cards_match(plugin_cache, device, false)) {
+                skipped++;
+                continue;
+            }
 
-            const ElfApiInterface* api_interface =
-                composite_api_resolver_get(instance->api_resolver);
-            const NfcSupportedCardsPlugin* plugin = nfc_supported_cards_get_plugin(
-                instance->load_context, furi_string_get_cstr(plugin_cache->name), api_interface);
+            const NfcSupportedCardsPlugin* plugin =
+                nfc_supported_cards_get_resident(instance, plugin_cache);
             if(plugin == NULL) continue;
 
             if(plugin->verify) {
@@ -256,7 +508,12 @@ bool nfc_supported_cards_read(NfcSupportedCards* instance, NfcDevice* device, Nf
             }
         }
 
-        nfc_supported_cards_load_context_free(instance->load_context);
+        FURI_LOG_D(
+            TAG,
+            "Read %s in %lums, %zu plugins skipped",
+            card_read ? "done" : "failed",
+            furi_get_tick() - start,
+            skipped);
     } while(false);
 
     return card_read;
@@ -271,25 +528,27 @@ bool nfc_supported_cards_parse(
     furi_assert(parsed_data);
 
     bool card_parsed = false;
-    NfcProtocol protocol = nfc_device_get_protocol(device);
 
     do {
         if(instance->load_state != NfcSupportedCardsLoadStateSuccess) break;
 
-        instance->load_context = nfc_supported_cards_load_context_alloc();
+        const uint32_t start = furi_get_tick();
+        size_t skipped = 0;
 
         NfcSupportedCardsPluginCache_it_t iter;
         for(NfcSupportedCardsPluginCache_it(iter, instance->plugins_cache_arr);
             !NfcSupportedCardsPluginCache_end_p(iter);
             NfcSupportedCardsPluginCache_next(iter)) {
-            NfcSupportedCardsPluginCache* plugin_cache = NfcSupportedCardsPluginCache_ref(iter);
-            if(plugin_cache->protocol != protocol) continue;
+            const NfcSupportedCardsPluginCache* plugin_cache =
+                NfcSupportedCardsPluginCache_cref(iter);
             if((plugin_cache->feature & NfcSupportedCardsPluginFeatureHasParse) == 0) continue;
+            if(!nfc_supported_cards_match(plugin_cache, device, true)) {
+                skipped++;
+                continue;
+            }
 
-            const ElfApiInterface* api_interface =
-                composite_api_resolver_get(instance->api_resolver);
-            const NfcSupportedCardsPlugin* plugin = nfc_supported_cards_get_plugin(
-                instance->load_context, furi_string_get_cstr(plugin_cache->name), api_interface);
+            const NfcSupportedCardsPlugin* plugin =
+                nfc_supported_cards_get_resident(instance, plugin_cache);
             if(plugin == NULL) continue;
 
             if(plugin->parse) {
@@ -300,7 +559,12 @@ bool nfc_supported_cards_parse(
             }
         }
 
-        nfc_supported_cards_load_context_free(instance->load_context);
+        FURI_LOG_D(
+            TAG,
+            "Parse %s in %lums, %zu plugins skipped",
+            card_parsed ? "done" : "failed",
+            furi_get_tick() - start,
+            skipped);
     } while(false);
 
     return card_parsed;
@@ -50,6 +50,9 @@ void nfc_supported_cards_load_cache(NfcSupportedCards* instance);
  * try to execute the custom read procedure specified in each. Upon first success,
  * no further attempts will be made and the function will return.
  *
+ * Plugins whose manifest rejects the card identification data are not loaded.
+ * Recently used plugins are kept in memory for subsequent calls.
+ *
  * @param[in, out] instance pointer to NfcSupportedCards instance.
  * @param[in,out] device pointer to a device instance to hold the read data.
  * @param[in,out] nfc pointer to an Nfc instance.
@@ -66,6 +69,9 @@ bool nfc_supported_cards_read(NfcSupportedCards* instance, NfcDevice* device, Nf
  * try to parse the data according to each implementation. Upon first success,
  * no further attempts will be made and the function will return.
  *
+ * Plugins whose manifest rejects the card data are not loaded. Recently used
+ * plugins are kept in memory for subsequent calls.
+ *
  * @param[in, out] instance pointer to NfcSupportedCards instance.
  * @param[in] device pointer to a device instance holding the data is to be parsed.
  * @param[out] parsed_data pointer to the string to contain the formatted result.
@@ -56,6 +56,8 @@
 
 #include <nfc/nfc_device.h>
 #include <nfc/helpers/nfc_data_generator.h>
+#include <nfc/helpers/mf_classic_dict_attack_stage.h>
+#include <nfc/helpers/mf_classic_key_index.h>
 #include <toolbox/keys_dict.h>
 
 #include <gui/modules/validators.h>
@@ -82,6 +84,12 @@
 #define NFC_APP_MF_CLASSIC_DICT_SYSTEM_NESTED_PATH \
     (NFC_APP_FOLDER "/assets/mf_classic_dict_nested.nfc")
 
+#define NFC_APP_CACHE_FOLDER                  (NFC_APP_FOLDER "/.cache")
+#define NFC_APP_MF_CLASSIC_KEY_INDEX_PATH     (NFC_APP_CACHE_FOLDER "/mf_classic_keys.idx")
+#define NFC_APP_MF_CLASSIC_DICT_INDEX_PATH    (NFC_APP_CACHE_FOLDER "/mf_classic_dict_index.nfc")
+#define NFC_APP_MF_CLASSIC_KEY_INDEX_SIZE     (512)
+#define NFC_APP_MF_CLASSIC_KEY_INDEX_KEYS_MAX (16)
+
 typedef enum {
     NfcRpcStateIdle,
     NfcRpcStateEmulating,
@@ -89,6 +97,10 @@ typedef enum {
 
 typedef struct {
     KeysDict* dict;
+    MfClassicKeyIndex* key_index;
+    MfClassicKey* key_index_keys;
+    size_t key_index_keys_tried;
+    size_t key_index_keys_num;
     uint8_t sectors_total;
     uint8_t sectors_read;
     uint8_t current_sector;
@@ -551,12 +551,23 @@ static void furi_string_cat_timestamp(
     furi_string_free(time_str);
 }
 
+static const MfDesfireApplicationId clipper_manifest_aids[] = {
+    {.data = {0x90, 0x11, 0xf2}},
+    {.data = {0x91, 0x11, 0xf2}},
+};
+
+static const NfcSupportedCardsPluginManifest clipper_manifest = {
+    .aids = clipper_manifest_aids,
+    .aids_count = COUNT_OF(clipper_manifest_aids),
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin clipper_plugin = {
     .protocol = NfcProtocolMfDesfire,
     .verify = NULL,
     .read = NULL,
     .parse = clipper_parse,
+    .manifest = &clipper_manifest,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
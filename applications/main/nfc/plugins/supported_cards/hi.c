@@ -206,12 +206,23 @@ static bool hi_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static const NfcSupportedCardsPluginKey hi_manifest_keys[] = {
+    {.sector = 0, .key_type = MfClassicKeyTypeB, .key = 0x30871cf60cf1},
+};
+
+static const NfcSupportedCardsPluginManifest hi_manifest = {
+    .mf_classic_types = NFC_SUPPORTED_CARD_PLUGIN_MF_CLASSIC_TYPE(MfClassicType1k),
+    .keys = hi_manifest_keys,
+    .keys_count = COUNT_OF(hi_manifest_keys),
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin hi_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = hi_verify,
     .read = hi_read,
     .parse = hi_parse,
+    .manifest = &hi_manifest,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -108,12 +108,18 @@ static bool itso_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static const NfcSupportedCardsPluginManifest itso_manifest = {
+    .aids = &itso_app_id,
+    .aids_count = 1,
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin itso_plugin = {
     .protocol = NfcProtocolMfDesfire,
     .verify = NULL,
     .read = NULL,
     .parse = itso_parse,
+    .manifest = &itso_manifest,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
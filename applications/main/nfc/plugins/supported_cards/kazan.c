@@ -393,12 +393,23 @@ static bool kazan_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static const NfcSupportedCardsPluginKey kazan_manifest_keys[] = {
+    {.sector = 8, .key_type = MfClassicKeyTypeA, .key = 0xe954024ee754},
+    {.sector = 8, .key_type = MfClassicKeyTypeA, .key = 0x2058eaee8446},
+};
+
+static const NfcSupportedCardsPluginManifest kazan_manifest = {
+    .keys = kazan_manifest_keys,
+    .keys_count = COUNT_OF(kazan_manifest_keys),
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin kazan_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = kazan_verify,
     .read = kazan_read,
     .parse = kazan_parse,
+    .manifest = &kazan_manifest,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
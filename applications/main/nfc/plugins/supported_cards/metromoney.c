@@ -169,12 +169,22 @@ static bool metromoney_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static const NfcSupportedCardsPluginKey metromoney_manifest_keys[] = {
+    {.sector = 1, .key_type = MfClassicKeyTypeA, .key = 0x9c616585e26d},
+};
+
+static const NfcSupportedCardsPluginManifest metromoney_manifest = {
+    .keys = metromoney_manifest_keys,
+    .keys_count = COUNT_OF(metromoney_manifest_keys),
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin metromoney_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = metromoney_verify,
     .read = metromoney_read,
     .parse = metromoney_parse,
+    .manifest = &metromoney_manifest,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -210,6 +210,10 @@ static bool microel_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static const NfcSupportedCardsPluginManifest microel_manifest = {
+    .uid_len = UID_LENGTH,
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin microel_plugin = {
     .protocol = NfcProtocolMfClassic,
@@ -217,6 +221,7 @@ static const NfcSupportedCardsPlugin microel_plugin = {
         NULL, // the verification I need is based on verifying the keys generated via uid and try to authenticate not like on mizip that there is default b0 but added verify in read function
     .read = microel_read,
     .parse = microel_parse,
+    .manifest = &microel_manifest,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
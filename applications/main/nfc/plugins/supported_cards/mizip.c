@@ -237,12 +237,24 @@ static bool mizip_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static const NfcSupportedCardsPluginKey mizip_manifest_keys[] = {
+    {.sector = 0, .key_type = MfClassicKeyTypeB, .key = 0xb4c132439eef},
+};
+
+static const NfcSupportedCardsPluginManifest mizip_manifest = {
+    .mf_classic_types = NFC_SUPPORTED_CARD_PLUGIN_MF_CLASSIC_TYPE(MfClassicType1k) |
+                        NFC_SUPPORTED_CARD_PLUGIN_MF_CLASSIC_TYPE(MfClassicTypeMini),
+    .keys = mizip_manifest_keys,
+    .keys_count = COUNT_OF(mizip_manifest_keys),
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin mizip_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = mizip_verify,
     .read = mizip_read,
     .parse = mizip_parse,
+    .manifest = &mizip_manifest,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -19,6 +19,10 @@
  * @note the APPID field MUST end with `_parser` so the applicaton would know that this particular file
  * is a supported card plugin.
  *
+ * A plugin should also provide a manifest with cheap match predicates. The manifest is copied
+ * into the application once, when plugins are scanned, and is used to skip loading the plugin
+ * for cards it would reject anyway.
+ *
  * @see nfc_supported_cards.h
  */
 #pragma once
@@ -27,6 +31,8 @@
 
 #include <nfc/nfc.h>
 #include <nfc/nfc_device.h>
+#include <nfc/protocols/mf_classic/mf_classic.h>
+#include <nfc/protocols/mf_desfire/mf_desfire.h>
 
 /**
  * @brief Unique string identifier for supported card plugins.
@@ -36,7 +42,19 @@
 /**
  * @brief Currently supported plugin API version.
  */
-#define NFC_SUPPORTED_CARD_PLUGIN_API_VERSION 1
+#define NFC_SUPPORTED_CARD_PLUGIN_API_VERSION 2
+
+/**
+ * @brief Oldest plugin API version that is still loaded.
+ */
+#define NFC_SUPPORTED_CARD_PLUGIN_API_VERSION_MIN 1
+
+/**
+ * @brief First plugin API version with the manifest field.
+ *
+ * Older plugins end before it, their manifest is treated as NULL.
+ */
+#define NFC_SUPPORTED_CARD_PLUGIN_API_VERSION_MANIFEST 2
 
 /**
  * @brief Verify that the card is of a supported type.
@@ -81,6 +99,45 @@ typedef bool (*NfcSupportedCardPluginRead)(Nfc* nfc, NfcDevice* device);
  */
 typedef bool (*NfcSupportedCardPluginParse)(const NfcDevice* device, FuriString* parsed_data);
 
+/**
+ * @brief Convert MfClassicType value to a bit for the manifest type masks.
+ */
+#define NFC_SUPPORTED_CARD_PLUGIN_MF_CLASSIC_TYPE(type) (1UL << (type))
+
+/**
+ * @brief MIFARE Classic sector key known to be used by the card.
+ */
+typedef struct {
+    uint32_t types; /**< MfClassicType mask the key applies to, 0 for any type. */
+    uint8_t sector; /**< Sector number which trailer holds the key. */
+    MfClassicKeyType key_type; /**< Key A or key B of the sector trailer. */
+    uint64_t key; /**< Key value, as in plugin key tables. */
+} NfcSupportedCardsPluginKey;
+
+/**
+ * @brief Cheap match predicates of a supported card plugin.
+ *
+ * Every predicate is optional, the zero value means "any". A card matches the manifest
+ * only if it passes all of the specified predicates. Identification predicates (UID length,
+ * SAK, ATQA and MIFARE Classic type) are checked before both read() and parse(), so they
+ * must hold for every card either function could accept. Data predicates (sector keys and
+ * application ids) are checked only before parse(), as there is no card data yet on read.
+ *
+ * Keys and application ids are alternatives: a card passes if any of them is present.
+ */
+typedef struct {
+    uint8_t uid_len; /**< Required UID length. */
+    uint8_t sak; /**< Required SAK bits, as selected by sak_mask. */
+    uint8_t sak_mask; /**< SAK bits to compare. */
+    uint8_t atqa[2]; /**< Required ATQA bits, as selected by atqa_mask. */
+    uint8_t atqa_mask[2]; /**< ATQA bits to compare. */
+    uint32_t mf_classic_types; /**< MfClassicType mask of accepted card types. */
+    const NfcSupportedCardsPluginKey* keys; /**< MIFARE Classic sector trailer keys. */
+    size_t keys_count; /**< Number of elements in keys. */
+    const MfDesfireApplicationId* aids; /**< MIFARE DESFire application ids. */
+    size_t aids_count; /**< Number of elements in aids. */
+} NfcSupportedCardsPluginManifest;
+
 /**
  * @brief Supported card plugin interface.
  *
@@ -91,4 +148,5 @@ typedef struct {
     NfcSupportedCardPluginVerify verify; /**< Pointer to the verify() function. */
     NfcSupportedCardPluginRead read; /**< Pointer to the read() function. */
     NfcSupportedCardPluginParse parse; /**< Pointer to the parse() function. */
+    const NfcSupportedCardsPluginManifest* manifest; /**< Match predicates, may be NULL. */
 } NfcSupportedCardsPlugin;
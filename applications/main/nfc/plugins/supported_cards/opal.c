@@ -212,12 +212,18 @@ static bool opal_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static const NfcSupportedCardsPluginManifest opal_manifest = {
+    .aids = &opal_app_id,
+    .aids_count = 1,
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin opal_plugin = {
     .protocol = NfcProtocolMfDesfire,
     .verify = NULL,
     .read = NULL,
     .parse = opal_parse,
+    .manifest = &opal_manifest,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -311,12 +311,24 @@ static bool plantain_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static const NfcSupportedCardsPluginKey plantain_manifest_keys[] = {
+    {.sector = 8, .key_type = MfClassicKeyTypeA, .key = 0x26973ea74321},
+};
+
+static const NfcSupportedCardsPluginManifest plantain_manifest = {
+    .mf_classic_types = NFC_SUPPORTED_CARD_PLUGIN_MF_CLASSIC_TYPE(MfClassicType1k) |
+                        NFC_SUPPORTED_CARD_PLUGIN_MF_CLASSIC_TYPE(MfClassicType4k),
+    .keys = plantain_manifest_keys,
+    .keys_count = COUNT_OF(plantain_manifest_keys),
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin plantain_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = plantain_verify,
     .read = plantain_read,
     .parse = plantain_parse,
+    .manifest = &plantain_manifest,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
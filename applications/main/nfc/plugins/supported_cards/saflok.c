@@ -437,12 +437,22 @@ bool saflok_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static const NfcSupportedCardsPluginKey saflok_manifest_keys[] = {
+    {.sector = 1, .key_type = MfClassicKeyTypeA, .key = 0x2a2c13cc242a},
+};
+
+static const NfcSupportedCardsPluginManifest saflok_manifest = {
+    .keys = saflok_manifest_keys,
+    .keys_count = COUNT_OF(saflok_manifest_keys),
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin saflok_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = saflok_verify,
     .read = saflok_read,
     .parse = saflok_parse,
+    .manifest = &saflok_manifest,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -280,12 +280,24 @@ static bool social_moscow_parse(const NfcDevice* device, FuriString* parsed_data
     return parsed;
 }
 
+static const NfcSupportedCardsPluginKey social_moscow_manifest_keys[] = {
+    {.sector = 15, .key_type = MfClassicKeyTypeA, .key = 0xa0a1a2a3a4a5},
+};
+
+static const NfcSupportedCardsPluginManifest social_moscow_manifest = {
+    .mf_classic_types = NFC_SUPPORTED_CARD_PLUGIN_MF_CLASSIC_TYPE(MfClassicType1k) |
+                        NFC_SUPPORTED_CARD_PLUGIN_MF_CLASSIC_TYPE(MfClassicType4k),
+    .keys = social_moscow_manifest_keys,
+    .keys_count = COUNT_OF(social_moscow_manifest_keys),
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin social_moscow_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = social_moscow_verify,
     .read = social_moscow_read,
     .parse = social_moscow_parse,
+    .manifest = &social_moscow_manifest,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
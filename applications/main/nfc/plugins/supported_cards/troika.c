@@ -230,12 +230,31 @@ static bool troika_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static const NfcSupportedCardsPluginKey troika_manifest_keys[] = {
+    {.types = NFC_SUPPORTED_CARD_PLUGIN_MF_CLASSIC_TYPE(MfClassicType1k),
+     .sector = 11,
+     .key_type = MfClassicKeyTypeA,
+     .key = 0x08b386463229},
+    {.types = NFC_SUPPORTED_CARD_PLUGIN_MF_CLASSIC_TYPE(MfClassicType4k),
+     .sector = 8,
+     .key_type = MfClassicKeyTypeA,
+     .key = 0xa73f5dc1d333},
+};
+
+static const NfcSupportedCardsPluginManifest troika_manifest = {
+    .mf_classic_types = NFC_SUPPORTED_CARD_PLUGIN_MF_CLASSIC_TYPE(MfClassicType1k) |
+                        NFC_SUPPORTED_CARD_PLUGIN_MF_CLASSIC_TYPE(MfClassicType4k),
+    .keys = troika_manifest_keys,
+    .keys_count = COUNT_OF(troika_manifest_keys),
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin troika_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = troika_verify,
     .read = troika_read,
     .parse = troika_parse,
+    .manifest = &troika_manifest,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -169,12 +169,22 @@ static bool two_cities_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static const NfcSupportedCardsPluginKey two_cities_manifest_keys[] = {
+    {.sector = 4, .key_type = MfClassicKeyTypeA, .key = 0xe56ac127dd45},
+};
+
+static const NfcSupportedCardsPluginManifest two_cities_manifest = {
+    .keys = two_cities_manifest_keys,
+    .keys_count = COUNT_OF(two_cities_manifest_keys),
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin two_cities_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = two_cities_verify,
     .read = two_cities_read,
     .parse = two_cities_parse,
+    .manifest = &two_cities_manifest,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
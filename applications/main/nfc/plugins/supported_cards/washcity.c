@@ -174,12 +174,22 @@ static bool washcity_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static const NfcSupportedCardsPluginKey washcity_manifest_keys[] = {
+    {.sector = 1, .key_type = MfClassicKeyTypeA, .key = 0xc78a3d0e1bcd},
+};
+
+static const NfcSupportedCardsPluginManifest washcity_manifest = {
+    .keys = washcity_manifest_keys,
+    .keys_count = COUNT_OF(washcity_manifest_keys),
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin washcity_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = washcity_verify,
     .read = washcity_read,
     .parse = washcity_parse,
+    .manifest = &washcity_manifest,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
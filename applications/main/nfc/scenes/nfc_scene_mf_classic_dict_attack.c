@@ -8,12 +8,6 @@
 // TODO: Fix lag when leaving the dictionary attack view after Hardnested
 // TODO: Re-enters backdoor detection between user and system dictionary if no backdoor is found
 
-typedef enum {
-    DictAttackStateCUIDDictInProgress,
-    DictAttackStateUserDictInProgress,
-    DictAttackStateSystemDictInProgress,
-} DictAttackState;
-
 NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context) {
     furi_assert(context);
     furi_assert(event.event_data);
@@ -136,84 +130,154 @@ static void nfc_scene_mf_classic_dict_attack_update_view(NfcApp* instance) {
     }
 }
 
-static void nfc_scene_mf_classic_dict_attack_prepare_view(NfcApp* instance) {
-    uint32_t state =
-        scene_manager_get_scene_state(instance->scene_manager, NfcSceneMfClassicDictAttack);
-    if(state == DictAttackStateCUIDDictInProgress) {
-        size_t cuid_len = 0;
-        const uint8_t* cuid = nfc_device_get_uid(instance->nfc_device, &cuid_len);
-        FuriString* cuid_dict_path = furi_string_alloc_printf(
-            "%s/mf_classic_dict_%08lx.nfc",
-            EXT_PATH("nfc/assets"),
-            (uint32_t)bit_lib_bytes_to_num_be(cuid + (cuid_len - 4), 4));
-
-        do {
-            if(!keys_dict_check_presence(furi_string_get_cstr(cuid_dict_path))) {
-                state = DictAttackStateUserDictInProgress;
-                break;
-            }
+static bool nfc_scene_mf_classic_dict_attack_is_key_tried(
+    const MfClassicKey* key,
+    const MfClassicKey* keys_tried,
+    size_t keys_tried_num) {
+    for(size_t i = 0; i < keys_tried_num; i++) {
+        if(memcmp(key->data, keys_tried[i].data, sizeof(MfClassicKey)) == 0) return true;
+    }
 
-            instance->nfc_dict_context.dict = keys_dict_alloc(
-                furi_string_get_cstr(cuid_dict_path),
-                KeysDictModeOpenExisting,
-                sizeof(MfClassicKey));
+    return false;
+}
 
-            if(keys_dict_get_total_keys(instance->nfc_dict_context.dict) == 0) {
-                keys_dict_free(instance->nfc_dict_context.dict);
-                state = DictAttackStateUserDictInProgress;
-                break;
-            }
+static bool nfc_scene_mf_classic_dict_attack_prepare_key_index(NfcApp* instance) {
+    NfcMfClassicDictAttackContext* mfc_dict = &instance->nfc_dict_context;
+    const MfClassicData* mfc_data =
+        nfc_device_get_data(instance->nfc_device, NfcProtocolMfClassic);
+
+    // Keys suggested by the previous lookup were tried already, only new ones are kept
+    const size_t keys_tried_num = mfc_dict->key_index_keys_tried + mfc_dict->key_index_keys_num;
+    MfClassicKey* keys = &mfc_dict->key_index_keys[keys_tried_num];
+    const size_t keys_found_num = mf_classic_key_index_lookup(
+        mfc_dict->key_index,
+        mfc_data,
+        keys,
+        NFC_APP_MF_CLASSIC_KEY_INDEX_KEYS_MAX * 2 - keys_tried_num);
+
+    size_t keys_num = 0;
+    for(size_t i = 0; i < keys_found_num && keys_num < NFC_APP_MF_CLASSIC_KEY_INDEX_KEYS_MAX;
+        i++) {
+        if(nfc_scene_mf_classic_dict_attack_is_key_tried(
+               &keys[i], mfc_dict->key_index_keys, keys_tried_num)) {
+            continue;
+        }
+        keys[keys_num++] = keys[i];
+    }
+    mfc_dict->key_index_keys_tried = keys_tried_num;
+    mfc_dict->key_index_keys_num = keys_num;
+    if(keys_num == 0) return false;
+
+    // Keys seen on cards of the same family go first, before any dictionary
+    storage_simply_mkdir(instance->storage, NFC_APP_CACHE_FOLDER);
+    storage_simply_remove(instance->storage, NFC_APP_MF_CLASSIC_DICT_INDEX_PATH);
+    mfc_dict->dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_INDEX_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
+    for(size_t i = 0; i < keys_num; i++) {
+        keys_dict_add_key(mfc_dict->dict, keys[i].data, sizeof(MfClassicKey));
+    }
+    keys_dict_rewind(mfc_dict->dict);
 
-            dict_attack_set_header(instance->dict_attack, "MF Classic CUID Dictionary");
-        } while(false);
+    dict_attack_set_header(instance->dict_attack, "MF Classic Key Index");
 
-        furi_string_free(cuid_dict_path);
-    }
-    if(state == DictAttackStateUserDictInProgress) {
-        do {
-            instance->nfc_dict_context.enhanced_dict = true;
+    return true;
+}
 
-            if(keys_dict_check_presence(NFC_APP_MF_CLASSIC_DICT_SYSTEM_NESTED_PATH)) {
-                storage_common_remove(
-                    instance->storage, NFC_APP_MF_CLASSIC_DICT_SYSTEM_NESTED_PATH);
-            }
-            if(keys_dict_check_presence(NFC_APP_MF_CLASSIC_DICT_SYSTEM_PATH)) {
-                storage_common_copy(
-                    instance->storage,
-                    NFC_APP_MF_CLASSIC_DICT_SYSTEM_PATH,
-                    NFC_APP_MF_CLASSIC_DICT_SYSTEM_NESTED_PATH);
-            }
+static bool nfc_scene_mf_classic_dict_attack_prepare_cuid_dict(NfcApp* instance) {
+    size_t cuid_len = 0;
+    const uint8_t* cuid = nfc_device_get_uid(instance->nfc_device, &cuid_len);
+    FuriString* cuid_dict_path = furi_string_alloc_printf(
+        "%s/mf_classic_dict_%08lx.nfc",
+        EXT_PATH("nfc/assets"),
+        (uint32_t)bit_lib_bytes_to_num_be(cuid + (cuid_len - 4), 4));
 
-            if(!keys_dict_check_presence(NFC_APP_MF_CLASSIC_DICT_USER_PATH)) {
-                state = DictAttackStateSystemDictInProgress;
-                break;
-            }
+    bool prepared = false;
+    do {
+        if(!keys_dict_check_presence(furi_string_get_cstr(cuid_dict_path))) break;
 
-            if(keys_dict_check_presence(NFC_APP_MF_CLASSIC_DICT_USER_NESTED_PATH)) {
-                storage_common_remove(instance->storage, NFC_APP_MF_CLASSIC_DICT_USER_NESTED_PATH);
-            }
-            storage_common_copy(
-                instance->storage,
-                NFC_APP_MF_CLASSIC_DICT_USER_PATH,
-                NFC_APP_MF_CLASSIC_DICT_USER_NESTED_PATH);
-
-            instance->nfc_dict_context.dict = keys_dict_alloc(
-                NFC_APP_MF_CLASSIC_DICT_USER_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
-            if(keys_dict_get_total_keys(instance->nfc_dict_context.dict) == 0) {
-                keys_dict_free(instance->nfc_dict_context.dict);
-                state = DictAttackStateSystemDictInProgress;
-                break;
-            }
+        instance->nfc_dict_context.dict = keys_dict_alloc(
+            furi_string_get_cstr(cuid_dict_path), KeysDictModeOpenExisting, sizeof(MfClassicKey));
+
+        if(keys_dict_get_total_keys(instance->nfc_dict_context.dict) == 0) {
+            keys_dict_free(instance->nfc_dict_context.dict);
+            break;
+        }
+
+        dict_attack_set_header(instance->dict_attack, "MF Classic CUID Dictionary");
+        prepared = true;
+    } while(false);
+
+    furi_string_free(cuid_dict_path);
+
+    return prepared;
+}
+
+static bool nfc_scene_mf_classic_dict_attack_prepare_user_dict(NfcApp* instance) {
+    instance->nfc_dict_context.enhanced_dict = true;
 
-            dict_attack_set_header(instance->dict_attack, "MF Classic User Dictionary");
-        } while(false);
+    if(keys_dict_check_presence(NFC_APP_MF_CLASSIC_DICT_SYSTEM_NESTED_PATH)) {
+        storage_common_remove(instance->storage, NFC_APP_MF_CLASSIC_DICT_SYSTEM_NESTED_PATH);
+    }
+    if(keys_dict_check_presence(NFC_APP_MF_CLASSIC_DICT_SYSTEM_PATH)) {
+        storage_common_copy(
+            instance->storage,
+            NFC_APP_MF_CLASSIC_DICT_SYSTEM_PATH,
+            NFC_APP_MF_CLASSIC_DICT_SYSTEM_NESTED_PATH);
+    }
+
+    if(!keys_dict_check_presence(NFC_APP_MF_CLASSIC_DICT_USER_PATH)) return false;
+
+    if(keys_dict_check_presence(NFC_APP_MF_CLASSIC_DICT_USER_NESTED_PATH)) {
+        storage_common_remove(instance->storage, NFC_APP_MF_CLASSIC_DICT_USER_NESTED_PATH);
+    }
+    storage_common_copy(
+        instance->storage,
+        NFC_APP_MF_CLASSIC_DICT_USER_PATH,
+        NFC_APP_MF_CLASSIC_DICT_USER_NESTED_PATH);
+
+    instance->nfc_dict_context.dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_USER_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
+    if(keys_dict_get_total_keys(instance->nfc_dict_context.dict) == 0) {
+        keys_dict_free(instance->nfc_dict_context.dict);
+        return false;
     }
-    if(state == DictAttackStateSystemDictInProgress) {
+
+    dict_attack_set_header(instance->dict_attack, "MF Classic User Dictionary");
+
+    return true;
+}
+
+static bool nfc_scene_mf_classic_dict_attack_prepare_stage(
+    MfClassicDictAttackStage stage,
+    void* context) {
+    NfcApp* instance = context;
+    bool prepared = false;
+
+    if(stage == MfClassicDictAttackStageKeyIndex) {
+        prepared = nfc_scene_mf_classic_dict_attack_prepare_key_index(instance);
+    } else if(stage == MfClassicDictAttackStageCuidDict) {
+        prepared = nfc_scene_mf_classic_dict_attack_prepare_cuid_dict(instance);
+    } else if(stage == MfClassicDictAttackStageKeyIndexRequery) {
+        // Sector 0 and the first key A found so far narrow the lookup down to the card site
+        prepared = nfc_scene_mf_classic_dict_attack_prepare_key_index(instance);
+    } else if(stage == MfClassicDictAttackStageUserDict) {
+        prepared = nfc_scene_mf_classic_dict_attack_prepare_user_dict(instance);
+    } else {
         instance->nfc_dict_context.dict = keys_dict_alloc(
             NFC_APP_MF_CLASSIC_DICT_SYSTEM_PATH, KeysDictModeOpenExisting, sizeof(MfClassicKey));
         dict_attack_set_header(instance->dict_attack, "MF Classic System Dictionary");
+        prepared = true;
     }
 
+    return prepared;
+}
+
+static void nfc_scene_mf_classic_dict_attack_prepare_view(NfcApp* instance) {
+    uint32_t state =
+        scene_manager_get_scene_state(instance->scene_manager, NfcSceneMfClassicDictAttack);
+    state = mf_classic_dict_attack_stage_enter(
+        state, nfc_scene_mf_classic_dict_attack_prepare_stage, instance);
+
     instance->nfc_dict_context.dict_keys_total =
         keys_dict_get_total_keys(instance->nfc_dict_context.dict);
     dict_attack_set_total_dict_keys(
@@ -230,8 +294,16 @@ static void nfc_scene_mf_classic_dict_attack_prepare_view(NfcApp* instance) {
 void nfc_scene_mf_classic_dict_attack_on_enter(void* context) {
     NfcApp* instance = context;
 
+    instance->nfc_dict_context.key_index =
+        mf_classic_key_index_alloc(NFC_APP_MF_CLASSIC_KEY_INDEX_SIZE);
+    mf_classic_key_index_load(
+        instance->nfc_dict_context.key_index, NFC_APP_MF_CLASSIC_KEY_INDEX_PATH);
+    // Keys of the first key index stage are kept to skip them on requery
+    instance->nfc_dict_context.key_index_keys =
+        malloc(NFC_APP_MF_CLASSIC_KEY_INDEX_KEYS_MAX * 2 * sizeof(MfClassicKey));
+
     scene_manager_set_scene_state(
-        instance->scene_manager, NfcSceneMfClassicDictAttack, DictAttackStateCUIDDictInProgress);
+        instance->scene_manager, NfcSceneMfClassicDictAttack, MfClassicDictAttackStageKeyIndex);
     nfc_scene_mf_classic_dict_attack_prepare_view(instance);
     dict_attack_set_card_state(instance->dict_attack, true);
     view_dispatcher_switch_to_view(instance->view_dispatcher, NfcViewDictAttack);
@@ -252,6 +324,56 @@ static void nfc_scene_mf_classic_dict_attack_notify_read(NfcApp* instance) {
     }
 }
 
+static void nfc_scene_mf_classic_dict_attack_update_key_index_stats(NfcApp* instance) {
+    NfcMfClassicDictAttackContext* mfc_dict = &instance->nfc_dict_context;
+    const MfClassicData* mfc_data = nfc_poller_get_data(instance->poller);
+
+    size_t hits = mf_classic_key_index_update_stats(
+        mfc_dict->key_index,
+        &mfc_dict->key_index_keys[mfc_dict->key_index_keys_tried],
+        mfc_dict->key_index_keys_num,
+        mfc_data);
+    const MfClassicKeyIndexStats* stats = mf_classic_key_index_get_stats(mfc_dict->key_index);
+    FURI_LOG_I(
+        TAG,
+        "Key index: %zu of %zu keys hit, %lu of %lu in %lu lookups",
+        hits,
+        mfc_dict->key_index_keys_num,
+        stats->hits,
+        stats->suggested,
+        stats->lookups);
+}
+
+static void
+    nfc_scene_mf_classic_dict_attack_next_dict(NfcApp* instance, MfClassicDictAttackStage state) {
+    nfc_poller_stop(instance->poller);
+    nfc_poller_free(instance->poller);
+    keys_dict_free(instance->nfc_dict_context.dict);
+    scene_manager_set_scene_state(instance->scene_manager, NfcSceneMfClassicDictAttack, state);
+    nfc_scene_mf_classic_dict_attack_prepare_view(instance);
+    instance->poller = nfc_poller_alloc(instance->nfc, NfcProtocolMfClassic);
+    nfc_poller_start(instance->poller, nfc_dict_attack_worker_callback, instance);
+}
+
+static void nfc_scene_mf_classic_dict_attack_finish(NfcApp* instance) {
+    MfClassicKeyIndex* key_index = instance->nfc_dict_context.key_index;
+    const MfClassicData* mfc_data =
+        nfc_device_get_data(instance->nfc_device, NfcProtocolMfClassic);
+
+    // Next cards of the same family will try the keys found on this one first
+    if(!mf_classic_key_index_add(key_index, mfc_data)) {
+        FURI_LOG_D(TAG, "Key index: card was read before");
+    }
+    storage_simply_mkdir(instance->storage, NFC_APP_CACHE_FOLDER);
+    if(!mf_classic_key_index_save(key_index, NFC_APP_MF_CLASSIC_KEY_INDEX_PATH)) {
+        FURI_LOG_E(TAG, "Failed to save key index");
+    }
+
+    nfc_scene_mf_classic_dict_attack_notify_read(instance);
+    scene_manager_next_scene(instance->scene_manager, NfcSceneReadSuccess);
+    dolphin_deed(DolphinDeedNfcReadSuccess);
+}
+
 bool nfc_scene_mf_classic_dict_attack_on_event(void* context, SceneManagerEvent event) {
     NfcApp* instance = context;
     bool consumed = false;
@@ -262,36 +384,24 @@ bool nfc_scene_mf_classic_dict_attack_on_event(void* context, SceneManagerEvent
         if(event.event == NfcCustomEventDictAttackComplete) {
             bool ran_nested_dict = instance->nfc_dict_context.nested_phase !=
                                    MfClassicNestedPhaseNone;
-            if(state == DictAttackStateCUIDDictInProgress) {
-                nfc_poller_stop(instance->poller);
-                nfc_poller_free(instance->poller);
-                keys_dict_free(instance->nfc_dict_context.dict);
-                scene_manager_set_scene_state(
-                    instance->scene_manager,
-                    NfcSceneMfClassicDictAttack,
-                    DictAttackStateUserDictInProgress);
-                nfc_scene_mf_classic_dict_attack_prepare_view(instance);
-                instance->poller = nfc_poller_alloc(instance->nfc, NfcProtocolMfClassic);
-                nfc_poller_start(instance->poller, nfc_dict_attack_worker_callback, instance);
-                consumed = true;
-            } else if(state == DictAttackStateUserDictInProgress && !(ran_nested_dict)) {
-                nfc_poller_stop(instance->poller);
-                nfc_poller_free(instance->poller);
-                keys_dict_free(instance->nfc_dict_context.dict);
-                scene_manager_set_scene_state(
-                    instance->scene_manager,
-                    NfcSceneMfClassicDictAttack,
-                    DictAttackStateSystemDictInProgress);
-                nfc_scene_mf_classic_dict_attack_prepare_view(instance);
-                instance->poller = nfc_poller_alloc(instance->nfc, NfcProtocolMfClassic);
-                nfc_poller_start(instance->poller, nfc_dict_attack_worker_callback, instance);
-                consumed = true;
+            if(state == MfClassicDictAttackStageKeyIndex) {
+                nfc_scene_mf_classic_dict_attack_update_key_index_stats(instance);
+                nfc_scene_mf_classic_dict_attack_next_dict(
+                    instance, MfClassicDictAttackStageCuidDict);
+            } else if(state == MfClassicDictAttackStageCuidDict) {
+                nfc_scene_mf_classic_dict_attack_next_dict(
+                    instance, MfClassicDictAttackStageKeyIndexRequery);
+            } else if(state == MfClassicDictAttackStageKeyIndexRequery) {
+                nfc_scene_mf_classic_dict_attack_update_key_index_stats(instance);
+                nfc_scene_mf_classic_dict_attack_next_dict(
+                    instance, MfClassicDictAttackStageUserDict);
+            } else if(state == MfClassicDictAttackStageUserDict && !(ran_nested_dict)) {
+                nfc_scene_mf_classic_dict_attack_next_dict(
+                    instance, MfClassicDictAttackStageSystemDict);
             } else {
-                nfc_scene_mf_classic_dict_attack_notify_read(instance);
-                scene_manager_next_scene(instance->scene_manager, NfcSceneReadSuccess);
-                dolphin_deed(DolphinDeedNfcReadSuccess);
-                consumed = true;
+                nfc_scene_mf_classic_dict_attack_finish(instance);
             }
+            consumed = true;
         } else if(event.event == NfcCustomEventCardDetected) {
             dict_attack_set_card_state(instance->dict_attack, true);
             consumed = true;
@@ -305,48 +415,29 @@ bool nfc_scene_mf_classic_dict_attack_on_event(void* context, SceneManagerEvent
             nfc_device_set_data(instance->nfc_device, NfcProtocolMfClassic, mfc_data);
             bool ran_nested_dict = instance->nfc_dict_context.nested_phase !=
                                    MfClassicNestedPhaseNone;
-            if(state == DictAttackStateCUIDDictInProgress) {
-                if(instance->nfc_dict_context.is_card_present) {
-                    nfc_poller_stop(instance->poller);
-                    nfc_poller_free(instance->poller);
-                    keys_dict_free(instance->nfc_dict_context.dict);
-                    scene_manager_set_scene_state(
-                        instance->scene_manager,
-                        NfcSceneMfClassicDictAttack,
-                        DictAttackStateUserDictInProgress);
-                    nfc_scene_mf_classic_dict_attack_prepare_view(instance);
-                    instance->poller = nfc_poller_alloc(instance->nfc, NfcProtocolMfClassic);
-                    nfc_poller_start(instance->poller, nfc_dict_attack_worker_callback, instance);
-                } else {
-                    nfc_scene_mf_classic_dict_attack_notify_read(instance);
-                    scene_manager_next_scene(instance->scene_manager, NfcSceneReadSuccess);
-                    dolphin_deed(DolphinDeedNfcReadSuccess);
-                }
-                consumed = true;
-            } else if(state == DictAttackStateUserDictInProgress && !(ran_nested_dict)) {
-                if(instance->nfc_dict_context.is_card_present) {
-                    nfc_poller_stop(instance->poller);
-                    nfc_poller_free(instance->poller);
-                    keys_dict_free(instance->nfc_dict_context.dict);
-                    scene_manager_set_scene_state(
-                        instance->scene_manager,
-                        NfcSceneMfClassicDictAttack,
-                        DictAttackStateSystemDictInProgress);
-                    nfc_scene_mf_classic_dict_attack_prepare_view(instance);
-                    instance->poller = nfc_poller_alloc(instance->nfc, NfcProtocolMfClassic);
-                    nfc_poller_start(instance->poller, nfc_dict_attack_worker_callback, instance);
-                } else {
-                    nfc_scene_mf_classic_dict_attack_notify_read(instance);
-                    scene_manager_next_scene(instance->scene_manager, NfcSceneReadSuccess);
-                    dolphin_deed(DolphinDeedNfcReadSuccess);
-                }
-                consumed = true;
+            bool is_card_present = instance->nfc_dict_context.is_card_present;
+            if(state == MfClassicDictAttackStageKeyIndex ||
+               state == MfClassicDictAttackStageKeyIndexRequery) {
+                nfc_scene_mf_classic_dict_attack_update_key_index_stats(instance);
+            }
+            if(state == MfClassicDictAttackStageKeyIndex && is_card_present) {
+                nfc_scene_mf_classic_dict_attack_next_dict(
+                    instance, MfClassicDictAttackStageCuidDict);
+            } else if(state == MfClassicDictAttackStageCuidDict && is_card_present) {
+                nfc_scene_mf_classic_dict_attack_next_dict(
+                    instance, MfClassicDictAttackStageKeyIndexRequery);
+            } else if(state == MfClassicDictAttackStageKeyIndexRequery && is_card_present) {
+                nfc_scene_mf_classic_dict_attack_next_dict(
+                    instance, MfClassicDictAttackStageUserDict);
+            } else if(
+                state == MfClassicDictAttackStageUserDict && !(ran_nested_dict) &&
+                is_card_present) {
+                nfc_scene_mf_classic_dict_attack_next_dict(
+                    instance, MfClassicDictAttackStageSystemDict);
             } else {
-                nfc_scene_mf_classic_dict_attack_notify_read(instance);
-                scene_manager_next_scene(instance->scene_manager, NfcSceneReadSuccess);
-                dolphin_deed(DolphinDeedNfcReadSuccess);
-                consumed = true;
+                nfc_scene_mf_classic_dict_attack_finish(instance);
             }
+            consumed = true;
         }
     } else if(event.type == SceneManagerEventTypeBack) {
         scene_manager_next_scene(instance->scene_manager, NfcSceneExitConfirm);
@@ -363,9 +454,11 @@ void nfc_scene_mf_classic_dict_attack_on_exit(void* context) {
 
     dict_attack_reset(instance->dict_attack);
     scene_manager_set_scene_state(
-        instance->scene_manager, NfcSceneMfClassicDictAttack, DictAttackStateCUIDDictInProgress);
+        instance->scene_manager, NfcSceneMfClassicDictAttack, MfClassicDictAttackStageKeyIndex);
 
     keys_dict_free(instance->nfc_dict_context.dict);
+    mf_classic_key_index_free(instance->nfc_dict_context.key_index);
+    free(instance->nfc_dict_context.key_index_keys);
 
     instance->nfc_dict_context.current_sector = 0;
     instance->nfc_dict_context.sectors_total = 0;
@@ -382,6 +475,10 @@ void nfc_scene_mf_classic_dict_attack_on_exit(void* context) {
     instance->nfc_dict_context.nested_target_key = 0;
     instance->nfc_dict_context.msb_count = 0;
     instance->nfc_dict_context.enhanced_dict = false;
+    instance->nfc_dict_context.key_index = NULL;
+    instance->nfc_dict_context.key_index_keys = NULL;
+    instance->nfc_dict_context.key_index_keys_tried = 0;
+    instance->nfc_dict_context.key_index_keys_num = 0;
 
     // Clean up temporary files used for nested dictionary attack
     if(keys_dict_check_presence(NFC_APP_MF_CLASSIC_DICT_USER_NESTED_PATH)) {
@@ -390,6 +487,7 @@ void nfc_scene_mf_classic_dict_attack_on_exit(void* context) {
     if(keys_dict_check_presence(NFC_APP_MF_CLASSIC_DICT_SYSTEM_NESTED_PATH)) {
         storage_common_remove(instance->storage, NFC_APP_MF_CLASSIC_DICT_SYSTEM_NESTED_PATH);
     }
+    storage_simply_remove(instance->storage, NFC_APP_MF_CLASSIC_DICT_INDEX_PATH);
 
     nfc_blink_stop(instance);
     notification_message(instance->notifications, &sequence_display_backlight_enforce_auto);
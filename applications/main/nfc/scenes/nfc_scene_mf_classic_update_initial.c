@@ -25,24 +25,13 @@ NfcCommand nfc_mf_classic_update_initial_worker_callback(NfcGenericEvent event,
         const MfClassicData* old_data =
             nfc_device_get_data(instance->nfc_device, NfcProtocolMfClassic);
         if(iso14443_3a_is_equal(updated_data->iso14443_3a_data, old_data->iso14443_3a_data)) {
-            mfc_event->data->poller_mode.mode = MfClassicPollerModeRead;
+            mfc_event->data->poller_mode.mode = MfClassicPollerModeReadFast;
+            mfc_event->data->poller_mode.keys =
+                mf_classic_key_cache_get_keys(instance->mfc_key_cache);
         } else {
             view_dispatcher_send_custom_event(instance->view_dispatcher, NfcCustomEventWrongCard);
             command = NfcCommandStop;
         }
-    } else if(mfc_event->type == MfClassicPollerEventTypeRequestReadSector) {
-        uint8_t sector_num = 0;
-        MfClassicKey key = {};
-        MfClassicKeyType key_type = MfClassicKeyTypeA;
-        if(mf_classic_key_cahce_get_next_key(
-               instance->mfc_key_cache, &sector_num, &key, &key_type)) {
-            mfc_event->data->read_sector_request_data.sector_num = sector_num;
-            mfc_event->data->read_sector_request_data.key = key;
-            mfc_event->data->read_sector_request_data.key_type = key_type;
-            mfc_event->data->read_sector_request_data.key_provided = true;
-        } else {
-            mfc_event->data->read_sector_request_data.key_provided = false;
-        }
     } else if(mfc_event->type == MfClassicPollerEventTypeSuccess) {
         const MfClassicData* updated_data = nfc_poller_get_data(instance->poller);
         nfc_device_set_data(instance->nfc_device, NfcProtocolMfClassic, updated_data);
@@ -10,6 +10,7 @@
 #include <notification/notification_app.h>
 #include <loader/loader.h>
 #include <lib/toolbox/args.h>
+#include <lib/toolbox/profiler.h>
 #include <lib/toolbox/strint.h>
 
 // Close to ISO, `date +'%Y-%m-%d %H:%M:%S %u'`
@@ -29,6 +30,7 @@ void cli_command_info_callback(const char* key, const char* value, bool last, vo
  * - device - print device info
  * - power - print power info
  * - power_debug - print power debug info
+ * - vcp - print USB VCP transfer statistics
  *
  * @param      cli      The cli instance
  * @param      args     The arguments
@@ -48,8 +50,10 @@ void cli_command_info(Cli* cli, FuriString* args, void* context) {
         furi_hal_power_info_get(cli_command_info_callback, '.', NULL);
     } else if(!furi_string_cmp(args, "power_debug")) {
         furi_hal_power_debug_get(cli_command_info_callback, NULL);
+    } else if(!furi_string_cmp(args, "vcp")) {
+        cli_vcp_info_get(cli_command_info_callback, '.', NULL);
     } else {
-        cli_print_usage("info", "<device|power|power_debug>", furi_string_get_cstr(args));
+        cli_print_usage("info", "<device|power|power_debug|vcp>", furi_string_get_cstr(args));
     }
 }
 
@@ -285,6 +289,29 @@ void cli_command_sysctl_heap_track(Cli* cli, FuriString* args, void* context) {
     }
 }
 
+void cli_command_sysctl_log_deferred(Cli* cli, FuriString* args, void* context) {
+    UNUSED(cli);
+    UNUSED(context);
+    if(!furi_string_cmp(args, "0")) {
+        furi_log_set_deferred(false);
+        printf("Deferred logging disabled.");
+    } else if(!furi_string_cmp(args, "1")) {
+        furi_log_set_deferred(true);
+        printf("Deferred logging enabled.");
+    } else if(furi_string_empty(args)) {
+        FuriLogDeferredStats stats;
+        furi_log_get_deferred_stats(&stats);
+        printf(
+            "Deferred logging %s, records: %lu binary, %lu text, %lu dropped",
+            furi_log_is_deferred() ? "enabled" : "disabled",
+            stats.binary,
+            stats.text,
+            stats.dropped);
+    } else {
+        cli_print_usage("sysctl log_deferred", "<1|0>", furi_string_get_cstr(args));
+    }
+}
+
 void cli_command_sysctl_print_usage(void) {
     printf("Usage:\r\n");
     printf("sysctl <cmd> <args>\r\n");
@@ -296,6 +323,7 @@ void cli_command_sysctl_print_usage(void) {
 #else
     printf("\theap_track <none|main>\t - Set heap allocation tracking mode\r\n");
 #endif
+    printf("\tlog_deferred <0|1>\t - Format logs in background thread\r\n");
 }
 
 void cli_command_sysctl(Cli* cli, FuriString* args, void* context) {
@@ -318,6 +346,11 @@ void cli_command_sysctl(Cli* cli, FuriString* args, void* context) {
             break;
         }
 
+        if(furi_string_cmp_str(cmd, "log_deferred") == 0) {
+            cli_command_sysctl_log_deferred(cli, args, context);
+            break;
+        }
+
         cli_command_sysctl_print_usage();
     } while(false);
 
@@ -472,6 +505,125 @@ static void cli_command_top(Cli* cli, FuriString* args, void* context) {
     furi_thread_list_free(thread_list);
 }
 
+#define CLI_PROFILER_DEPTH          (256U)
+#define CLI_PROFILER_DURATION_MS    (5000)
+#define CLI_PROFILER_FREQUENCY      (1000)
+#define CLI_PROFILER_READ_CHUNK     (32U)
+#define CLI_PROFILER_READ_PERIOD_MS (20)
+
+static void cli_command_profiler_threads(FuriThreadList* thread_list) {
+    furi_thread_enumerate(thread_list);
+    for(size_t i = 0; i < furi_thread_list_size(thread_list); i++) {
+        const FuriThreadListItem* item = furi_thread_list_get_at(thread_list, i);
+        printf("T 0x%08lx %s\r\n", (uint32_t)item->thread, item->name);
+    }
+}
+
+static void cli_command_profiler_sample(Cli* cli, FuriString* args) {
+    int duration = CLI_PROFILER_DURATION_MS;
+    int frequency = CLI_PROFILER_FREQUENCY;
+    args_read_int_and_trim(args, &duration);
+    args_read_int_and_trim(args, &frequency);
+
+    if(duration <= 0 || frequency < 10 || frequency > 10000) {
+        cli_print_usage("profiler sample", "[duration_ms] [10..10000 Hz]", "");
+        return;
+    }
+
+    ProfilerSampler* sampler = profiler_sampler_alloc(CLI_PROFILER_DEPTH);
+    ProfilerSample* samples = malloc(sizeof(ProfilerSample) * CLI_PROFILER_READ_CHUNK);
+    FuriThreadList* thread_list = furi_thread_list_alloc();
+
+    do {
+        if(!profiler_sampler_start(sampler, frequency)) {
+            printf("Sampling timer is busy\r\n");
+            break;
+        }
+
+        printf("Profiler: %d Hz, %d ms\r\n", frequency, duration);
+        cli_command_profiler_threads(thread_list);
+
+        // Samples are streamed as they come: thread, pc, lr or exception number
+        const uint32_t tick_start = furi_get_tick();
+        bool running = true;
+        while(true) {
+            running = running && (furi_get_tick() - tick_start < (uint32_t)duration) &&
+                      !cli_cmd_interrupt_received(cli);
+            if(!running) profiler_sampler_stop(sampler);
+
+            size_t count;
+            while((count = profiler_sampler_read(sampler, samples, CLI_PROFILER_READ_CHUNK))) {
+                for(size_t i = 0; i < count; i++) {
+                    if(samples[i].thread) {
+                        printf(
+                            "S 0x%08lx 0x%08lx 0x%08lx\r\n",
+                            (uint32_t)samples[i].thread,
+                            samples[i].pc,
+                            samples[i].lr);
+                    } else {
+                        const char* name = furi_hal_interrupt_get_name(samples[i].exception);
+                        printf("I %lu %s\r\n", samples[i].exception, name ? name : "-");
+                    }
+                }
+            }
+
+            if(!running) break;
+            furi_delay_ms(CLI_PROFILER_READ_PERIOD_MS);
+        }
+
+        // Catch threads started while sampling
+        cli_command_profiler_threads(thread_list);
+        printf("D %lu\r\n", profiler_sampler_get_dropped(sampler));
+    } while(false);
+
+    furi_thread_list_free(thread_list);
+    free(samples);
+    profiler_sampler_free(sampler);
+}
+
+static void cli_command_profiler_zones(FuriString* args) {
+    if(!furi_string_cmp(args, "1")) {
+        profiler_zones_set_enabled(true);
+    } else if(!furi_string_cmp(args, "0")) {
+        profiler_zones_set_enabled(false);
+    } else if(!furi_string_cmp(args, "reset")) {
+        profiler_zones_reset();
+    } else if(furi_string_empty(args)) {
+        printf("Zones %s\r\n", profiler_zones_is_enabled() ? "enabled" : "disabled");
+        profiler_zones_dump();
+    } else {
+        cli_print_usage("profiler zones", "<1|0|reset>", furi_string_get_cstr(args));
+    }
+}
+
+/** Profiler Command
+ *
+ * Arguments:
+ * - sample [duration_ms] [frequency] - sample running code, for scripts/profiler.py
+ * - zones [1|0|reset] - control and print scoped zone statistics
+ *
+ * @param      cli      The cli instance
+ * @param      args     The arguments
+ * @param      context  The context
+ */
+static void cli_command_profiler(Cli* cli, FuriString* args, void* context) {
+    UNUSED(context);
+
+    FuriString* cmd = furi_string_alloc();
+
+    if(!args_read_string_and_trim(args, cmd)) {
+        cli_print_usage("profiler", "<sample|zones>", furi_string_get_cstr(args));
+    } else if(furi_string_cmp_str(cmd, "sample") == 0) {
+        cli_command_profiler_sample(cli, args);
+    } else if(furi_string_cmp_str(cmd, "zones") == 0) {
+        cli_command_profiler_zones(args);
+    } else {
+        cli_print_usage("profiler", "<sample|zones>", furi_string_get_cstr(cmd));
+    }
+
+    furi_string_free(cmd);
+}
+
 void cli_command_free(Cli* cli, FuriString* args, void* context) {
     UNUSED(cli);
     UNUSED(args);
@@ -517,6 +669,105 @@ void cli_command_i2c(Cli* cli, FuriString* args, void* context) {
     furi_hal_i2c_release(&furi_hal_i2c_handle_external);
 }
 
+#define CLI_LOOPBACK_BUFFER_SIZE 512
+#define CLI_LOOPBACK_TIMEOUT_MS  1000
+
+static size_t cli_loopback_get_space(void* context) {
+    return furi_stream_buffer_spaces_available(context);
+}
+
+static void cli_loopback_receive(void* context, const uint8_t* data, size_t size) {
+    furi_stream_buffer_send(context, data, size, 0);
+}
+
+static const CliVcpConsumer cli_loopback_consumer = {
+    .get_space = cli_loopback_get_space,
+    .receive = cli_loopback_receive,
+};
+
+/** Loopback Command
+ *
+ * Echoes received data back to host, used to measure VCP throughput
+ *
+ * Arguments:
+ * - size - number of bytes to echo
+ * - direct - take data straight from VCP worker, same as RPC session does
+ *
+ * @param      cli      The cli instance
+ * @param      args     The arguments
+ * @param      context  The context
+ */
+static void cli_command_loopback(Cli* cli, FuriString* args, void* context) {
+    UNUSED(context);
+
+    int size = 0;
+    bool direct = false;
+    bool args_valid = false;
+    FuriString* mode = furi_string_alloc();
+
+    do {
+        if(!args_read_int_and_trim(args, &size) || size <= 0) break;
+        if(args_read_string_and_trim(args, mode)) {
+            if(furi_string_cmp(mode, "direct")) break;
+            direct = true;
+        }
+        args_valid = true;
+    } while(false);
+
+    furi_string_free(mode);
+
+    if(!args_valid) {
+        cli_print_usage("loopback", "<size> [direct]", furi_string_get_cstr(args));
+        return;
+    }
+
+    FuriStreamBuffer* stream = NULL;
+    if(direct) {
+        stream = furi_stream_buffer_alloc(CLI_LOOPBACK_BUFFER_SIZE * 2, 1);
+        if(!cli_vcp_set_consumer(&cli_loopback_consumer, stream)) {
+            printf("Direct mode is not available\r\n");
+            furi_stream_buffer_free(stream);
+            return;
+        }
+    }
+
+    // Host starts sending after this line
+    printf("Loopback %d bytes, %s\r\n", size, direct ? "direct" : "cli");
+
+    uint8_t* buffer = malloc(CLI_LOOPBACK_BUFFER_SIZE);
+    size_t done = 0;
+    uint32_t tick_start = 0;
+
+    while(done < (size_t)size && cli_is_connected(cli)) {
+        size_t len = MIN((size_t)size - done, CLI_LOOPBACK_BUFFER_SIZE);
+        if(direct) {
+            len = furi_stream_buffer_receive(stream, buffer, len, CLI_LOOPBACK_TIMEOUT_MS);
+            cli_vcp_consumer_ready();
+        } else {
+            len = cli_read_timeout(cli, buffer, len, CLI_LOOPBACK_TIMEOUT_MS);
+        }
+        if(!len) break;
+
+        if(!done) tick_start = furi_get_tick();
+        cli_write(cli, buffer, len);
+        done += len;
+    }
+
+    uint32_t elapsed_ms = furi_get_tick() - tick_start;
+
+    if(direct) {
+        cli_vcp_set_consumer(NULL, NULL);
+        furi_stream_buffer_free(stream);
+    }
+    free(buffer);
+
+    printf(
+        "\r\n%zu bytes in %lu ms, %lu B/s\r\n",
+        done,
+        elapsed_ms,
+        elapsed_ms ? (uint32_t)((uint64_t)done * 1000 / elapsed_ms) : 0);
+}
+
 void cli_commands_init(Cli* cli) {
     cli_add_command(cli, "!", CliCommandFlagParallelSafe, cli_command_info, (void*)true);
     cli_add_command(cli, "info", CliCommandFlagParallelSafe, cli_command_info, NULL);
@@ -532,8 +783,10 @@ void cli_commands_init(Cli* cli) {
     cli_add_command(cli, "l", CliCommandFlagParallelSafe, cli_command_log, NULL);
     cli_add_command(cli, "sysctl", CliCommandFlagDefault, cli_command_sysctl, NULL);
     cli_add_command(cli, "top", CliCommandFlagParallelSafe, cli_command_top, NULL);
+    cli_add_command(cli, "profiler", CliCommandFlagDefault, cli_command_profiler, NULL);
     cli_add_command(cli, "free", CliCommandFlagParallelSafe, cli_command_free, NULL);
     cli_add_command(cli, "free_blocks", CliCommandFlagParallelSafe, cli_command_free_blocks, NULL);
+    cli_add_command(cli, "loopback", CliCommandFlagDefault, cli_command_loopback, NULL);
 
     cli_add_command(cli, "vibro", CliCommandFlagDefault, cli_command_vibro, NULL);
     cli_add_command(cli, "led", CliCommandFlagDefault, cli_command_led, NULL);
@@ -6,8 +6,19 @@
 #define TAG "CliVcp"
 
 #define USB_CDC_PKT_LEN CDC_DATA_SZ
-#define VCP_RX_BUF_SIZE (USB_CDC_PKT_LEN * 3)
-#define VCP_TX_BUF_SIZE (USB_CDC_PKT_LEN * 3)
+
+// Buffer sizes in USB packets, can be overridden at build time
+#ifndef CLI_VCP_RX_BUF_PKT
+#define CLI_VCP_RX_BUF_PKT 8
+#endif
+#ifndef CLI_VCP_TX_BUF_PKT
+#define CLI_VCP_TX_BUF_PKT 16
+#endif
+
+#define VCP_RX_BUF_SIZE (USB_CDC_PKT_LEN * CLI_VCP_RX_BUF_PKT)
+#define VCP_TX_BUF_SIZE (USB_CDC_PKT_LEN * CLI_VCP_TX_BUF_PKT)
+// Keep half of Tx buffer free for the worker to drain while sender refills it
+#define VCP_TX_BATCH_SIZE (VCP_TX_BUF_SIZE / 2)
 
 #define VCP_IF_NUM 0
 
@@ -31,6 +42,13 @@ typedef enum {
     (VcpEvtStop | VcpEvtConnect | VcpEvtDisconnect | VcpEvtRx | VcpEvtTx | VcpEvtStreamRx | \
      VcpEvtStreamTx)
 
+typedef struct {
+    uint32_t rx_bytes;
+    uint32_t rx_direct_bytes;
+    uint32_t rx_stalls;
+    uint32_t tx_bytes;
+} CliVcpStats;
+
 typedef struct {
     FuriThread* thread;
 
@@ -42,6 +60,12 @@ typedef struct {
 
     FuriHalUsbInterface* usb_if_prev;
 
+    FuriMutex* consumer_mutex;
+    const CliVcpConsumer* consumer;
+    void* consumer_context;
+
+    CliVcpStats stats;
+
     uint8_t data_buffer[USB_CDC_PKT_LEN];
 } CliVcp;
 
@@ -69,6 +93,7 @@ static void cli_vcp_init(void) {
         vcp = malloc(sizeof(CliVcp));
         vcp->tx_stream = furi_stream_buffer_alloc(VCP_TX_BUF_SIZE, 1);
         vcp->rx_stream = furi_stream_buffer_alloc(VCP_RX_BUF_SIZE, 1);
+        vcp->consumer_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
     }
     furi_assert(vcp->thread == NULL);
 
@@ -87,6 +112,32 @@ static void cli_vcp_deinit(void) {
     vcp->thread = NULL;
 }
 
+static void vcp_tx_stream_flush(void) {
+    // Sender may be blocked waiting for a whole batch to fit
+    while(furi_stream_buffer_receive(vcp->tx_stream, vcp->data_buffer, USB_CDC_PKT_LEN, 0)) {
+    }
+}
+
+static size_t vcp_rx_space(void) {
+    if(vcp->consumer) {
+        return vcp->consumer->get_space(vcp->consumer_context);
+    } else {
+        return furi_stream_buffer_spaces_available(vcp->rx_stream);
+    }
+}
+
+static void vcp_rx_deliver(size_t len) {
+    vcp->stats.rx_bytes += len;
+    if(vcp->consumer) {
+        vcp->stats.rx_direct_bytes += len;
+        vcp->consumer->receive(vcp->consumer_context, vcp->data_buffer, len);
+    } else {
+        furi_check(
+            furi_stream_buffer_send(vcp->rx_stream, vcp->data_buffer, len, FuriWaitForever) ==
+            len);
+    }
+}
+
 static int32_t vcp_worker(void* context) {
     UNUSED(context);
     bool tx_idle = true;
@@ -124,37 +175,44 @@ static int32_t vcp_worker(void* context) {
 
             if(vcp->connected == true) {
                 vcp->connected = false;
-                furi_stream_buffer_receive(vcp->tx_stream, vcp->data_buffer, USB_CDC_PKT_LEN, 0);
+                vcp_tx_stream_flush();
                 furi_stream_buffer_send(vcp->rx_stream, &ascii_eot, 1, FuriWaitForever);
             }
         }
 
-        // Rx buffer was read, maybe there is enough space for new data?
-        if((flags & VcpEvtStreamRx) && (missed_rx > 0)) {
-            VCP_DEBUG("StreamRx");
+        // Rx path is chosen under lock, consumer can't be changed in the middle of a packet
+        if(flags & (VcpEvtStreamRx | VcpEvtRx)) {
+            furi_check(furi_mutex_acquire(vcp->consumer_mutex, FuriWaitForever) == FuriStatusOk);
+
+            // Rx buffer was read, maybe there is enough space for new data?
+            if((flags & VcpEvtStreamRx) && (missed_rx > 0)) {
+                VCP_DEBUG("StreamRx");
 
-            if(furi_stream_buffer_spaces_available(vcp->rx_stream) >= USB_CDC_PKT_LEN) {
-                flags |= VcpEvtRx;
-                missed_rx--;
+                if(vcp_rx_space() >= USB_CDC_PKT_LEN) {
+                    flags |= VcpEvtRx;
+                    missed_rx--;
+                }
             }
-        }
 
-        // New data received
-        if(flags & VcpEvtRx) {
-            if(furi_stream_buffer_spaces_available(vcp->rx_stream) >= USB_CDC_PKT_LEN) {
-                int32_t len = furi_hal_cdc_receive(VCP_IF_NUM, vcp->data_buffer, USB_CDC_PKT_LEN);
-                VCP_DEBUG("Rx %ld", len);
-
-                if(len > 0) {
-                    furi_check(
-                        furi_stream_buffer_send(
-                            vcp->rx_stream, vcp->data_buffer, len, FuriWaitForever) ==
-                        (size_t)len);
+            // New data received
+            if(flags & VcpEvtRx) {
+                if(vcp_rx_space() >= USB_CDC_PKT_LEN) {
+                    int32_t len =
+                        furi_hal_cdc_receive(VCP_IF_NUM, vcp->data_buffer, USB_CDC_PKT_LEN);
+                    VCP_DEBUG("Rx %ld", len);
+
+                    if(len > 0) {
+                        vcp_rx_deliver(len);
+                    }
+                } else {
+                    // Packet stays in endpoint and host is NAKed until there is space
+                    VCP_DEBUG("Rx missed");
+                    vcp->stats.rx_stalls++;
+                    missed_rx++;
                 }
-            } else {
-                VCP_DEBUG("Rx missed");
-                missed_rx++;
             }
+
+            furi_check(furi_mutex_release(vcp->consumer_mutex) == FuriStatusOk);
         }
 
         // New data in Tx buffer
@@ -176,6 +234,7 @@ static int32_t vcp_worker(void* context) {
             if(len > 0) { // Some data left in Tx buffer. Sending it now
                 tx_idle = false;
                 furi_hal_cdc_send(VCP_IF_NUM, vcp->data_buffer, len);
+                vcp->stats.tx_bytes += len;
                 last_tx_pkt_len = len;
             } else { // There is nothing to send.
                 if(last_tx_pkt_len == 64) {
@@ -198,7 +257,7 @@ static int32_t vcp_worker(void* context) {
                 furi_hal_usb_unlock();
                 furi_hal_usb_set_config(vcp->usb_if_prev, NULL);
             }
-            furi_stream_buffer_receive(vcp->tx_stream, vcp->data_buffer, USB_CDC_PKT_LEN, 0);
+            vcp_tx_stream_flush();
             furi_stream_buffer_send(vcp->rx_stream, &ascii_eot, 1, FuriWaitForever);
             break;
         }
@@ -254,7 +313,7 @@ static void cli_vcp_tx(const uint8_t* buffer, size_t size) {
 
     while(size > 0 && vcp->connected) {
         size_t batch_size = size;
-        if(batch_size > USB_CDC_PKT_LEN) batch_size = USB_CDC_PKT_LEN;
+        if(batch_size > VCP_TX_BATCH_SIZE) batch_size = VCP_TX_BATCH_SIZE;
 
         furi_stream_buffer_send(vcp->tx_stream, buffer, batch_size, FuriWaitForever);
         furi_thread_flags_set(furi_thread_get_id(vcp->thread), VcpEvtStreamTx);
@@ -306,6 +365,78 @@ static bool cli_vcp_is_connected(void) {
     return vcp->connected;
 }
 
+bool cli_vcp_set_consumer(const CliVcpConsumer* consumer, void* context) {
+    furi_check(vcp);
+
+    bool success = false;
+    furi_check(furi_mutex_acquire(vcp->consumer_mutex, FuriWaitForever) == FuriStatusOk);
+
+    do {
+        if(consumer) {
+            furi_check(consumer->get_space);
+            furi_check(consumer->receive);
+            if(!vcp->running) break;
+
+            // Keep byte order: data already buffered for CLI goes first
+            size_t pending = furi_stream_buffer_bytes_available(vcp->rx_stream);
+            if(consumer->get_space(context) < pending) break;
+
+            uint8_t buffer[USB_CDC_PKT_LEN];
+            size_t len;
+            while((len = furi_stream_buffer_receive(vcp->rx_stream, buffer, sizeof(buffer), 0))) {
+                consumer->receive(context, buffer, len);
+            }
+        }
+
+        vcp->consumer = consumer;
+        vcp->consumer_context = context;
+        success = true;
+    } while(false);
+
+    furi_check(furi_mutex_release(vcp->consumer_mutex) == FuriStatusOk);
+
+    // Receiving side has changed, packets held in endpoint may fit now
+    if(success) cli_vcp_consumer_ready();
+
+    return success;
+}
+
+void cli_vcp_consumer_ready(void) {
+    furi_check(vcp);
+    if(vcp->thread) {
+        furi_thread_flags_set(furi_thread_get_id(vcp->thread), VcpEvtStreamRx);
+    }
+}
+
+void cli_vcp_info_get(PropertyValueCallback out, char sep, void* context) {
+    furi_check(out);
+
+    FuriString* key = furi_string_alloc();
+    FuriString* value = furi_string_alloc();
+
+    PropertyValueContext property_context = {
+        .key = key, .value = value, .out = out, .sep = sep, .last = false, .context = context};
+
+    CliVcpStats stats = {0};
+    bool direct = false;
+    if(vcp) {
+        stats = vcp->stats;
+        direct = vcp->consumer != NULL;
+    }
+
+    property_value_out(&property_context, "%d", 3, "vcp", "rx", "buffer", VCP_RX_BUF_SIZE);
+    property_value_out(&property_context, "%d", 3, "vcp", "tx", "buffer", VCP_TX_BUF_SIZE);
+    property_value_out(&property_context, "%lu", 3, "vcp", "rx", "bytes", stats.rx_bytes);
+    property_value_out(&property_context, "%lu", 3, "vcp", "rx", "direct", stats.rx_direct_bytes);
+    property_value_out(&property_context, "%lu", 3, "vcp", "rx", "stalls", stats.rx_stalls);
+    property_value_out(&property_context, "%lu", 3, "vcp", "tx", "bytes", stats.tx_bytes);
+    property_context.last = true;
+    property_value_out(&property_context, NULL, 2, "vcp", "consumer", direct ? "direct" : "cli");
+
+    furi_string_free(key);
+    furi_string_free(value);
+}
+
 CliSession cli_vcp = {
     cli_vcp_init,
     cli_vcp_deinit,
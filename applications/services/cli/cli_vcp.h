@@ -5,6 +5,10 @@
 
 #pragma once
 
+#include <stddef.h>
+#include <stdint.h>
+#include <toolbox/property.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -13,6 +17,44 @@ typedef struct CliSession CliSession;
 
 extern CliSession cli_vcp;
 
+/** Direct VCP data consumer
+ *
+ * Consumer receives USB packets right from VCP worker, bypassing CLI byte
+ * stream. Both callbacks are called from VCP worker thread and must not block.
+ */
+typedef struct {
+    /** Get free space in consumer buffer, packet is handed over only if it fits */
+    size_t (*get_space)(void* context);
+    /** Consume received packet */
+    void (*receive)(void* context, const uint8_t* data, size_t size);
+} CliVcpConsumer;
+
+/** Set direct VCP data consumer
+ *
+ * Data already buffered in CLI byte stream is passed to consumer first.
+ *
+ * @param      consumer  consumer callbacks, NULL to return data to CLI
+ * @param      context   consumer context
+ *
+ * @return     true if consumer is set, false if VCP is not running or
+ *             buffered data does not fit into consumer
+ */
+bool cli_vcp_set_consumer(const CliVcpConsumer* consumer, void* context);
+
+/** Notify VCP that consumer has freed some space
+ *
+ * Received packets that did not fit are held in USB endpoint until then.
+ */
+void cli_vcp_consumer_ready(void);
+
+/** Get VCP transfer statistics
+ *
+ * @param      out      property value output callback
+ * @param      sep      key parts separator
+ * @param      context  output callback context
+ */
+void cli_vcp_info_get(PropertyValueCallback out, char sep, void* context);
+
 #ifdef __cplusplus
 }
 #endif
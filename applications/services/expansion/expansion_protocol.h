@@ -29,6 +29,16 @@ extern "C" {
  */
 #define EXPANSION_PROTOCOL_MAX_DATA_SIZE (64U)
 
+/**
+ * @brief Maximum data size per bulk data frame, in bytes.
+ */
+#define EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE (256U)
+
+/**
+ * @brief Maximum number of unconfirmed data frames in bulk mode.
+ */
+#define EXPANSION_PROTOCOL_BULK_WINDOW_SIZE (4U)
+
 /**
  * @brief Maximum allowed inactivity period, in milliseconds.
  */
@@ -48,6 +58,7 @@ typedef enum {
     ExpansionFrameTypeBaudRate = 3, /**< Baud rate negotiation frame. */
     ExpansionFrameTypeControl = 4, /**< Control frame. */
     ExpansionFrameTypeData = 5, /**< Data frame. */
+    ExpansionFrameTypeBulkData = 6, /**< Bulk data frame. */
     ExpansionFrameTypeReserved, /**< Special value. */
 } ExpansionFrameType;
 
@@ -86,6 +97,13 @@ typedef enum {
       * otherwise OTG is to be controlled via RPC messages.
       */
     ExpansionFrameControlCommandDisableOtg = 0x03,
+    /** @brief Enable bulk data mode.
+      *
+      * Must only be used while the RPC session is NOT active.
+      * Once enabled, both sides may send bulk data frames and keep up to
+      * EXPANSION_PROTOCOL_BULK_WINDOW_SIZE data frames unconfirmed.
+      */
+    ExpansionFrameControlCommandEnableBulk = 0x04,
 } ExpansionFrameControlCommand;
 
 #pragma pack(push, 1)
@@ -135,6 +153,16 @@ typedef struct {
     uint8_t bytes[EXPANSION_PROTOCOL_MAX_DATA_SIZE];
 } ExpansionFrameData;
 
+/**
+ * @brief Bulk data frame contents.
+ */
+typedef struct {
+    /** Size of the data. Must be less than EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE. */
+    uint16_t size;
+    /** Data bytes. Valid only up to ExpansionFrameBulkData::size bytes. */
+    uint8_t bytes[EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE];
+} ExpansionFrameBulkData;
+
 /**
  * @brief Expansion protocol frame structure.
  */
@@ -146,6 +174,7 @@ typedef struct {
         ExpansionFrameBaudRate baud_rate; /**< Baud rate frame contents. */
         ExpansionFrameControl control; /**< Control frame contents. */
         ExpansionFrameData data; /**< Data frame contents. */
+        ExpansionFrameBulkData bulk_data; /**< Bulk data frame contents. */
     } content; /**< Contents of the frame. */
 } ExpansionFrame;
 
@@ -200,6 +229,9 @@ static inline size_t expansion_frame_get_encoded_size(const ExpansionFrame* fram
         return sizeof(frame->header) + sizeof(frame->content.control);
     case ExpansionFrameTypeData:
         return sizeof(frame->header) + sizeof(frame->content.data.size) + frame->content.data.size;
+    case ExpansionFrameTypeBulkData:
+        return sizeof(frame->header) + sizeof(frame->content.bulk_data.size) +
+               frame->content.bulk_data.size;
     default:
         return 0;
     }
@@ -253,6 +285,17 @@ static inline bool expansion_frame_get_remaining_size(
             content_size = sizeof(frame->content.data.size) + frame->content.data.size;
         }
         break;
+    case ExpansionFrameTypeBulkData:
+        if(received_content_size < sizeof(frame->content.bulk_data.size)) {
+            // Data size is unknown as of now
+            content_size = sizeof(frame->content.bulk_data.size);
+        } else if(frame->content.bulk_data.size > sizeof(frame->content.bulk_data.bytes)) {
+            // Malformed frame or garbage input
+            return false;
+        } else {
+            content_size = sizeof(frame->content.bulk_data.size) + frame->content.bulk_data.size;
+        }
+        break;
     default:
         return false;
     }
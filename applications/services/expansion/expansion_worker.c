@@ -11,8 +11,13 @@
 
 #define TAG "ExpansionSrv"
 
-#define EXPANSION_WORKER_STACK_SZIE  (768UL)
-#define EXPANSION_WORKER_BUFFER_SIZE (sizeof(ExpansionFrame) + sizeof(ExpansionFrameChecksum))
+#define EXPANSION_WORKER_STACK_SZIE     (768UL)
+#define EXPANSION_WORKER_DMA_CHUNK_SIZE (64UL)
+#define EXPANSION_WORKER_FRAME_SIZE     (sizeof(ExpansionFrame) + sizeof(ExpansionFrameChecksum))
+
+// Room for a full window of bulk frames and the confirmations sent behind them
+#define EXPANSION_WORKER_BUFFER_SIZE \
+    (EXPANSION_WORKER_FRAME_SIZE * (EXPANSION_PROTOCOL_BULK_WINDOW_SIZE + 1))
 
 typedef enum {
     ExpansionWorkerStateHandShake,
@@ -31,14 +36,17 @@ typedef enum {
     ExpansionWorkerFlagStop = 1 << 0,
     ExpansionWorkerFlagData = 1 << 1,
     ExpansionWorkerFlagError = 1 << 2,
+    ExpansionWorkerFlagRpcReady = 1 << 3,
 } ExpansionWorkerFlag;
 
-#define EXPANSION_ALL_FLAGS (ExpansionWorkerFlagData | ExpansionWorkerFlagStop)
+#define EXPANSION_ALL_FLAGS \
+    (ExpansionWorkerFlagData | ExpansionWorkerFlagStop | ExpansionWorkerFlagRpcReady)
 
 struct ExpansionWorker {
     FuriThread* thread;
     FuriStreamBuffer* rx_buf;
     FuriSemaphore* tx_semaphore;
+    FuriMutex* tx_mutex;
 
     FuriHalSerialId serial_id;
     FuriHalSerialHandle* serial_handle;
@@ -49,12 +57,23 @@ struct ExpansionWorker {
     ExpansionWorkerExitReason exit_reason;
     ExpansionWorkerCallback callback;
     void* cb_context;
+
+    bool bulk_mode;
+    // Frames are too large for worker and RPC thread stacks, every frame is built in place
+    ExpansionFrame rx_frame;
+    ExpansionFrame tx_frame;
+    // Bulk mode payloads not yet taken by the RPC session, confirmed one by one once fed
+    ExpansionFrameBulkData bulk_rx[EXPANSION_PROTOCOL_BULK_WINDOW_SIZE];
+    size_t bulk_rx_head;
+    size_t bulk_rx_count;
+    size_t bulk_rx_offset;
 };
 
 // Called in UART IRQ context
 static void expansion_worker_serial_rx_callback(
     FuriHalSerialHandle* handle,
     FuriHalSerialRxEvent event,
+    size_t data_len,
     void* context) {
     furi_assert(handle);
     furi_assert(context);
@@ -64,15 +83,20 @@ static void expansion_worker_serial_rx_callback(
     if(event & (FuriHalSerialRxEventNoiseError | FuriHalSerialRxEventFrameError |
                 FuriHalSerialRxEventOverrunError)) {
         furi_thread_flags_set(furi_thread_get_id(instance->thread), ExpansionWorkerFlagError);
-    } else if(event & FuriHalSerialRxEventData) {
-        while(furi_hal_serial_async_rx_available(handle)) {
-            const uint8_t data = furi_hal_serial_async_rx(handle);
-            furi_stream_buffer_send(instance->rx_buf, &data, sizeof(data), 0);
+    } else if(event & (FuriHalSerialRxEventData | FuriHalSerialRxEventIdle)) {
+        uint8_t data[EXPANSION_WORKER_DMA_CHUNK_SIZE];
+        while(data_len) {
+            const size_t chunk_size = furi_hal_serial_dma_rx(
+                handle, data, MIN(data_len, EXPANSION_WORKER_DMA_CHUNK_SIZE));
+            furi_stream_buffer_send(instance->rx_buf, data, chunk_size, 0);
+            data_len -= chunk_size;
         }
         furi_thread_flags_set(furi_thread_get_id(instance->thread), ExpansionWorkerFlagData);
     }
 }
 
+static bool expansion_worker_bulk_rx_flush(ExpansionWorker* instance);
+
 static size_t expansion_worker_receive_callback(uint8_t* data, size_t data_size, void* context) {
     ExpansionWorker* instance = context;
 
@@ -84,6 +108,12 @@ static size_t expansion_worker_receive_callback(uint8_t* data, size_t data_size,
 
         if(received_size == data_size) break;
 
+        // Keep draining queued bulk data while waiting for the rest of the frame
+        if(!expansion_worker_bulk_rx_flush(instance)) {
+            instance->exit_reason = ExpansionWorkerExitReasonError;
+            break;
+        }
+
         const uint32_t flags = furi_thread_flags_wait(
             EXPANSION_ALL_FLAGS, FuriFlagWaitAny, furi_ms_to_ticks(EXPANSION_PROTOCOL_TIMEOUT_MS));
 
@@ -104,8 +134,8 @@ static size_t expansion_worker_receive_callback(uint8_t* data, size_t data_size,
             // Exiting due to RPC error
             instance->exit_reason = ExpansionWorkerExitReasonError;
             break;
-        } else if(flags & ExpansionWorkerFlagData) {
-            // Go to buffer reading
+        } else if(flags & (ExpansionWorkerFlagData | ExpansionWorkerFlagRpcReady)) {
+            // Go to buffer reading and bulk data feeding
             continue;
         }
     }
@@ -127,49 +157,119 @@ static size_t
     return data_size;
 }
 
-static inline bool
-    expansion_worker_send_frame(ExpansionWorker* instance, const ExpansionFrame* frame) {
-    return expansion_protocol_encode(frame, expansion_worker_send_callback, instance) ==
-           ExpansionProtocolStatusOk;
+// Called from both worker and RPC session threads, tx_frame is guarded by tx_mutex
+static inline ExpansionFrame* expansion_worker_tx_frame_acquire(ExpansionWorker* instance) {
+    furi_check(furi_mutex_acquire(instance->tx_mutex, FuriWaitForever) == FuriStatusOk);
+    return &instance->tx_frame;
+}
+
+static inline bool expansion_worker_tx_frame_send_release(ExpansionWorker* instance) {
+    const bool success = expansion_protocol_encode(
+                             &instance->tx_frame, expansion_worker_send_callback, instance) ==
+                         ExpansionProtocolStatusOk;
+    furi_check(furi_mutex_release(instance->tx_mutex) == FuriStatusOk);
+    return success;
 }
 
 static bool expansion_worker_send_heartbeat(ExpansionWorker* instance) {
-    const ExpansionFrame frame = {
-        .header.type = ExpansionFrameTypeHeartbeat,
-        .content.heartbeat = {},
-    };
+    ExpansionFrame* frame = expansion_worker_tx_frame_acquire(instance);
+    frame->header.type = ExpansionFrameTypeHeartbeat;
 
-    return expansion_worker_send_frame(instance, &frame);
+    return expansion_worker_tx_frame_send_release(instance);
 }
 
 static bool
     expansion_worker_send_status_response(ExpansionWorker* instance, ExpansionFrameError error) {
-    const ExpansionFrame frame = {
-        .header.type = ExpansionFrameTypeStatus,
-        .content.status.error = error,
-    };
+    ExpansionFrame* frame = expansion_worker_tx_frame_acquire(instance);
+    frame->header.type = ExpansionFrameTypeStatus;
+    frame->content.status.error = error;
 
-    return expansion_worker_send_frame(instance, &frame);
+    return expansion_worker_tx_frame_send_release(instance);
 }
 
-static bool expansion_worker_send_data_response(
+// Feeds queued bulk payloads without blocking, so that status frames behind them
+// still get through while the RPC session waits for its own sends to be confirmed
+static bool expansion_worker_bulk_rx_flush(ExpansionWorker* instance) {
+    bool success = true;
+
+    while(instance->bulk_rx_count) {
+        const ExpansionFrameBulkData* bulk_data = &instance->bulk_rx[instance->bulk_rx_head];
+        instance->bulk_rx_offset += rpc_session_feed(
+            instance->rpc_session,
+            bulk_data->bytes + instance->bulk_rx_offset,
+            bulk_data->size - instance->bulk_rx_offset,
+            0);
+        if(instance->bulk_rx_offset < bulk_data->size) break;
+
+        instance->bulk_rx_head =
+            (instance->bulk_rx_head + 1) % EXPANSION_PROTOCOL_BULK_WINDOW_SIZE;
+        instance->bulk_rx_count--;
+        instance->bulk_rx_offset = 0;
+
+        // Confirm only after the data is consumed, so the module can't overrun rx buffer
+        success = expansion_worker_send_status_response(instance, ExpansionFrameErrorNone);
+        if(!success) break;
+    }
+
+    return success;
+}
+
+static bool expansion_worker_bulk_rx_push(
     ExpansionWorker* instance,
     const uint8_t* data,
     size_t data_size) {
-    furi_assert(data_size <= EXPANSION_PROTOCOL_MAX_DATA_SIZE);
+    // Module may not have more unconfirmed frames than the window allows
+    if(instance->bulk_rx_count == EXPANSION_PROTOCOL_BULK_WINDOW_SIZE) return false;
+
+    const size_t tail =
+        (instance->bulk_rx_head + instance->bulk_rx_count) % EXPANSION_PROTOCOL_BULK_WINDOW_SIZE;
+    instance->bulk_rx[tail].size = data_size;
+    memcpy(instance->bulk_rx[tail].bytes, data, data_size);
+    instance->bulk_rx_count++;
 
-    ExpansionFrame frame = {
-        .header.type = ExpansionFrameTypeData,
-        .content.data.size = data_size,
-    };
+    return expansion_worker_bulk_rx_flush(instance);
+}
+
+static void expansion_worker_bulk_rx_reset(ExpansionWorker* instance) {
+    instance->bulk_rx_head = 0;
+    instance->bulk_rx_count = 0;
+    instance->bulk_rx_offset = 0;
+}
+
+// Called in Rpc session thread context
+static void expansion_worker_rpc_buffer_is_low_callback(void* context) {
+    ExpansionWorker* instance = context;
+    furi_thread_flags_set(furi_thread_get_id(instance->thread), ExpansionWorkerFlagRpcReady);
+}
+
+// Called in Rpc session thread context
+static bool expansion_worker_send_data_response(
+    ExpansionWorker* instance,
+    const uint8_t* data,
+    size_t data_size) {
+    ExpansionFrame* frame = expansion_worker_tx_frame_acquire(instance);
+
+    if(instance->bulk_mode) {
+        furi_assert(data_size <= EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE);
+        frame->header.type = ExpansionFrameTypeBulkData;
+        frame->content.bulk_data.size = data_size;
+        memcpy(frame->content.bulk_data.bytes, data, data_size);
+    } else {
+        furi_assert(data_size <= EXPANSION_PROTOCOL_MAX_DATA_SIZE);
+        frame->header.type = ExpansionFrameTypeData;
+        frame->content.data.size = data_size;
+        memcpy(frame->content.data.bytes, data, data_size);
+    }
 
-    memcpy(frame.content.data.bytes, data, data_size);
-    return expansion_worker_send_frame(instance, &frame);
+    return expansion_worker_tx_frame_send_release(instance);
 }
 
 // Called in Rpc session thread context
 static void expansion_worker_rpc_send_callback(void* context, uint8_t* data, size_t data_size) {
     ExpansionWorker* instance = context;
+    const size_t max_frame_data_size = instance->bulk_mode ?
+                                           EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE :
+                                           EXPANSION_PROTOCOL_MAX_DATA_SIZE;
 
     for(size_t sent_data_size = 0; sent_data_size < data_size;) {
         if(furi_semaphore_acquire(
@@ -179,8 +279,7 @@ static void expansion_worker_rpc_send_callback(void* context, uint8_t* data, siz
             break;
         }
 
-        const size_t current_data_size =
-            MIN(data_size - sent_data_size, EXPANSION_PROTOCOL_MAX_DATA_SIZE);
+        const size_t current_data_size = MIN(data_size - sent_data_size, max_frame_data_size);
         if(!expansion_worker_send_data_response(instance, data + sent_data_size, current_data_size))
             break;
         sent_data_size += current_data_size;
@@ -192,10 +291,15 @@ static bool expansion_worker_rpc_session_open(ExpansionWorker* instance) {
     instance->rpc_session = rpc_session_open(rpc, RpcOwnerUart);
 
     if(instance->rpc_session) {
-        instance->tx_semaphore = furi_semaphore_alloc(1, 1);
+        // Each semaphore token allows one unconfirmed data frame
+        const uint32_t window_size = instance->bulk_mode ? EXPANSION_PROTOCOL_BULK_WINDOW_SIZE : 1;
+        instance->tx_semaphore = furi_semaphore_alloc(window_size, window_size);
         rpc_session_set_context(instance->rpc_session, instance);
         rpc_session_set_send_bytes_callback(
             instance->rpc_session, expansion_worker_rpc_send_callback);
+        rpc_session_set_buffer_is_low_callback(
+            instance->rpc_session, expansion_worker_rpc_buffer_is_low_callback);
+        expansion_worker_bulk_rx_reset(instance);
     }
 
     return instance->rpc_session != NULL;
@@ -205,6 +309,8 @@ static void expansion_worker_rpc_session_close(ExpansionWorker* instance) {
     if(instance->rpc_session) {
         rpc_session_close(instance->rpc_session);
         furi_semaphore_free(instance->tx_semaphore);
+        // Data of a closed session is never confirmed
+        expansion_worker_bulk_rx_reset(instance);
     }
 
     furi_record_close(RECORD_RPC);
@@ -253,6 +359,9 @@ static bool expansion_worker_handle_state_connected(
                 if(!furi_hal_power_is_otg_enabled()) furi_hal_power_enable_otg();
             } else if(command == ExpansionFrameControlCommandDisableOtg) {
                 if(furi_hal_power_is_otg_enabled()) furi_hal_power_disable_otg();
+            } else if(command == ExpansionFrameControlCommandEnableBulk) {
+                instance->bulk_mode = true;
+                FURI_LOG_D(TAG, "Bulk mode enabled");
             } else {
                 break;
             }
@@ -277,7 +386,7 @@ static bool expansion_worker_handle_state_rpc_active(
     bool success = false;
 
     do {
-        if(rx_frame->header.type == ExpansionFrameTypeData) {
+        if(!instance->bulk_mode && rx_frame->header.type == ExpansionFrameTypeData) {
             if(!expansion_worker_send_status_response(instance, ExpansionFrameErrorNone)) break;
 
             const size_t size_consumed = rpc_session_feed(
@@ -287,6 +396,17 @@ static bool expansion_worker_handle_state_rpc_active(
                 EXPANSION_PROTOCOL_TIMEOUT_MS);
             if(size_consumed != rx_frame->content.data.size) break;
 
+        } else if(instance->bulk_mode && rx_frame->header.type == ExpansionFrameTypeData) {
+            // Queued behind earlier bulk data to keep the byte order
+            if(!expansion_worker_bulk_rx_push(
+                   instance, rx_frame->content.data.bytes, rx_frame->content.data.size))
+                break;
+
+        } else if(instance->bulk_mode && rx_frame->header.type == ExpansionFrameTypeBulkData) {
+            if(!expansion_worker_bulk_rx_push(
+                   instance, rx_frame->content.bulk_data.bytes, rx_frame->content.bulk_data.size))
+                break;
+
         } else if(rx_frame->header.type == ExpansionFrameTypeControl) {
             const uint8_t command = rx_frame->content.control.command;
             if(command == ExpansionFrameControlCommandStopRpc) {
@@ -323,11 +443,9 @@ static const ExpansionWorkerStateHandler expansion_handlers[] = {
 };
 
 static inline void expansion_worker_state_machine(ExpansionWorker* instance) {
-    ExpansionFrame rx_frame;
-
     while(true) {
-        if(!expansion_worker_receive_frame(instance, &rx_frame)) break;
-        if(!expansion_handlers[instance->state](instance, &rx_frame)) break;
+        if(!expansion_worker_receive_frame(instance, &instance->rx_frame)) break;
+        if(!expansion_handlers[instance->state](instance, &instance->rx_frame)) break;
     }
 }
 
@@ -344,10 +462,12 @@ static int32_t expansion_worker(void* context) {
 
     instance->state = ExpansionWorkerStateHandShake;
     instance->exit_reason = ExpansionWorkerExitReasonUnknown;
+    instance->bulk_mode = false;
+    expansion_worker_bulk_rx_reset(instance);
 
     furi_hal_serial_init(instance->serial_handle, EXPANSION_PROTOCOL_DEFAULT_BAUD_RATE);
 
-    furi_hal_serial_async_rx_start(
+    furi_hal_serial_dma_rx_start(
         instance->serial_handle, expansion_worker_serial_rx_callback, instance, true);
 
     if(expansion_worker_send_heartbeat(instance)) {
@@ -377,6 +497,7 @@ ExpansionWorker* expansion_worker_alloc(FuriHalSerialId serial_id) {
     instance->thread = furi_thread_alloc_ex(
         TAG "Worker", EXPANSION_WORKER_STACK_SZIE, expansion_worker, instance);
     instance->rx_buf = furi_stream_buffer_alloc(EXPANSION_WORKER_BUFFER_SIZE, 1);
+    instance->tx_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
     instance->serial_id = serial_id;
 
     // Improves responsiveness in heavy games at the expense of dropped frames
@@ -387,6 +508,7 @@ ExpansionWorker* expansion_worker_alloc(FuriHalSerialId serial_id) {
 
 void expansion_worker_free(ExpansionWorker* instance) {
     furi_stream_buffer_free(instance->rx_buf);
+    furi_mutex_free(instance->tx_mutex);
     furi_thread_join(instance->thread);
     furi_thread_free(instance->thread);
     free(instance);
@@ -1,5 +1,6 @@
 #include "gui_i.h"
 #include <assets_icons.h>
+#include <toolbox/profiler.h>
 
 #define TAG "GuiSrv"
 
@@ -242,6 +243,7 @@ static bool gui_redraw_desktop(Gui* gui) {
 
 static void gui_redraw(Gui* gui) {
     furi_assert(gui);
+    PROFILER_ZONE("gui_redraw");
     gui_lock(gui);
 
     do {
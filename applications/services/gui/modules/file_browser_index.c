@@ -0,0 +1,676 @@
+#include "file_browser_index.h"
+
+#include <storage/storage.h>
+#include <toolbox/stream/buffered_file_stream.h>
+#include <furi_hal_random.h>
+
+#define TAG "BrowserIndex"
+
+#define BROWSER_INDEX_FOLDER       EXT_PATH(".tmp/browser")
+#define BROWSER_INDEX_MAGIC        (0x58444942UL) // "BIDX"
+#define BROWSER_INDEX_VERSION      (2U)
+#define BROWSER_INDEX_RUN_LEN      (64U)
+#define BROWSER_INDEX_TAPE_COUNT   (4U)
+#define BROWSER_INDEX_NAME_LEN_MAX (256U)
+
+#define BROWSER_INDEX_TYPE_FOLDER 'D'
+#define BROWSER_INDEX_TYPE_FILE   'F'
+
+/* Index consists of two files:
+ * - "<key>.nam": one record per line, type character followed by item name
+ * - "<key>.idx": header, folder path and record offsets in "<key>.nam"
+ *
+ * Record type goes first so that case insensitive compare of records puts
+ * folders before files, exactly like file browser views sort their items.
+ *
+ * Entry count and fingerprint describe the folder before filtering, they are
+ * used to verify an index that was written in another epoch.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t epoch;
+    uint32_t config;
+    uint32_t count;
+    uint32_t entries;
+    uint32_t fingerprint;
+    uint32_t path_len;
+} BrowserIndexHeader;
+
+struct BrowserIndex {
+    Storage* storage;
+    File* offsets;
+    Stream* names;
+    bool is_open;
+    uint32_t count;
+    uint32_t offsets_start;
+    FuriString* file_path;
+    FuriString* record;
+};
+
+/* Every index file carries the epoch it was built or last verified in.
+ * Epoch changes when storage modification counter shows that anyone else has
+ * written to storage, and on every boot. Index of another epoch is used only
+ * after its folder fingerprint is checked. Epoch and tape files are shared by
+ * all worker instances and guarded by the mutex. */
+static FuriMutex* browser_index_mutex = NULL;
+static uint32_t browser_index_epoch = 0;
+static uint32_t browser_index_changes = 0;
+
+static uint32_t browser_index_key(FuriString* path, uint32_t config) {
+    // FNV-1a over path and filter configuration
+    uint32_t hash = 2166136261UL;
+    for(const char* str = furi_string_get_cstr(path); *str; str++) {
+        hash = (hash ^ (uint8_t)*str) * 16777619UL;
+    }
+    for(size_t i = 0; i < sizeof(config); i++) {
+        hash = (hash ^ ((config >> (i * 8)) & 0xFF)) * 16777619UL;
+    }
+    return hash;
+}
+
+static const char* browser_index_file_path(BrowserIndex* index, uint32_t key, const char* ext) {
+    furi_string_printf(index->file_path, "%s/%08lX.%s", BROWSER_INDEX_FOLDER, key, ext);
+    return furi_string_get_cstr(index->file_path);
+}
+
+static const char* browser_index_tape_path(BrowserIndex* index, uint8_t tape) {
+    furi_string_printf(index->file_path, "%s/tape%u.tmp", BROWSER_INDEX_FOLDER, tape);
+    return furi_string_get_cstr(index->file_path);
+}
+
+static uint32_t browser_index_entry_hash(const char* name, bool is_folder) {
+    // FNV-1a over record type and name
+    uint32_t hash = 2166136261UL;
+    hash = (hash ^ (is_folder ? BROWSER_INDEX_TYPE_FOLDER : BROWSER_INDEX_TYPE_FILE)) * 16777619UL;
+    for(; *name; name++) {
+        hash = (hash ^ (uint8_t)*name) * 16777619UL;
+    }
+    return hash;
+}
+
+// Start new epoch if storage was modified since the last call. Call with mutex taken.
+static void browser_index_epoch_update(Storage* storage) {
+    uint32_t changes = 0;
+    FS_Error error = storage_common_changes(storage, STORAGE_EXT_PATH_PREFIX, &changes);
+    if(!browser_index_epoch) {
+        // Random start, so that index written before reboot is never taken as current
+        browser_index_epoch = furi_hal_random_get();
+    } else if((error != FSE_OK) || (changes != browser_index_changes)) {
+        browser_index_epoch++;
+    } else {
+        return;
+    }
+    browser_index_changes = changes;
+}
+
+// Account writes made by index itself. Call with mutex taken.
+static void browser_index_epoch_commit(Storage* storage) {
+    if(storage_common_changes(storage, STORAGE_EXT_PATH_PREFIX, &browser_index_changes) !=
+       FSE_OK) {
+        browser_index_epoch++;
+    }
+}
+
+// Count folder entries and compute order independent fingerprint of them
+static bool browser_index_scan(
+    BrowserIndex* index,
+    FuriString* path,
+    uint32_t* entries,
+    uint32_t* fingerprint) {
+    File* directory = storage_file_alloc(index->storage);
+    FileInfo file_info;
+    char* name = malloc(BROWSER_INDEX_NAME_LEN_MAX);
+
+    *entries = 0;
+    *fingerprint = 0;
+
+    bool success = storage_dir_open(directory, furi_string_get_cstr(path));
+    while(success && storage_dir_read(directory, &file_info, name, BROWSER_INDEX_NAME_LEN_MAX)) {
+        if(storage_file_get_error(directory) != FSE_OK) {
+            success = false;
+            break;
+        }
+        if(name[0] == '\0') continue;
+
+        *fingerprint += browser_index_entry_hash(name, file_info_is_dir(&file_info));
+        (*entries)++;
+    }
+
+    storage_dir_close(directory);
+    storage_file_free(directory);
+    free(name);
+
+    return success;
+}
+
+BrowserIndex* browser_index_alloc(void) {
+    if(!browser_index_mutex) {
+        FuriMutex* mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+        FURI_CRITICAL_ENTER();
+        if(!browser_index_mutex) {
+            browser_index_mutex = mutex;
+            mutex = NULL;
+        }
+        FURI_CRITICAL_EXIT();
+        if(mutex) furi_mutex_free(mutex);
+    }
+
+    BrowserIndex* index = malloc(sizeof(BrowserIndex));
+    index->storage = furi_record_open(RECORD_STORAGE);
+    index->offsets = storage_file_alloc(index->storage);
+    index->names = buffered_file_stream_alloc(index->storage);
+    index->file_path = furi_string_alloc();
+    index->record = furi_string_alloc();
+    return index;
+}
+
+void browser_index_free(BrowserIndex* index) {
+    furi_check(index);
+
+    browser_index_close(index);
+
+    furi_string_free(index->record);
+    furi_string_free(index->file_path);
+    stream_free(index->names);
+    storage_file_free(index->offsets);
+    furi_record_close(RECORD_STORAGE);
+    free(index);
+}
+
+// Mark verified index as current, so that the next open does not scan the folder
+static bool browser_index_refresh(BrowserIndex* index, uint32_t key, BrowserIndexHeader* header) {
+    storage_file_close(index->offsets);
+    header->epoch = browser_index_epoch;
+
+    bool success = storage_file_open(
+                       index->offsets,
+                       browser_index_file_path(index, key, "idx"),
+                       FSAM_READ_WRITE,
+                       FSOM_OPEN_EXISTING) &&
+                   (storage_file_write(index->offsets, header, sizeof(*header)) ==
+                    sizeof(*header));
+
+    browser_index_epoch_commit(index->storage);
+    return success;
+}
+
+static bool browser_index_open_locked(BrowserIndex* index, FuriString* path, uint32_t config) {
+    uint32_t key = browser_index_key(path, config);
+    char* path_buf = NULL;
+    bool success = false;
+
+    do {
+        if(!storage_file_open(
+               index->offsets,
+               browser_index_file_path(index, key, "idx"),
+               FSAM_READ,
+               FSOM_OPEN_EXISTING))
+            break;
+
+        BrowserIndexHeader header;
+        if(storage_file_read(index->offsets, &header, sizeof(header)) != sizeof(header)) break;
+        if((header.magic != BROWSER_INDEX_MAGIC) || (header.version != BROWSER_INDEX_VERSION) ||
+           (header.config != config) || (header.path_len != furi_string_size(path)))
+            break;
+
+        // Different folders may share a key, check that index belongs to this one
+        path_buf = malloc(header.path_len);
+        if(storage_file_read(index->offsets, path_buf, header.path_len) != header.path_len) break;
+        if(memcmp(path_buf, furi_string_get_cstr(path), header.path_len) != 0) break;
+
+        if(header.epoch != browser_index_epoch) {
+            // Storage was modified or device rebooted since, index is good if folder is the same
+            uint32_t entries = 0;
+            uint32_t fingerprint = 0;
+            if(!browser_index_scan(index, path, &entries, &fingerprint)) break;
+            if((entries != header.entries) || (fingerprint != header.fingerprint)) break;
+            if(!browser_index_refresh(index, key, &header)) break;
+        }
+
+        if(!buffered_file_stream_open(
+               index->names,
+               browser_index_file_path(index, key, "nam"),
+               FSAM_READ,
+               FSOM_OPEN_EXISTING))
+            break;
+
+        index->count = header.count;
+        index->offsets_start = sizeof(header) + header.path_len;
+        index->is_open = true;
+        success = true;
+    } while(0);
+
+    free(path_buf);
+
+    if(!success) {
+        browser_index_close(index);
+    }
+
+    return success;
+}
+
+bool browser_index_open(BrowserIndex* index, FuriString* path, uint32_t config) {
+    furi_check(index);
+    furi_check(path);
+
+    browser_index_close(index);
+
+    furi_check(furi_mutex_acquire(browser_index_mutex, FuriWaitForever) == FuriStatusOk);
+    browser_index_epoch_update(index->storage);
+    bool success = browser_index_open_locked(index, path, config);
+    furi_check(furi_mutex_release(browser_index_mutex) == FuriStatusOk);
+
+    return success;
+}
+
+static void browser_index_sort_run(FuriString** run, uint32_t run_cnt) {
+    // Runs are short, insertion sort keeps the stack flat
+    for(uint32_t i = 1; i < run_cnt; i++) {
+        FuriString* record = run[i];
+        uint32_t j = i;
+        for(; (j > 0) && (furi_string_cmpi(run[j - 1], record) > 0); j--) {
+            run[j] = run[j - 1];
+        }
+        run[j] = record;
+    }
+}
+
+static bool browser_index_write_run(Stream* tape, FuriString** run, uint32_t run_cnt) {
+    browser_index_sort_run(run, run_cnt);
+    for(uint32_t i = 0; i < run_cnt; i++) {
+        if(stream_write_string(tape, run[i]) != furi_string_size(run[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Read directory into sorted runs of BROWSER_INDEX_RUN_LEN records, alternating between two tapes
+static bool browser_index_split(
+    BrowserIndex* index,
+    FuriString* path,
+    BrowserIndexFilterCallback filter,
+    void* context,
+    Stream** tapes,
+    BrowserIndexHeader* header) {
+    File* directory = storage_file_alloc(index->storage);
+    FileInfo file_info;
+    char* name = malloc(BROWSER_INDEX_NAME_LEN_MAX);
+
+    FuriString** run = malloc(sizeof(FuriString*) * BROWSER_INDEX_RUN_LEN);
+    for(uint32_t i = 0; i < BROWSER_INDEX_RUN_LEN; i++) {
+        run[i] = furi_string_alloc();
+    }
+
+    uint32_t run_cnt = 0;
+    uint32_t run_num = 0;
+    header->count = 0;
+    header->entries = 0;
+    header->fingerprint = 0;
+
+    bool success = storage_dir_open(directory, furi_string_get_cstr(path));
+    while(success && storage_dir_read(directory, &file_info, name, BROWSER_INDEX_NAME_LEN_MAX)) {
+        if(storage_file_get_error(directory) != FSE_OK) {
+            success = false;
+            break;
+        }
+        if(name[0] == '\0') continue;
+
+        bool is_folder = file_info_is_dir(&file_info);
+        header->fingerprint += browser_index_entry_hash(name, is_folder);
+        header->entries++;
+
+        furi_string_set(index->record, name);
+        if(filter && !filter(context, index->record, is_folder)) continue;
+
+        furi_string_printf(
+            run[run_cnt++],
+            "%c%s\n",
+            is_folder ? BROWSER_INDEX_TYPE_FOLDER : BROWSER_INDEX_TYPE_FILE,
+            name);
+        header->count++;
+
+        if(run_cnt == BROWSER_INDEX_RUN_LEN) {
+            success = browser_index_write_run(tapes[run_num % 2], run, run_cnt);
+            run_num++;
+            run_cnt = 0;
+        }
+    }
+
+    if(success && run_cnt) {
+        success = browser_index_write_run(tapes[run_num % 2], run, run_cnt);
+    }
+
+    storage_dir_close(directory);
+    storage_file_free(directory);
+
+    for(uint32_t i = 0; i < BROWSER_INDEX_RUN_LEN; i++) {
+        furi_string_free(run[i]);
+    }
+    free(run);
+    free(name);
+
+    return success;
+}
+
+// Merge pairs of runs from input tapes into runs twice as long, alternating output tapes
+static bool browser_index_merge_pass(
+    Stream* in_a,
+    Stream* in_b,
+    Stream* out_a,
+    Stream* out_b,
+    uint32_t run_len,
+    FuriString* record_a,
+    FuriString* record_b) {
+    bool has_a = stream_read_line(in_a, record_a);
+    bool has_b = stream_read_line(in_b, record_b);
+    Stream* out = out_a;
+
+    while(has_a || has_b) {
+        uint32_t left_a = run_len;
+        uint32_t left_b = run_len;
+
+        while((has_a && left_a) || (has_b && left_b)) {
+            bool take_a;
+            if(!has_b || !left_b) {
+                take_a = true;
+            } else if(!has_a || !left_a) {
+                take_a = false;
+            } else {
+                take_a = furi_string_cmpi(record_a, record_b) <= 0;
+            }
+
+            if(take_a) {
+                if(stream_write_string(out, record_a) != furi_string_size(record_a)) return false;
+                left_a--;
+                has_a = stream_read_line(in_a, record_a);
+            } else {
+                if(stream_write_string(out, record_b) != furi_string_size(record_b)) return false;
+                left_b--;
+                has_b = stream_read_line(in_b, record_b);
+            }
+        }
+
+        out = (out == out_a) ? out_b : out_a;
+    }
+
+    return true;
+}
+
+static bool browser_index_tapes_open(
+    BrowserIndex* index,
+    Stream** tapes,
+    uint8_t first,
+    FS_AccessMode access_mode,
+    FS_OpenMode open_mode) {
+    bool success = true;
+    for(uint8_t i = first; i < first + 2; i++) {
+        success &= buffered_file_stream_open(
+            tapes[i], browser_index_tape_path(index, i), access_mode, open_mode);
+    }
+    return success;
+}
+
+static bool browser_index_tapes_close(Stream** tapes) {
+    bool success = true;
+    for(uint8_t i = 0; i < BROWSER_INDEX_TAPE_COUNT; i++) {
+        success &= buffered_file_stream_close(tapes[i]);
+    }
+    return success;
+}
+
+// External 2-way merge sort, returns tape holding the sorted records
+static bool browser_index_sort(
+    BrowserIndex* index,
+    FuriString* path,
+    BrowserIndexFilterCallback filter,
+    void* context,
+    BrowserIndexHeader* header,
+    uint8_t* result) {
+    Stream* tapes[BROWSER_INDEX_TAPE_COUNT];
+    for(uint8_t i = 0; i < BROWSER_INDEX_TAPE_COUNT; i++) {
+        tapes[i] = buffered_file_stream_alloc(index->storage);
+    }
+    FuriString* record = furi_string_alloc();
+
+    uint8_t in = 0;
+    bool success = browser_index_tapes_open(index, tapes, in, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+                   browser_index_split(index, path, filter, context, tapes, header);
+    success &= browser_index_tapes_close(tapes);
+
+    for(uint32_t run_len = BROWSER_INDEX_RUN_LEN; success && (run_len < header->count);
+        run_len *= 2) {
+        uint8_t out = in ^ 2;
+        success = browser_index_tapes_open(index, tapes, in, FSAM_READ, FSOM_OPEN_EXISTING) &&
+                  browser_index_tapes_open(index, tapes, out, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+                  browser_index_merge_pass(
+                      tapes[in],
+                      tapes[in + 1],
+                      tapes[out],
+                      tapes[out + 1],
+                      run_len,
+                      index->record,
+                      record);
+        success &= browser_index_tapes_close(tapes);
+        in = out;
+    }
+
+    furi_string_free(record);
+    for(uint8_t i = 0; i < BROWSER_INDEX_TAPE_COUNT; i++) {
+        stream_free(tapes[i]);
+    }
+
+    *result = in;
+    return success;
+}
+
+static bool browser_index_write_offsets(
+    BrowserIndex* index,
+    FuriString* path,
+    uint32_t key,
+    BrowserIndexHeader* header) {
+    uint32_t* offsets = malloc(sizeof(uint32_t) * BROWSER_INDEX_RUN_LEN);
+    bool success = false;
+
+    do {
+        if(!buffered_file_stream_open(
+               index->names,
+               browser_index_file_path(index, key, "nam"),
+               FSAM_READ,
+               FSOM_OPEN_EXISTING))
+            break;
+        if(!storage_file_open(
+               index->offsets,
+               browser_index_file_path(index, key, "idx"),
+               FSAM_WRITE,
+               FSOM_CREATE_ALWAYS))
+            break;
+
+        if(storage_file_write(index->offsets, header, sizeof(*header)) != sizeof(*header)) break;
+        if(storage_file_write(index->offsets, furi_string_get_cstr(path), header->path_len) !=
+           header->path_len)
+            break;
+
+        uint32_t written = 0;
+        while(written < header->count) {
+            uint32_t chunk = 0;
+            while((chunk < BROWSER_INDEX_RUN_LEN) && (written + chunk < header->count)) {
+                offsets[chunk] = stream_tell(index->names);
+                if(!stream_read_line(index->names, index->record)) break;
+                chunk++;
+            }
+            if(!chunk) break;
+
+            size_t chunk_size = chunk * sizeof(uint32_t);
+            if(storage_file_write(index->offsets, offsets, chunk_size) != chunk_size) break;
+            written += chunk;
+        }
+
+        success = (written == header->count);
+    } while(0);
+
+    storage_file_close(index->offsets);
+    buffered_file_stream_close(index->names);
+    free(offsets);
+
+    return success;
+}
+
+bool browser_index_build(
+    BrowserIndex* index,
+    FuriString* path,
+    uint32_t config,
+    BrowserIndexFilterCallback filter,
+    void* context) {
+    furi_check(index);
+    furi_check(path);
+
+    browser_index_close(index);
+
+    uint32_t key = browser_index_key(path, config);
+    uint32_t tick_start = furi_get_tick();
+    uint8_t tape = 0;
+
+    furi_check(furi_mutex_acquire(browser_index_mutex, FuriWaitForever) == FuriStatusOk);
+    browser_index_epoch_update(index->storage);
+
+    BrowserIndexHeader header = {
+        .magic = BROWSER_INDEX_MAGIC,
+        .version = BROWSER_INDEX_VERSION,
+        .epoch = browser_index_epoch,
+        .config = config,
+        .path_len = furi_string_size(path),
+    };
+
+    bool success = false;
+    do {
+        if(!storage_simply_mkdir(index->storage, EXT_PATH(".tmp"))) break;
+        if(!storage_simply_mkdir(index->storage, BROWSER_INDEX_FOLDER)) break;
+
+        storage_common_remove(index->storage, browser_index_file_path(index, key, "idx"));
+
+        if(!browser_index_sort(index, path, filter, context, &header, &tape)) break;
+
+        // Keep tape path, file_path is reused for destination
+        FuriString* tape_path = furi_string_alloc_set(browser_index_tape_path(index, tape));
+        FS_Error error = storage_common_rename(
+            index->storage,
+            furi_string_get_cstr(tape_path),
+            browser_index_file_path(index, key, "nam"));
+        furi_string_free(tape_path);
+        if(error != FSE_OK) break;
+
+        if(!browser_index_write_offsets(index, path, key, &header)) break;
+
+        success = true;
+    } while(0);
+
+    for(uint8_t i = 0; i < BROWSER_INDEX_TAPE_COUNT; i++) {
+        storage_common_remove(index->storage, browser_index_tape_path(index, i));
+    }
+
+    // Everything written so far is ours, indexes of this epoch are up to date
+    browser_index_epoch_commit(index->storage);
+
+    FURI_LOG_I(
+        TAG,
+        "Build %s: %lu items, %lu ms, %s",
+        furi_string_get_cstr(path),
+        header.count,
+        furi_get_tick() - tick_start,
+        success ? "ok" : "failed");
+
+    success = success && browser_index_open_locked(index, path, config);
+    furi_check(furi_mutex_release(browser_index_mutex) == FuriStatusOk);
+
+    return success;
+}
+
+void browser_index_close(BrowserIndex* index) {
+    furi_check(index);
+
+    if(storage_file_is_open(index->offsets)) {
+        storage_file_close(index->offsets);
+    }
+    buffered_file_stream_close(index->names);
+    index->is_open = false;
+    index->count = 0;
+}
+
+bool browser_index_is_open(BrowserIndex* index) {
+    furi_check(index);
+    return index->is_open;
+}
+
+uint32_t browser_index_get_count(BrowserIndex* index) {
+    furi_check(index);
+    return index->count;
+}
+
+bool browser_index_seek(BrowserIndex* index, uint32_t idx) {
+    furi_check(index);
+
+    if(!index->is_open || (idx >= index->count)) {
+        return false;
+    }
+
+    uint32_t offset = 0;
+    uint32_t position = index->offsets_start + idx * sizeof(uint32_t);
+    return storage_file_seek(index->offsets, position, true) &&
+           (storage_file_read(index->offsets, &offset, sizeof(offset)) == sizeof(offset)) &&
+           stream_seek(index->names, offset, StreamOffsetFromStart);
+}
+
+bool browser_index_read(BrowserIndex* index, FuriString* name, bool* is_folder) {
+    furi_check(index);
+    furi_check(name);
+    furi_check(is_folder);
+
+    if(!index->is_open || !stream_read_line(index->names, index->record)) {
+        return false;
+    }
+
+    furi_string_trim(index->record, "\n");
+    size_t record_len = furi_string_size(index->record);
+    if(record_len < 2) {
+        return false;
+    }
+
+    *is_folder = furi_string_get_char(index->record, 0) == BROWSER_INDEX_TYPE_FOLDER;
+    furi_string_set_n(name, index->record, 1, record_len - 1);
+
+    return true;
+}
+
+int32_t browser_index_find(BrowserIndex* index, FuriString* name) {
+    furi_check(index);
+    furi_check(name);
+
+    FuriString* key =
+        furi_string_alloc_printf("%c%s\n", BROWSER_INDEX_TYPE_FILE, furi_string_get_cstr(name));
+    int32_t result = -1;
+
+    // Records are sorted, so binary search over offsets table
+    uint32_t low = 0;
+    uint32_t high = index->count;
+    while(low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        if(!browser_index_seek(index, mid) || !stream_read_line(index->names, index->record)) {
+            break;
+        }
+
+        int cmp = furi_string_cmpi(index->record, key);
+        if(cmp == 0) {
+            result = mid;
+            break;
+        } else if(cmp < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    furi_string_free(key);
+    return result;
+}
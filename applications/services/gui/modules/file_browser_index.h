@@ -0,0 +1,119 @@
+/**
+ * @file file_browser_index.h
+ * Sorted on-card listing of a folder used by BrowserWorker.
+ *
+ * Index is built once per folder and filter configuration and then gives
+ * random access to any item without re-reading the directory. It is stored
+ * in a cache folder on SD card. After any write to the external storage that
+ * was not made by the index itself, and after reboot, index is used only if
+ * the folder still has the same entries.
+ */
+#pragma once
+
+#include <furi.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct BrowserIndex BrowserIndex;
+
+/** Directory entry filter, return true to keep entry in index */
+typedef bool (*BrowserIndexFilterCallback)(void* context, FuriString* name, bool is_folder);
+
+/** Allocate BrowserIndex
+ *
+ * @return     BrowserIndex instance
+ */
+BrowserIndex* browser_index_alloc(void);
+
+/** Free BrowserIndex
+ *
+ * @param      index  BrowserIndex instance
+ */
+void browser_index_free(BrowserIndex* index);
+
+/** Open cached index of the folder
+ *
+ * @param      index   BrowserIndex instance
+ * @param      path    folder path
+ * @param      config  filter configuration hash
+ *
+ * @return     true if index exists and is up to date
+ */
+bool browser_index_open(BrowserIndex* index, FuriString* path, uint32_t config);
+
+/** Read folder, sort filtered entries and open resulting index
+ *
+ * Items are ordered folders first, then by case insensitive name, same as
+ * file browser views sort them. Sorting is done in fixed size runs merged
+ * on SD card, so memory usage does not depend on folder size.
+ *
+ * @param      index    BrowserIndex instance
+ * @param      path     folder path
+ * @param      config   filter configuration hash
+ * @param      filter   entry filter
+ * @param      context  filter context
+ *
+ * @return     true on success
+ */
+bool browser_index_build(
+    BrowserIndex* index,
+    FuriString* path,
+    uint32_t config,
+    BrowserIndexFilterCallback filter,
+    void* context);
+
+/** Close index
+ *
+ * @param      index  BrowserIndex instance
+ */
+void browser_index_close(BrowserIndex* index);
+
+/** Check if index is open
+ *
+ * @param      index  BrowserIndex instance
+ *
+ * @return     true if open
+ */
+bool browser_index_is_open(BrowserIndex* index);
+
+/** Get item count
+ *
+ * @param      index  BrowserIndex instance
+ *
+ * @return     number of items in index
+ */
+uint32_t browser_index_get_count(BrowserIndex* index);
+
+/** Move read position to item
+ *
+ * @param      index  BrowserIndex instance
+ * @param      idx    item index
+ *
+ * @return     true on success
+ */
+bool browser_index_seek(BrowserIndex* index, uint32_t idx);
+
+/** Read item at current position and advance to the next one
+ *
+ * @param      index      BrowserIndex instance
+ * @param      name       item name without path
+ * @param      is_folder  set to true if item is a folder
+ *
+ * @return     true on success, false at the end of index
+ */
+bool browser_index_read(BrowserIndex* index, FuriString* name, bool* is_folder);
+
+/** Find file by name
+ *
+ * @param      index  BrowserIndex instance
+ * @param      name   file name without path
+ *
+ * @return     item index or -1 if not found
+ */
+int32_t browser_index_find(BrowserIndex* index, FuriString* name);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,4 +1,5 @@
 #include "file_browser_worker.h"
+#include "file_browser_index.h"
 
 #include <storage/filesystem_api_defines.h>
 #include <storage/storage.h>
@@ -48,6 +49,8 @@ struct BrowserWorker {
     bool hide_dot_files;
     IdxLastArray_t idx_last;
     ExtFilterArray_t ext_filter;
+    uint32_t config_hash;
+    BrowserIndex* index;
 
     void* cb_ctx;
     BrowserWorkerFolderOpenCallback folder_cb;
@@ -142,6 +145,27 @@ static bool browser_filter_by_name(BrowserWorker* browser, FuriString* name, boo
     return false;
 }
 
+static bool browser_index_filter_cb(void* context, FuriString* name, bool is_folder) {
+    return browser_filter_by_name(context, name, is_folder);
+}
+
+static uint32_t browser_config_hash(BrowserWorker* browser) {
+    // Folder index depends on everything that browser_filter_by_name() looks at
+    uint32_t hash = (browser->skip_assets ? 1 : 0) | (browser->hide_dot_files ? 2 : 0);
+
+    ExtFilterArray_it_t it;
+    for(ExtFilterArray_it(it, browser->ext_filter); !ExtFilterArray_end_p(it);
+        ExtFilterArray_next(it)) {
+        const char* ext = furi_string_get_cstr(*ExtFilterArray_cref(it));
+        hash = hash * 31 + '|';
+        while(*ext) {
+            hash = hash * 31 + (uint8_t)*ext++;
+        }
+    }
+
+    return hash;
+}
+
 static bool browser_folder_check_and_switch(FuriString* path) {
     FileInfo file_info;
     Storage* storage = furi_record_open(RECORD_STORAGE);
@@ -167,7 +191,7 @@ static bool browser_folder_check_and_switch(FuriString* path) {
     return is_root;
 }
 
-static bool browser_folder_init(
+static bool browser_folder_scan(
     BrowserWorker* browser,
     FuriString* path,
     FuriString* filename,
@@ -224,6 +248,73 @@ static bool browser_folder_init(
     return state;
 }
 
+static bool browser_folder_init(
+    BrowserWorker* browser,
+    FuriString* path,
+    FuriString* filename,
+    uint32_t* item_cnt,
+    int32_t* file_idx) {
+    // Up to date index has everything, no need to read the folder
+    if(browser_index_open(browser->index, path, browser->config_hash)) {
+        *item_cnt = browser_index_get_count(browser->index);
+        *file_idx = furi_string_empty(filename) ? -1 :
+                                                  browser_index_find(browser->index, filename);
+        return true;
+    }
+
+    bool state = browser_folder_scan(browser, path, filename, item_cnt, file_idx);
+
+    // Large folders are sorted once and then paged through the index
+    if(state && (*item_cnt > BROWSER_SORT_THRESHOLD) &&
+       browser_index_build(
+           browser->index, path, browser->config_hash, browser_index_filter_cb, browser)) {
+        *item_cnt = browser_index_get_count(browser->index);
+        *file_idx = furi_string_empty(filename) ? -1 :
+                                                  browser_index_find(browser->index, filename);
+    }
+
+    return state;
+}
+
+// Load files list from folder index, already sorted and with random access to offset
+static bool browser_folder_load_indexed(
+    BrowserWorker* browser,
+    FuriString* path,
+    uint32_t offset,
+    uint32_t count) {
+    FuriString* name_str;
+    name_str = furi_string_alloc();
+    FuriString* item_path;
+    item_path = furi_string_alloc();
+
+    uint32_t items_cnt = 0;
+    bool is_folder = false;
+
+    if(browser_index_seek(browser->index, offset)) {
+        if(browser->list_load_cb) {
+            browser->list_load_cb(browser->cb_ctx, offset);
+        }
+
+        while((items_cnt < count) && browser_index_read(browser->index, name_str, &is_folder)) {
+            furi_string_printf(
+                item_path, "%s/%s", furi_string_get_cstr(path), furi_string_get_cstr(name_str));
+            if(browser->list_item_cb) {
+                browser->list_item_cb(
+                    browser->cb_ctx, item_path, offset + items_cnt, is_folder, false);
+            }
+            items_cnt++;
+        }
+        if(browser->list_item_cb) {
+            browser->list_item_cb(browser->cb_ctx, NULL, 0, false, true);
+        }
+    }
+
+    furi_string_free(item_path);
+    furi_string_free(name_str);
+
+    return items_cnt == count;
+}
+
 // Load files list by chunks, like it was originally, not compatible with sorting, sorting needs to be disabled to use this
 static bool browser_folder_load_chunked(
     BrowserWorker* browser,
@@ -381,6 +472,7 @@ static int32_t browser_worker(void* context) {
                 path_extract_filename(browser->path_next, filename, false);
             }
             IdxLastArray_reset(browser->idx_last);
+            browser->config_hash = browser_config_hash(browser);
 
             furi_thread_flags_set(furi_thread_get_id(browser->thread), WorkerEvtFolderEnter);
         }
@@ -393,14 +485,16 @@ static int32_t browser_worker(void* context) {
             IdxLastArray_push_back(browser->idx_last, browser->item_sel_idx);
 
             int32_t file_idx = 0;
+            uint32_t tick_start = furi_get_tick();
             browser_folder_init(browser, path, filename, &items_cnt, &file_idx);
             furi_string_set(browser->path_current, path);
             FURI_LOG_D(
                 TAG,
-                "Enter folder: %s items: %lu idx: %ld",
+                "Enter folder: %s items: %lu idx: %ld in %lu ms",
                 furi_string_get_cstr(path),
                 items_cnt,
-                file_idx);
+                file_idx,
+                furi_get_tick() - tick_start);
             if(browser->folder_cb) {
                 browser->folder_cb(browser->cb_ctx, items_cnt, file_idx, is_root);
             }
@@ -449,12 +543,17 @@ static int32_t browser_worker(void* context) {
         if(flags & WorkerEvtLoad) {
             FURI_LOG_D(
                 TAG, "Load offset: %lu cnt: %lu", browser->load_offset, browser->load_count);
-            if(items_cnt > BROWSER_SORT_THRESHOLD) {
+            uint32_t tick_start = furi_get_tick();
+            if(browser_index_is_open(browser->index)) {
+                browser_folder_load_indexed(
+                    browser, path, browser->load_offset, browser->load_count);
+            } else if(items_cnt > BROWSER_SORT_THRESHOLD) {
                 browser_folder_load_chunked(
                     browser, path, browser->load_offset, browser->load_count);
             } else {
                 browser_folder_load_full(browser, path);
             }
+            FURI_LOG_D(TAG, "Load done in %lu ms", furi_get_tick() - tick_start);
         }
 
         if(flags & WorkerEvtStop) {
@@ -462,6 +561,8 @@ static int32_t browser_worker(void* context) {
         }
     }
 
+    browser_index_close(browser->index);
+
     furi_string_free(filename);
     furi_string_free(path);
 
@@ -492,6 +593,8 @@ BrowserWorker* file_browser_worker_alloc(
         furi_string_set_str(browser->path_start, base_path);
     }
 
+    browser->index = browser_index_alloc();
+
     browser->thread = furi_thread_alloc_ex("BrowserWorker", 2048, browser_worker, browser);
     furi_thread_start(browser->thread);
 
@@ -509,6 +612,8 @@ void file_browser_worker_free(BrowserWorker* browser) {
     furi_string_free(browser->path_current);
     furi_string_free(browser->path_start);
 
+    browser_index_free(browser->index);
+
     IdxLastArray_clear(browser->idx_last);
     ExtFilterArray_clear(browser->ext_filter);
 
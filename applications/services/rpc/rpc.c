@@ -79,6 +79,7 @@ struct RpcSession {
     FuriMutex* callbacks_mutex;
     RpcSendBytesCallback send_bytes_callback;
     RpcBufferIsEmptyCallback buffer_is_empty_callback;
+    RpcBufferIsLowCallback buffer_is_low_callback;
     RpcSessionClosedCallback closed_callback;
     RpcSessionTerminatedCallback terminated_callback;
     RpcOwner owner;
@@ -144,6 +145,14 @@ void rpc_session_set_buffer_is_empty_callback(
     furi_mutex_release(session->callbacks_mutex);
 }
 
+void rpc_session_set_buffer_is_low_callback(RpcSession* session, RpcBufferIsLowCallback callback) {
+    furi_check(session);
+
+    furi_mutex_acquire(session->callbacks_mutex, FuriWaitForever);
+    session->buffer_is_low_callback = callback;
+    furi_mutex_release(session->callbacks_mutex);
+}
+
 void rpc_session_set_terminated_callback(
     RpcSession* session,
     RpcSessionTerminatedCallback callback) {
@@ -197,13 +206,21 @@ bool rpc_pb_stream_read(pb_istream_t* istream, pb_byte_t* buf, size_t count) {
     size_t bytes_received = 0;
 
     while(1) {
+        size_t fill_before = furi_stream_buffer_bytes_available(session->stream);
         bytes_received += furi_stream_buffer_receive(
             session->stream, buf + bytes_received, count - bytes_received, 0);
-        if(furi_stream_buffer_is_empty(session->stream)) {
+        size_t fill_after = furi_stream_buffer_bytes_available(session->stream);
+        if(!fill_after) {
             if(session->buffer_is_empty_callback) {
                 session->buffer_is_empty_callback(session->context);
             }
         }
+        if(!fill_after ||
+           (fill_before > RPC_BUFFER_LOW_WATERMARK && fill_after <= RPC_BUFFER_LOW_WATERMARK)) {
+            if(session->buffer_is_low_callback) {
+                session->buffer_is_low_callback(session->context);
+            }
+        }
         if(session->decode_error) {
             /* never go out till RPC_EVENT_DISCONNECT come */
             bytes_received = 0;
@@ -426,6 +443,7 @@ void rpc_session_close(RpcSession* session) {
     rpc_session_set_send_bytes_callback(session, NULL);
     rpc_session_set_close_callback(session, NULL);
     rpc_session_set_buffer_is_empty_callback(session, NULL);
+    rpc_session_set_buffer_is_low_callback(session, NULL);
     furi_thread_flags_set(furi_thread_get_id(session->thread), RpcEvtDisconnect);
 }
 
@@ -10,6 +10,8 @@ extern "C" {
 #endif
 
 #define RPC_BUFFER_SIZE (1024)
+/** Buffer fill level at which a stalled transport may resume feeding */
+#define RPC_BUFFER_LOW_WATERMARK (RPC_BUFFER_SIZE / 4)
 
 #define RECORD_RPC "rpc"
 
@@ -22,6 +24,8 @@ typedef struct RpcSession RpcSession;
 typedef void (*RpcSendBytesCallback)(void* context, uint8_t* bytes, size_t bytes_len);
 /** Callback to notify client that buffer is empty */
 typedef void (*RpcBufferIsEmptyCallback)(void* context);
+/** Callback to notify client that buffer fill has dropped to low-water mark */
+typedef void (*RpcBufferIsLowCallback)(void* context);
 /** Callback to notify transport layer that close_session command
  * is received. Any other actions lays on transport layer.
  * No destruction or session close performed. */
@@ -100,6 +104,18 @@ void rpc_session_set_buffer_is_empty_callback(
     RpcSession* session,
     RpcBufferIsEmptyCallback callback);
 
+/** Set callback to notify that buffer fill has dropped to low-water mark
+ *
+ * Called once buffer fill drops from above RPC_BUFFER_LOW_WATERMARK to or
+ * below it, and every time buffer becomes empty. Lets transport resume
+ * feeding while there is still data to process, not only after the buffer
+ * was drained completely.
+ *
+ * @param   session     pointer to RpcSession descriptor
+ * @param   callback    callback to notify client that buffer is low (can be NULL)
+ */
+void rpc_session_set_buffer_is_low_callback(RpcSession* session, RpcBufferIsLowCallback callback);
+
 /** Set callback to be called when RPC command to close session is received
  *  WARN: It's forbidden to call RPC API within RpcSessionClosedCallback
  *
@@ -1,4 +1,5 @@
 #include <cli/cli.h>
+#include <cli/cli_vcp.h>
 #include <furi.h>
 #include <rpc/rpc.h>
 #include <furi_hal.h>
@@ -7,6 +8,7 @@
 
 typedef struct {
     Cli* cli;
+    RpcSession* session;
     bool session_close_request;
     FuriSemaphore* terminate_semaphore;
 } CliRpc;
@@ -22,6 +24,32 @@ static void rpc_cli_send_bytes_callback(void* context, uint8_t* bytes, size_t by
     cli_write(cli_rpc->cli, bytes, bytes_len);
 }
 
+static size_t rpc_cli_vcp_get_space(void* context) {
+    furi_assert(context);
+    CliRpc* cli_rpc = context;
+
+    return rpc_session_get_available_size(cli_rpc->session);
+}
+
+static void rpc_cli_vcp_receive(void* context, const uint8_t* data, size_t size) {
+    furi_assert(context);
+    CliRpc* cli_rpc = context;
+
+    // VCP hands over only as much as get_space reported
+    size_t fed_bytes = rpc_session_feed(cli_rpc->session, data, size, 0);
+    furi_check(fed_bytes == size);
+}
+
+static void rpc_cli_buffer_is_low_callback(void* context) {
+    UNUSED(context);
+    cli_vcp_consumer_ready();
+}
+
+static const CliVcpConsumer rpc_cli_vcp_consumer = {
+    .get_space = rpc_cli_vcp_get_space,
+    .receive = rpc_cli_vcp_receive,
+};
+
 static void rpc_cli_session_close_callback(void* context) {
     furi_assert(context);
     CliRpc* cli_rpc = context;
@@ -53,12 +81,17 @@ void rpc_cli_command_start_session(Cli* cli, FuriString* args, void* context) {
         return;
     }
 
-    CliRpc cli_rpc = {.cli = cli, .session_close_request = false};
+    CliRpc cli_rpc = {.cli = cli, .session = rpc_session, .session_close_request = false};
     cli_rpc.terminate_semaphore = furi_semaphore_alloc(1, 0);
     rpc_session_set_context(rpc_session, &cli_rpc);
     rpc_session_set_send_bytes_callback(rpc_session, rpc_cli_send_bytes_callback);
     rpc_session_set_close_callback(rpc_session, rpc_cli_session_close_callback);
     rpc_session_set_terminated_callback(rpc_session, rpc_cli_session_terminated_callback);
+    rpc_session_set_buffer_is_low_callback(rpc_session, rpc_cli_buffer_is_low_callback);
+
+    // Take packets straight from VCP worker, CLI stream then carries only connection events
+    bool direct = cli_vcp_set_consumer(&rpc_cli_vcp_consumer, &cli_rpc);
+    FURI_LOG_D(TAG, "Direct VCP consumer: %s", direct ? "yes" : "no");
 
     uint8_t* buffer = malloc(CLI_READ_BUFFER_SIZE);
     size_t size_received = 0;
@@ -76,6 +109,10 @@ void rpc_cli_command_start_session(Cli* cli, FuriString* args, void* context) {
         }
     }
 
+    if(direct) {
+        cli_vcp_set_consumer(NULL, NULL);
+    }
+
     rpc_session_close(rpc_session);
 
     furi_check(
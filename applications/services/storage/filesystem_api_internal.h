@@ -146,6 +146,12 @@ typedef struct {
  *      @param name_length name buffer length
  *      @return FS_Error error info
  * 
+ *  @var FS_Common_Api::modified
+ *      @brief Get file/directory modification time
+ *      @param path path to file/directory
+ *      @param timestamp pointer to UNIX timestamp of last modification
+ *      @return FS_Error error info
+ * 
  *  @var FS_Common_Api::remove
  *      @brief Remove file/directory from storage, 
  *          directory must be empty,
@@ -175,6 +181,7 @@ typedef struct {
  */
 typedef struct {
     FS_Error (*const stat)(void* context, const char* path, FileInfo* fileinfo);
+    FS_Error (*const modified)(void* context, const char* path, uint32_t* timestamp);
     FS_Error (*const remove)(void* context, const char* path);
     FS_Error (*const mkdir)(void* context, const char* path);
     FS_Error (*const fs_info)(
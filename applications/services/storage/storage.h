@@ -275,6 +275,29 @@ bool storage_dir_exists(Storage* storage, const char* path);
  */
 FS_Error storage_common_timestamp(Storage* storage, const char* path, uint32_t* timestamp);
 
+/**
+ * @brief Get the number of modifications made to a storage since it was mounted.
+ *
+ * Unlike the timestamp, the counter changes on every modification, even on
+ * several modifications made within the same second.
+ *
+ * @param storage pointer to a storage API instance.
+ * @param path pointer to a zero-terminated string containing the path of the item in question.
+ * @param changes pointer to a value to contain the modification counter.
+ * @return FSE_OK if the counter has been successfully received, any other error code on failure.
+ */
+FS_Error storage_common_changes(Storage* storage, const char* path, uint32_t* changes);
+
+/**
+ * @brief Get the last modification time of a file or a directory.
+ *
+ * @param storage pointer to a storage API instance.
+ * @param path pointer to a zero-terminated string containing the path of the item in question.
+ * @param timestamp pointer to a value to contain the UNIX timestamp of the last modification.
+ * @return FSE_OK if the time has been successfully received, any other error code on failure.
+ */
+FS_Error storage_common_modified(Storage* storage, const char* path, uint32_t* timestamp);
+
 /**
  * @brief Get information about a file or a directory.
  *
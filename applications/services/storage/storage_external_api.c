@@ -444,6 +444,38 @@ FS_Error storage_common_timestamp(Storage* storage, const char* path, uint32_t*
     return S_RETURN_ERROR;
 }
 
+FS_Error storage_common_changes(Storage* storage, const char* path, uint32_t* changes) {
+    furi_check(storage);
+    S_API_PROLOGUE;
+
+    SAData data = {
+        .cchanges = {
+            .path = path,
+            .changes = changes,
+            .thread_id = furi_thread_get_current_id(),
+        }};
+
+    S_API_MESSAGE(StorageCommandCommonChanges);
+    S_API_EPILOGUE;
+    return S_RETURN_ERROR;
+}
+
+FS_Error storage_common_modified(Storage* storage, const char* path, uint32_t* timestamp) {
+    furi_check(storage);
+    S_API_PROLOGUE;
+
+    SAData data = {
+        .ctimestamp = {
+            .path = path,
+            .timestamp = timestamp,
+            .thread_id = furi_thread_get_current_id(),
+        }};
+
+    S_API_MESSAGE(StorageCommandCommonModified);
+    S_API_EPILOGUE;
+    return S_RETURN_ERROR;
+}
+
 FS_Error storage_common_stat(Storage* storage, const char* path, FileInfo* fileinfo) {
     furi_check(storage);
 
@@ -67,12 +67,17 @@ const char* storage_data_status_text(StorageData* storage) {
 
 void storage_data_timestamp(StorageData* storage) {
     storage->timestamp = furi_hal_rtc_get_timestamp();
+    storage->changes++;
 }
 
 uint32_t storage_data_get_timestamp(StorageData* storage) {
     return storage->timestamp;
 }
 
+uint32_t storage_data_get_changes(StorageData* storage) {
+    return storage->changes;
+}
+
 /****************** storage glue ******************/
 
 static StorageFile* storage_get_file(const File* file, StorageData* storage) {
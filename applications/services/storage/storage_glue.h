@@ -46,6 +46,7 @@ StorageStatus storage_data_status(StorageData* storage);
 const char* storage_data_status_text(StorageData* storage);
 void storage_data_timestamp(StorageData* storage);
 uint32_t storage_data_get_timestamp(StorageData* storage);
+uint32_t storage_data_get_changes(StorageData* storage);
 
 LIST_DEF(
     StorageFileList,
@@ -62,6 +63,7 @@ struct StorageData {
     StorageStatus status;
     StorageFileList_t files;
     uint32_t timestamp;
+    uint32_t changes;
 };
 
 bool storage_has_file(const File* file, StorageData* storage_data);
@@ -51,6 +51,12 @@ typedef struct {
     FuriThreadId thread_id;
 } SADataCTimestamp;
 
+typedef struct {
+    const char* path;
+    uint32_t* changes;
+    FuriThreadId thread_id;
+} SADataCChanges;
+
 typedef struct {
     const char* path;
     FileInfo* fileinfo;
@@ -103,6 +109,7 @@ typedef union {
     SADataDRead dread;
 
     SADataCTimestamp ctimestamp;
+    SADataCChanges cchanges;
     SADataCStat cstat;
     SADataCFSInfo cfsinfo;
     SADataCResolvePath cresolvepath;
@@ -151,6 +158,8 @@ typedef enum {
     StorageCommandCommonResolvePath,
     StorageCommandSDMount,
     StorageCommandCommonEquivalentPath,
+    StorageCommandCommonChanges,
+    StorageCommandCommonModified,
 } StorageCommand;
 
 typedef struct {
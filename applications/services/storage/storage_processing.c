@@ -342,6 +342,30 @@ static FS_Error
     return ret;
 }
 
+static FS_Error
+    storage_process_common_changes(Storage* app, FuriString* path, uint32_t* changes) {
+    StorageData* storage;
+    FS_Error ret = storage_get_data(app, path, &storage);
+
+    if(ret == FSE_OK) {
+        *changes = storage_data_get_changes(storage);
+    }
+
+    return ret;
+}
+
+static FS_Error
+    storage_process_common_modified(Storage* app, FuriString* path, uint32_t* timestamp) {
+    StorageData* storage;
+    FS_Error ret = storage_get_data(app, path, &storage);
+
+    if(ret == FSE_OK) {
+        FS_CALL(storage, common.modified(storage, cstr_path_without_vfs_prefix(path), timestamp));
+    }
+
+    return ret;
+}
+
 static FS_Error storage_process_common_stat(Storage* app, FuriString* path, FileInfo* fileinfo) {
     StorageData* storage;
     FS_Error ret = storage_get_data(app, path, &storage);
@@ -660,6 +684,18 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
         message->return_data->error_value =
             storage_process_common_timestamp(app, path, message->data->ctimestamp.timestamp);
         break;
+    case StorageCommandCommonChanges:
+        path = furi_string_alloc_set(message->data->cchanges.path);
+        storage_process_alias(app, path, message->data->cchanges.thread_id, false);
+        message->return_data->error_value =
+            storage_process_common_changes(app, path, message->data->cchanges.changes);
+        break;
+    case StorageCommandCommonModified:
+        path = furi_string_alloc_set(message->data->ctimestamp.path);
+        storage_process_alias(app, path, message->data->ctimestamp.thread_id, false);
+        message->return_data->error_value =
+            storage_process_common_modified(app, path, message->data->ctimestamp.timestamp);
+        break;
     case StorageCommandCommonStat:
         path = furi_string_alloc_set(message->data->cstat.path);
         storage_process_alias(app, path, message->data->cstat.thread_id, false);
@@ -1,6 +1,7 @@
 #include <fatfs.h>
 #include <furi_hal.h>
 #include <furi_hal_sd.h>
+#include <datetime/datetime.h>
 
 #include "sd_notify.h"
 #include "storage_ext.h"
@@ -605,6 +606,27 @@ static FS_Error storage_ext_common_stat(void* ctx, const char* path, FileInfo* f
     return storage_ext_parse_error(result);
 }
 
+static FS_Error storage_ext_common_modified(void* ctx, const char* path, uint32_t* timestamp) {
+    UNUSED(ctx);
+    SDFileInfo _fileinfo;
+    SDError result = f_stat(path, &_fileinfo);
+
+    if(result == FR_OK) {
+        // FAT keeps local time with 2 second resolution
+        DateTime datetime = {
+            .year = (_fileinfo.fdate >> 9) + 1980,
+            .month = (_fileinfo.fdate >> 5) & 0x0F,
+            .day = _fileinfo.fdate & 0x1F,
+            .hour = _fileinfo.ftime >> 11,
+            .minute = (_fileinfo.ftime >> 5) & 0x3F,
+            .second = (_fileinfo.ftime & 0x1F) * 2,
+        };
+        *timestamp = datetime_datetime_to_timestamp(&datetime);
+    }
+
+    return storage_ext_parse_error(result);
+}
+
 static FS_Error storage_ext_common_remove(void* ctx, const char* path) {
     UNUSED(ctx);
 #ifdef FURI_RAM_EXEC
@@ -703,6 +725,7 @@ static const FS_Api fs_api = {
     .common =
         {
             .stat = storage_ext_common_stat,
+            .modified = storage_ext_common_modified,
             .mkdir = storage_ext_common_mkdir,
             .remove = storage_ext_common_remove,
             .fs_info = storage_ext_common_fs_info,
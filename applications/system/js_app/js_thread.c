@@ -91,6 +91,10 @@ static void js_console_debug(struct mjs* mjs) {
     mjs_return(mjs, MJS_UNDEFINED);
 }
 
+static uint32_t js_gc_clock(void) {
+    return DWT->CYCCNT;
+}
+
 static void js_exit_flag_poll(struct mjs* mjs) {
     uint32_t flags = furi_thread_flags_wait(ThreadEventStop, FuriFlagWaitAny, 0);
     if(flags & FuriFlagError) {
@@ -272,6 +276,7 @@ static int32_t js_thread(void* arg) {
     mjs_set_ffi_resolver(mjs, js_dlsym, worker->resolver);
 
     mjs_set_exec_flags_poller(mjs, js_exit_flag_poll);
+    mjs_gc_set_clock(mjs, js_gc_clock, furi_hal_cortex_instructions_per_microsecond());
 
     mjs_err_t err = mjs_exec_file(mjs, furi_string_get_cstr(worker->path), NULL);
 
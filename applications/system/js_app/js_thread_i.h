@@ -2,6 +2,7 @@
 
 #include <furi.h>
 #include <mjs_core_public.h>
+#include <mjs_gc_public.h>
 #include <mjs_ffi_public.h>
 #include <mjs_exec_public.h>
 #include <mjs_object_public.h>
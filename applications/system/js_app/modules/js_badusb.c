@@ -2,6 +2,8 @@
 #include "../js_modules.h"
 #include <furi_hal.h>
 
+#define PRINT_BATCH_LEN 64
+
 #define ASCII_TO_KEY(layout, x) (((uint8_t)x < 128) ? (layout[(uint8_t)x]) : HID_KEYBOARD_NONE)
 
 typedef struct {
@@ -440,6 +442,26 @@ static void badusb_print(struct mjs* mjs, bool ln, bool alt) {
         return;
     }
 
+    if(!alt && (delay_val == 0)) {
+        // No per-character delay: send the text as batches of back-to-back reports
+        uint16_t keycodes[PRINT_BATCH_LEN];
+        size_t keycodes_len = 0;
+        for(size_t i = 0; i < text_len; i++) {
+            keycodes[keycodes_len++] = ASCII_TO_KEY(badusb->layout, text_str[i]);
+            if(keycodes_len == COUNT_OF(keycodes)) {
+                furi_hal_hid_kb_type(keycodes, keycodes_len);
+                keycodes_len = 0;
+            }
+        }
+        if(ln) {
+            keycodes[keycodes_len++] = HID_KEYBOARD_RETURN;
+        }
+        furi_hal_hid_kb_type(keycodes, keycodes_len);
+
+        mjs_return(mjs, MJS_UNDEFINED);
+        return;
+    }
+
     if(alt) {
         ducky_numlock_on();
     }
@@ -2,6 +2,7 @@
 #include <core/common_defines.h>
 #include <furi_hal_version.h>
 #include <power/power_service/power.h>
+#include <mjs_gc_public.h>
 
 #define TAG "JsTests"
 
@@ -92,12 +93,39 @@ static void js_tests_assert_float_close(struct mjs* mjs) {
     mjs_return(mjs, MJS_UNDEFINED);
 }
 
+static void js_tests_gc_stats(struct mjs* mjs) {
+    furi_check(mjs_nargs(mjs) == 0);
+
+    struct mjs_gc_stats stats;
+    mjs_gc_get_stats(mjs, &stats);
+
+    mjs_val_t histogram = mjs_mk_array(mjs);
+    for(size_t i = 0; i < COUNT_OF(stats.pause_histogram); i++) {
+        mjs_array_push(mjs, histogram, mjs_mk_number(mjs, stats.pause_histogram[i]));
+    }
+
+    mjs_val_t stats_obj = mjs_mk_object(mjs);
+    JS_ASSIGN_MULTI(mjs, stats_obj) {
+        JS_FIELD("collections", mjs_mk_number(mjs, stats.collections));
+        JS_FIELD("pauseLastUs", mjs_mk_number(mjs, stats.pause_last_us));
+        JS_FIELD("pauseMaxUs", mjs_mk_number(mjs, stats.pause_max_us));
+        JS_FIELD("pauseTotalUs", mjs_mk_number(mjs, stats.pause_total_us));
+        JS_FIELD("pauseHistogram", histogram);
+        JS_FIELD("cellsReclaimed", mjs_mk_number(mjs, stats.cells_reclaimed));
+        JS_FIELD("bytesReclaimed", mjs_mk_number(mjs, stats.bytes_reclaimed));
+        JS_FIELD("arenaGrows", mjs_mk_number(mjs, stats.arena_grows));
+    }
+
+    mjs_return(mjs, stats_obj);
+}
+
 void* js_tests_create(struct mjs* mjs, mjs_val_t* object, JsModules* modules) {
     UNUSED(modules);
     mjs_val_t tests_obj = mjs_mk_object(mjs);
     mjs_set(mjs, tests_obj, "fail", ~0, MJS_MK_FN(js_tests_fail));
     mjs_set(mjs, tests_obj, "assert_eq", ~0, MJS_MK_FN(js_tests_assert_eq));
     mjs_set(mjs, tests_obj, "assert_float_close", ~0, MJS_MK_FN(js_tests_assert_float_close));
+    mjs_set(mjs, tests_obj, "gc_stats", ~0, MJS_MK_FN(js_tests_gc_stats));
     *object = tests_obj;
 
     return (void*)1;
@@ -6,3 +6,17 @@
 export function fail(message: string): never;
 export function assert_eq<T>(expected: T, result: T): void | never;
 export function assert_float_close(expected: number, result: number, epsilon: number): void | never;
+
+export type GcStats = {
+    collections: number;
+    pauseLastUs: number;
+    pauseMaxUs: number;
+    pauseTotalUs: number;
+    /** Pause counts in buckets of <1, <2, <5, <10, <20 and >=20 ms */
+    pauseHistogram: number[];
+    cellsReclaimed: number;
+    bytesReclaimed: number;
+    arenaGrows: number;
+};
+
+export function gc_stats(): GcStats;
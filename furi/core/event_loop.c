@@ -32,6 +32,9 @@ static void furi_event_loop_item_notify(FuriEventLoopItem* instance);
 
 static bool furi_event_loop_item_is_waiting(FuriEventLoopItem* instance);
 
+static FuriEventLoopItem*
+    furi_event_loop_link_get_item(FuriEventLoopLink* link, FuriEventLoop* owner);
+
 static void furi_event_loop_process_pending_callbacks(FuriEventLoop* instance) {
     for(; !PendingQueue_empty_p(instance->pending_queue);
         PendingQueue_pop_back(NULL, instance->pending_queue)) {
@@ -64,9 +67,8 @@ FuriEventLoop* furi_event_loop_alloc(void) {
 
     instance->thread_id = furi_thread_get_current_id();
 
-    FuriEventLoopTree_init(instance->tree);
     WaitingList_init(instance->waiting_list);
-    TimerList_init(instance->timer_list);
+    instance->timer_wheel = NULL;
     TimerQueue_init(instance->timer_queue);
     PendingQueue_init(instance->pending_queue);
 
@@ -84,10 +86,10 @@ void furi_event_loop_free(FuriEventLoop* instance) {
     furi_check(instance->state == FuriEventLoopStateStopped);
 
     furi_event_loop_process_timer_queue(instance);
-    furi_check(TimerList_empty_p(instance->timer_list));
+    furi_check(furi_event_loop_timer_wheel_is_empty(instance));
     furi_check(WaitingList_empty_p(instance->waiting_list));
 
-    FuriEventLoopTree_clear(instance->tree);
+    furi_event_loop_timer_wheel_free(instance);
     PendingQueue_clear(instance->pending_queue);
 
     uint32_t flags = 0;
@@ -294,15 +296,14 @@ static void furi_event_loop_object_subscribe(
 
     FURI_CRITICAL_ENTER();
 
-    furi_check(FuriEventLoopTree_get(instance->tree, object) == NULL);
+    // Object can be subscribed to only once per event loop
+    FuriEventLoopLink* link = furi_event_loop_object_get_link(object);
+    furi_check(!furi_event_loop_link_get_item(link, instance));
 
     // Allocate and setup item
     FuriEventLoopItem* item = furi_event_loop_item_alloc(instance, contract, object, event);
     furi_event_loop_item_set_callback(item, callback, context);
 
-    FuriEventLoopTree_set_at(instance->tree, object, item);
-
-    FuriEventLoopLink* link = item->contract->get_link(object);
     FuriEventLoopEvent event_noflags = item->event & FuriEventLoopEventMask;
 
     if(event_noflags == FuriEventLoopEventIn) {
@@ -386,13 +387,12 @@ void furi_event_loop_unsubscribe(FuriEventLoop* instance, FuriEventLoopObject* o
 
     FURI_CRITICAL_ENTER();
 
-    FuriEventLoopItem* item = NULL;
-    furi_check(FuriEventLoopTree_pop_at(&item, instance->tree, object));
+    FuriEventLoopLink* link = furi_event_loop_object_get_link(object);
+    FuriEventLoopItem* item = furi_event_loop_link_get_item(link, instance);
 
     furi_check(item);
-    furi_check(item->owner == instance);
+    furi_check(item->object == object);
 
-    FuriEventLoopLink* link = item->contract->get_link(object);
     FuriEventLoopEvent event_noflags = item->event & FuriEventLoopEventMask;
 
     if(event_noflags == FuriEventLoopEventIn) {
@@ -423,8 +423,8 @@ bool furi_event_loop_is_subscribed(FuriEventLoop* instance, FuriEventLoopObject*
     furi_check(instance->thread_id == furi_thread_get_current_id());
     FURI_CRITICAL_ENTER();
 
-    FuriEventLoopItem* const* item = FuriEventLoopTree_cget(instance->tree, object);
-    bool result = !!item;
+    FuriEventLoopLink* link = furi_event_loop_object_get_link(object);
+    bool result = !!furi_event_loop_link_get_item(link, instance);
 
     FURI_CRITICAL_EXIT();
     return result;
@@ -502,10 +502,34 @@ static bool furi_event_loop_item_is_waiting(FuriEventLoopItem* instance) {
     return instance->WaitingList.prev || instance->WaitingList.next;
 }
 
+static FuriEventLoopItem*
+    furi_event_loop_link_get_item(FuriEventLoopLink* link, FuriEventLoop* owner) {
+    if(link->item_in && link->item_in->owner == owner) {
+        return link->item_in;
+    } else if(link->item_out && link->item_out->owner == owner) {
+        return link->item_out;
+    } else {
+        return NULL;
+    }
+}
+
 /*
  * Internal event loop link API, used by supported primitives
  */
 
+void* furi_event_loop_object_alloc(size_t size) {
+    FuriEventLoopLink* link = malloc(sizeof(FuriEventLoopLink) + size);
+
+    link->item_in = NULL;
+    link->item_out = NULL;
+
+    return link + 1;
+}
+
+void furi_event_loop_object_free(FuriEventLoopObject* object) {
+    free(furi_event_loop_object_get_link(object));
+}
+
 void furi_event_loop_link_notify(FuriEventLoopLink* instance, FuriEventLoopEvent event) {
     furi_assert(instance);
 
@@ -6,7 +6,6 @@
 #include "event_loop_tick_i.h"
 
 #include <m-list.h>
-#include <m-bptree.h>
 #include <m-i-list.h>
 
 #include "thread.h"
@@ -30,19 +29,6 @@ struct FuriEventLoopItem {
 
 ILIST_DEF(WaitingList, FuriEventLoopItem, M_POD_OPLIST)
 
-/* Event Loop RB tree */
-#define FURI_EVENT_LOOP_TREE_RANK (4)
-
-BPTREE_DEF2( // NOLINT
-    FuriEventLoopTree,
-    FURI_EVENT_LOOP_TREE_RANK,
-    FuriEventLoopObject*, /* pointer to object we track */
-    M_PTR_OPLIST,
-    FuriEventLoopItem*, /* pointer to the FuriEventLoopItem */
-    M_PTR_OPLIST)
-
-#define M_OPL_FuriEventLoopTree_t() BPTREE_OPLIST(FuriEventLoopTree, M_POD_OPLIST)
-
 #define FURI_EVENT_LOOP_FLAG_NOTIFY_INDEX (2)
 
 typedef enum {
@@ -83,12 +69,11 @@ struct FuriEventLoop {
     // Poller state
     volatile FuriEventLoopState state;
 
-    // Event handling
-    FuriEventLoopTree_t tree;
+    // Event handling, subscriptions are tracked by object links
     WaitingList_t waiting_list;
 
-    // Active timer list
-    TimerList_t timer_list;
+    // Active timers, allocated on first timer start
+    FuriEventLoopTimerWheel* timer_wheel;
     // Timer request queue
     TimerQueue_t timer_queue;
     // Pending callback queue
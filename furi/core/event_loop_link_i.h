@@ -2,6 +2,9 @@
 
 #include "event_loop.h"
 
+#include <assert.h>
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -15,17 +18,31 @@ typedef struct {
     FuriEventLoopItem* item_out;
 } FuriEventLoopLink;
 
+// Link is placed right in front of the object, object alignment must be kept
+static_assert(sizeof(FuriEventLoopLink) % 8 == 0);
+
 void furi_event_loop_link_notify(FuriEventLoopLink* instance, FuriEventLoopEvent event);
 
-/* Contract between event loop and an object */
+/* Event Loop object allocation
+ *
+ * Objects that can be subscribed to are allocated with their link in front,
+ * so event loop can find subscription by object pointer without any lookup.
+ * Object itself keeps its own layout, FreeRTOS container stays first. */
+
+void* furi_event_loop_object_alloc(size_t size);
 
-typedef FuriEventLoopLink* (*FuriEventLoopContractGetLink)(FuriEventLoopObject* object);
+void furi_event_loop_object_free(FuriEventLoopObject* object);
+
+static inline FuriEventLoopLink* furi_event_loop_object_get_link(FuriEventLoopObject* object) {
+    return (FuriEventLoopLink*)object - 1;
+}
+
+/* Contract between event loop and an object */
 
 typedef uint32_t (
     *FuriEventLoopContractGetLevel)(FuriEventLoopObject* object, FuriEventLoopEvent event);
 
 typedef struct {
-    const FuriEventLoopContractGetLink get_link;
     const FuriEventLoopContractGetLevel get_level;
 } FuriEventLoopContract;
 
@@ -19,35 +19,196 @@ static inline uint32_t
     return elapsed_time < timer->interval ? timer->interval - elapsed_time : 0;
 }
 
-static inline bool furi_event_loop_timer_is_expired(const FuriEventLoopTimer* timer) {
-    return furi_event_loop_timer_get_elapsed_time(timer) >= timer->interval;
+/*
+ * Timer wheel
+ */
+
+#define WHEEL_BITS   FURI_EVENT_LOOP_TIMER_WHEEL_BITS
+#define WHEEL_MASK   FURI_EVENT_LOOP_TIMER_WHEEL_MASK
+#define WHEEL_LEVELS FURI_EVENT_LOOP_TIMER_WHEEL_LEVELS
+
+static inline uint32_t furi_event_loop_timer_wheel_index(uint32_t tick, uint32_t level) {
+    return (tick >> (level * WHEEL_BITS)) & WHEEL_MASK;
 }
 
-static void furi_event_loop_schedule_timer(FuriEventLoop* instance, FuriEventLoopTimer* timer) {
-    FuriEventLoopTimer* timer_pos = NULL;
+static bool furi_event_loop_timer_wheel_is_idle(const FuriEventLoopTimerWheel* wheel) {
+    for(uint32_t level = 0; level < WHEEL_LEVELS; level++) {
+        if(wheel->occupied[level]) return false;
+    }
+    return TimerList_empty_p(wheel->overflow);
+}
 
-    FURI_CRITICAL_ENTER();
+static void
+    furi_event_loop_timer_wheel_insert(FuriEventLoopTimerWheel* wheel, FuriEventLoopTimer* timer) {
+    const int32_t delta = (int32_t)(timer->expire - wheel->now);
 
-    const uint32_t remaining_time = furi_event_loop_timer_get_remaining_time_private(timer);
+    if(delta < 0) {
+        timer->level = FuriEventLoopTimerLevelExpired;
+        TimerList_push_back(wheel->expired, timer);
+        return;
+    }
 
-    TimerList_it_t it;
-    for(TimerList_it_last(it, instance->timer_list); !TimerList_end_p(it);
-        TimerList_previous(it)) {
-        FuriEventLoopTimer* tmp = TimerList_ref(it);
-        if(remaining_time >= furi_event_loop_timer_get_remaining_time_private(tmp)) {
-            timer_pos = tmp;
-            break;
+    for(uint32_t level = 0; level < WHEEL_LEVELS; level++) {
+        if((uint32_t)delta < (1UL << ((level + 1) * WHEEL_BITS))) {
+            const uint32_t slot = furi_event_loop_timer_wheel_index(timer->expire, level);
+            timer->level = level;
+            timer->slot = slot;
+            TimerList_push_back(wheel->slots[level][slot], timer);
+            wheel->occupied[level] |= 1U << slot;
+            return;
         }
     }
 
-    FURI_CRITICAL_EXIT();
+    timer->level = FuriEventLoopTimerLevelOverflow;
+    TimerList_push_back(wheel->overflow, timer);
+}
 
-    if(timer_pos) {
-        TimerList_push_after(timer_pos, timer);
-    } else {
-        TimerList_push_front(instance->timer_list, timer);
+static void
+    furi_event_loop_timer_wheel_remove(FuriEventLoopTimerWheel* wheel, FuriEventLoopTimer* timer) {
+    TimerList_unlink(timer);
+
+    if(timer->level < WHEEL_LEVELS) {
+        if(TimerList_empty_p(wheel->slots[timer->level][timer->slot])) {
+            wheel->occupied[timer->level] &= ~(1U << timer->slot);
+        }
+    }
+}
+
+// Redistribute slot timers to the lower levels
+static void furi_event_loop_timer_wheel_cascade(
+    FuriEventLoopTimerWheel* wheel,
+    TimerList_t list,
+    uint32_t level,
+    uint32_t slot) {
+    TimerList_t tmp;
+    TimerList_init(tmp);
+    TimerList_splice(tmp, list);
+
+    if(level < WHEEL_LEVELS) {
+        wheel->occupied[level] &= ~(1U << slot);
+    }
+
+    while(!TimerList_empty_p(tmp)) {
+        furi_event_loop_timer_wheel_insert(wheel, TimerList_pop_front(tmp));
+    }
+}
+
+// First tick at or after wheel->now with given number of low bits cleared
+static inline uint32_t furi_event_loop_timer_wheel_boundary(uint32_t now, uint32_t bits) {
+    const uint32_t mask = (1UL << bits) - 1;
+    return (now + mask) & ~mask;
+}
+
+// Earliest tick at which the wheel has work to do, wheel->now - 1 if none
+static uint32_t furi_event_loop_timer_wheel_get_next(const FuriEventLoopTimerWheel* wheel) {
+    const uint32_t now = wheel->now;
+    uint32_t next = now - 1;
+
+    for(uint32_t level = 0; level < WHEEL_LEVELS; level++) {
+        if(!wheel->occupied[level]) continue;
+
+        // Level slots are processed on level boundaries only
+        const uint32_t shift = level * WHEEL_BITS;
+        const uint32_t base = furi_event_loop_timer_wheel_boundary(now, shift);
+        const uint32_t index = furi_event_loop_timer_wheel_index(base, level);
+        const uint32_t ahead = wheel->occupied[level] & (0xFFFFU << index);
+
+        uint32_t candidate;
+        if(ahead) {
+            candidate = base + ((__builtin_ctz(ahead) - index) << shift);
+        } else {
+            // Wrapped slots are reached after upper level boundary, wake up there
+            candidate = furi_event_loop_timer_wheel_boundary(now, shift + WHEEL_BITS);
+        }
+
+        if(candidate - now < next - now) next = candidate;
+    }
+
+    if(!TimerList_empty_p(wheel->overflow)) {
+        const uint32_t candidate =
+            furi_event_loop_timer_wheel_boundary(now, WHEEL_LEVELS * WHEEL_BITS);
+        if(candidate - now < next - now) next = candidate;
     }
-    // At this point, TimerList_front() points to the first timer to expire
+
+    return next;
+}
+
+// Process wheel up to and including target tick
+static void furi_event_loop_timer_wheel_advance(FuriEventLoopTimerWheel* wheel, uint32_t target) {
+    while((int32_t)(target - wheel->now) >= 0) {
+        if(furi_event_loop_timer_wheel_index(wheel->now, 0) == 0) {
+            uint32_t level = 1;
+            for(; level < WHEEL_LEVELS; level++) {
+                const uint32_t slot = furi_event_loop_timer_wheel_index(wheel->now, level);
+                furi_event_loop_timer_wheel_cascade(
+                    wheel, wheel->slots[level][slot], level, slot);
+                if(slot) break;
+            }
+            if(level == WHEEL_LEVELS) {
+                furi_event_loop_timer_wheel_cascade(
+                    wheel, wheel->overflow, FuriEventLoopTimerLevelOverflow, 0);
+            }
+        }
+
+        const uint32_t slot = furi_event_loop_timer_wheel_index(wheel->now, 0);
+        if(wheel->occupied[0] & (1U << slot)) {
+            TimerList_it_t it;
+            for(TimerList_it(it, wheel->slots[0][slot]); !TimerList_end_p(it);
+                TimerList_next(it)) {
+                TimerList_ref(it)->level = FuriEventLoopTimerLevelExpired;
+            }
+            TimerList_splice(wheel->expired, wheel->slots[0][slot]);
+            wheel->occupied[0] &= ~(1U << slot);
+        }
+
+        wheel->now++;
+
+        // Skip ticks where nothing happens
+        const uint32_t next = furi_event_loop_timer_wheel_get_next(wheel);
+        const uint32_t end = target + 1;
+        wheel->now = (next - wheel->now < end - wheel->now) ? next : end;
+    }
+}
+
+static FuriEventLoopTimerWheel* furi_event_loop_timer_wheel_get(FuriEventLoop* instance) {
+    if(!instance->timer_wheel) {
+        FuriEventLoopTimerWheel* wheel = malloc(sizeof(FuriEventLoopTimerWheel));
+        wheel->now = xTaskGetTickCount();
+        wheel->count = 0;
+        for(uint32_t level = 0; level < WHEEL_LEVELS; level++) {
+            wheel->occupied[level] = 0;
+            for(uint32_t slot = 0; slot <= WHEEL_MASK; slot++) {
+                TimerList_init(wheel->slots[level][slot]);
+            }
+        }
+        TimerList_init(wheel->overflow);
+        TimerList_init(wheel->expired);
+        instance->timer_wheel = wheel;
+    }
+
+    return instance->timer_wheel;
+}
+
+static void furi_event_loop_schedule_timer(FuriEventLoop* instance, FuriEventLoopTimer* timer) {
+    FuriEventLoopTimerWheel* wheel = furi_event_loop_timer_wheel_get(instance);
+
+    // Nothing to process in between, fast forward
+    const uint32_t tick = xTaskGetTickCount();
+    if((int32_t)(tick - wheel->now) > 0 && furi_event_loop_timer_wheel_is_idle(wheel)) {
+        wheel->now = tick;
+    }
+
+    timer->expire = timer->start_time + timer->interval;
+    furi_event_loop_timer_wheel_insert(wheel, timer);
+    wheel->count++;
+}
+
+static void furi_event_loop_unschedule_timer(FuriEventLoop* instance, FuriEventLoopTimer* timer) {
+    FuriEventLoopTimerWheel* wheel = instance->timer_wheel;
+    furi_assert(wheel);
+
+    furi_event_loop_timer_wheel_remove(wheel, timer);
+    wheel->count--;
 }
 
 static void furi_event_loop_timer_enqueue_request(
@@ -75,15 +236,28 @@ static void furi_event_loop_timer_enqueue_request(
  * Private API
  */
 
+void furi_event_loop_timer_wheel_free(FuriEventLoop* instance) {
+    free(instance->timer_wheel);
+    instance->timer_wheel = NULL;
+}
+
+bool furi_event_loop_timer_wheel_is_empty(const FuriEventLoop* instance) {
+    return !instance->timer_wheel || instance->timer_wheel->count == 0;
+}
+
 uint32_t furi_event_loop_get_timer_wait_time(const FuriEventLoop* instance) {
-    uint32_t wait_time = FuriWaitForever;
+    const FuriEventLoopTimerWheel* wheel = instance->timer_wheel;
 
-    if(!TimerList_empty_p(instance->timer_list)) {
-        FuriEventLoopTimer* timer = TimerList_front(instance->timer_list);
-        wait_time = furi_event_loop_timer_get_remaining_time_private(timer);
+    if(!wheel || wheel->count == 0) {
+        return FuriWaitForever;
+    } else if(!TimerList_empty_p(wheel->expired)) {
+        return 0;
     }
 
-    return wait_time;
+    const uint32_t next = furi_event_loop_timer_wheel_get_next(wheel);
+    const int32_t wait_time = (int32_t)(next - xTaskGetTickCount());
+
+    return wait_time > 0 ? (uint32_t)wait_time : 0;
 }
 
 void furi_event_loop_process_timer_queue(FuriEventLoop* instance) {
@@ -91,7 +265,7 @@ void furi_event_loop_process_timer_queue(FuriEventLoop* instance) {
         FuriEventLoopTimer* timer = TimerQueue_pop_front(instance->timer_queue);
 
         if(timer->active) {
-            TimerList_unlink(timer);
+            furi_event_loop_unschedule_timer(instance, timer);
         }
 
         if(timer->request == FuriEventLoopTimerRequestStart) {
@@ -116,17 +290,21 @@ void furi_event_loop_process_timer_queue(FuriEventLoop* instance) {
 }
 
 bool furi_event_loop_process_expired_timers(FuriEventLoop* instance) {
-    if(TimerList_empty_p(instance->timer_list)) {
+    FuriEventLoopTimerWheel* wheel = instance->timer_wheel;
+
+    if(!wheel || wheel->count == 0) {
         return false;
     }
-    // The front() element contains the earliest-expiring timer
-    FuriEventLoopTimer* timer = TimerList_front(instance->timer_list);
 
-    if(!furi_event_loop_timer_is_expired(timer)) {
+    furi_event_loop_timer_wheel_advance(wheel, xTaskGetTickCount());
+
+    if(TimerList_empty_p(wheel->expired)) {
         return false;
     }
+    // Expired timers are kept in expiration order
+    FuriEventLoopTimer* timer = TimerList_front(wheel->expired);
 
-    TimerList_unlink(timer);
+    furi_event_loop_unschedule_timer(instance, timer);
 
     if(timer->periodic) {
         const uint32_t num_events =
@@ -20,9 +20,14 @@ struct FuriEventLoopTimer {
     uint32_t interval;
     uint32_t start_time;
     uint32_t next_interval;
+    // Expiration tick, start_time + interval
+    uint32_t expire;
 
-    // Interface for the active timer list
+    // Interface for the timer wheel slot lists
     ILIST_INTERFACE(TimerList, FuriEventLoopTimer);
+    // Wheel slot the timer is linked to
+    uint8_t level;
+    uint8_t slot;
 
     // Interface for the timer request queue
     ILIST_INTERFACE(TimerQueue, FuriEventLoopTimer);
@@ -36,6 +41,39 @@ struct FuriEventLoopTimer {
 ILIST_DEF(TimerList, FuriEventLoopTimer, M_POD_OPLIST)
 ILIST_DEF(TimerQueue, FuriEventLoopTimer, M_POD_OPLIST)
 
+/* Hierarchical timer wheel
+ *
+ * Level N slot covers 16^N ticks, timers are cascaded to lower levels when
+ * wheel time reaches their slot. Arming and stopping timer is O(1), no
+ * matter how many timers are active. */
+#define FURI_EVENT_LOOP_TIMER_WHEEL_BITS   (4U)
+#define FURI_EVENT_LOOP_TIMER_WHEEL_SLOTS  (1U << FURI_EVENT_LOOP_TIMER_WHEEL_BITS)
+#define FURI_EVENT_LOOP_TIMER_WHEEL_MASK   (FURI_EVENT_LOOP_TIMER_WHEEL_SLOTS - 1U)
+#define FURI_EVENT_LOOP_TIMER_WHEEL_LEVELS (4U)
+
+typedef enum {
+    FuriEventLoopTimerLevelOverflow = FURI_EVENT_LOOP_TIMER_WHEEL_LEVELS,
+    FuriEventLoopTimerLevelExpired,
+} FuriEventLoopTimerLevel;
+
+typedef struct {
+    // Next tick to process, timers expiring before it are in expired list
+    uint32_t now;
+    // Active timers count
+    size_t count;
+    // Non-empty slots, bit per slot
+    uint16_t occupied[FURI_EVENT_LOOP_TIMER_WHEEL_LEVELS];
+    TimerList_t slots[FURI_EVENT_LOOP_TIMER_WHEEL_LEVELS][FURI_EVENT_LOOP_TIMER_WHEEL_SLOTS];
+    // Timers beyond the last level
+    TimerList_t overflow;
+    // Timers ready to fire, in expiration order
+    TimerList_t expired;
+} FuriEventLoopTimerWheel;
+
+void furi_event_loop_timer_wheel_free(FuriEventLoop* instance);
+
+bool furi_event_loop_timer_wheel_is_empty(const FuriEventLoop* instance);
+
 uint32_t furi_event_loop_get_timer_wait_time(const FuriEventLoop* instance);
 
 void furi_event_loop_process_timer_queue(FuriEventLoop* instance);
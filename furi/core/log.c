@@ -1,17 +1,34 @@
 #include "log.h"
 #include "check.h"
 #include "mutex.h"
+#include "thread.h"
 #include <furi_hal.h>
 #include <m-list.h>
 
 LIST_DEF(FuriLogHandlersList, FuriLogHandler, M_POD_OPLIST)
 
+#define TAG "FuriLog"
+
 #define FURI_LOG_LEVEL_DEFAULT FuriLogLevelInfo
 
+#define FURI_LOG_DEFERRED_BUFFER_SIZE  2048U
+#define FURI_LOG_DEFERRED_RECORD_MAX   128U
+#define FURI_LOG_DEFERRED_STRING_MAX   48U
+#define FURI_LOG_DEFERRED_STRING_CUT   "..."
+#define FURI_LOG_DEFERRED_TEXT_MAX     256U
+#define FURI_LOG_DEFERRED_SPEC_MAX     16U
+#define FURI_LOG_DEFERRED_STACK_SIZE   2048U
+#define FURI_LOG_DEFERRED_FLAG_PENDING (1UL << 0)
+#define FURI_LOG_DEFERRED_POLL_MS      50U
+
+typedef struct FuriLogDeferred FuriLogDeferred;
+
 typedef struct {
     FuriLogLevel log_level;
     FuriMutex* mutex;
     FuriLogHandlersList_t tx_handlers;
+    FuriLogDeferred* deferred;
+    volatile bool deferred_enabled;
 } FuriLogParams;
 
 static FuriLogParams furi_log = {0};
@@ -107,12 +124,584 @@ void furi_log_puts(const char* data) {
     furi_log_tx((const uint8_t*)data, strlen(data));
 }
 
+/* Deferred logging
+ *
+ * Log site only captures timestamp, format pointer and raw arguments into a
+ * record in the ring buffer, formatting and handler calls are done later by
+ * low priority thread. Space in the ring is reserved in a short critical
+ * section, record is written outside of it and marked committed at the end,
+ * so producers never wait for each other or for the formatter and it is safe
+ * to log from interrupts.
+ *
+ * Only format strings, tags and string arguments from flash are referenced
+ * by pointer, everything else is copied: data in RAM, application images
+ * included, may be gone by the time record is formatted. Log calls that can
+ * not be captured in binary form (format in RAM, `*` width or precision,
+ * unknown conversions) are formatted at log site into text records. */
+
+typedef enum {
+    FuriLogRecordTypeNone = 0, /**< Reserved, not committed yet */
+    FuriLogRecordTypePad, /**< Unused space at the end of the ring */
+    FuriLogRecordTypeBinary, /**< Format pointer and raw arguments */
+    FuriLogRecordTypeText, /**< Tag and preformatted message */
+    FuriLogRecordTypeRaw, /**< Preformatted text without header */
+} FuriLogRecordType;
+
+typedef struct {
+    uint16_t size;
+    volatile uint8_t type;
+    uint8_t level;
+} FuriLogRecordHeader;
+
+typedef struct {
+    FuriLogRecordHeader header;
+    uint32_t timestamp;
+    const char* format;
+    uint32_t payload[];
+} FuriLogRecord;
+
+_Static_assert(sizeof(FuriLogRecordHeader) == 4, "Pad record must fit any ring remainder");
+
+typedef enum {
+    FuriLogArgNone,
+    FuriLogArgInt,
+    FuriLogArgLong,
+    FuriLogArgLongLong,
+    FuriLogArgSize,
+    FuriLogArgPointer,
+    FuriLogArgDouble,
+    FuriLogArgString,
+} FuriLogArgType;
+
+/* String argument: length word, then NUL terminated copy. Length of
+ * FURI_LOG_STRING_REF means the next word is a pointer to flash. */
+#define FURI_LOG_STRING_REF UINT32_MAX
+
+struct FuriLogDeferred {
+    uint8_t* buffer;
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    volatile uint32_t dropped;
+    uint32_t binary;
+    uint32_t text;
+    FuriThread* thread;
+};
+
+static inline bool furi_log_is_flash(const void* ptr) {
+    return (uintptr_t)ptr >= FLASH_BASE && (uintptr_t)ptr < FLASH_BASE + FLASH_SIZE;
+}
+
+/** Parse conversion specification
+ *
+ * @param      spec  specification right after '%'
+ * @param[out] type  argument type
+ *
+ * @return     pointer right after specification, NULL if unsupported
+ */
+static const char* furi_log_spec_parse(const char* spec, FuriLogArgType* type) {
+    while(*spec && strchr("-+ #0", *spec)) spec++;
+    while(*spec >= '0' && *spec <= '9') spec++;
+    if(*spec == '.') {
+        spec++;
+        while(*spec >= '0' && *spec <= '9') spec++;
+    }
+
+    FuriLogArgType int_type = FuriLogArgInt;
+    if(spec[0] == 'h') {
+        spec += (spec[1] == 'h') ? 2 : 1;
+    } else if(spec[0] == 'l' && spec[1] == 'l') {
+        int_type = FuriLogArgLongLong;
+        spec += 2;
+    } else if(spec[0] == 'l') {
+        int_type = FuriLogArgLong;
+        spec++;
+    } else if(spec[0] == 'j') {
+        int_type = FuriLogArgLongLong;
+        spec++;
+    } else if(spec[0] == 'z' || spec[0] == 't') {
+        int_type = FuriLogArgSize;
+        spec++;
+    }
+
+    switch(*spec) {
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+        *type = int_type;
+        break;
+    case 'c':
+        *type = FuriLogArgInt;
+        break;
+    case 'p':
+        *type = FuriLogArgPointer;
+        break;
+    case 's':
+        if(int_type != FuriLogArgInt) return NULL;
+        *type = FuriLogArgString;
+        break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        *type = FuriLogArgDouble;
+        break;
+    case '%':
+        *type = FuriLogArgNone;
+        break;
+    default:
+        // '*', 'n', wide and long double arguments
+        return NULL;
+    }
+
+    return spec + 1;
+}
+
+static size_t furi_log_arg_words(FuriLogArgType type) {
+    switch(type) {
+    case FuriLogArgLongLong:
+        return (sizeof(long long) + 3) / 4;
+    case FuriLogArgLong:
+        return (sizeof(long) + 3) / 4;
+    case FuriLogArgSize:
+        return (sizeof(size_t) + 3) / 4;
+    case FuriLogArgPointer:
+        return (sizeof(void*) + 3) / 4;
+    case FuriLogArgDouble:
+        return (sizeof(double) + 3) / 4;
+    default:
+        return 1;
+    }
+}
+
+static bool furi_log_pack_string(uint32_t** out, uint32_t* end, const char* str) {
+    if(!str) str = "(null)";
+
+    if(furi_log_is_flash(str)) {
+        if(end - *out < 1 + (ptrdiff_t)furi_log_arg_words(FuriLogArgPointer)) return false;
+        *(*out)++ = FURI_LOG_STRING_REF;
+        memcpy(*out, &str, sizeof(str));
+        *out += furi_log_arg_words(FuriLogArgPointer);
+    } else {
+        size_t len = strnlen(str, FURI_LOG_DEFERRED_STRING_MAX + 1);
+        const bool cut = len > FURI_LOG_DEFERRED_STRING_MAX;
+        if(cut) len = FURI_LOG_DEFERRED_STRING_MAX;
+        const size_t cut_len = cut ? strlen(FURI_LOG_DEFERRED_STRING_CUT) : 0;
+        size_t words = (len + cut_len + 1 + 3) / 4;
+        if(end - *out < 1 + (ptrdiff_t)words) return false;
+        *(*out)++ = len + cut_len;
+        memcpy(*out, str, len);
+        memcpy((char*)*out + len, FURI_LOG_DEFERRED_STRING_CUT, cut_len);
+        ((char*)*out)[len + cut_len] = '\0';
+        *out += words;
+    }
+    return true;
+}
+
+static const char* furi_log_unpack_string(const uint32_t** in) {
+    uint32_t len = *(*in)++;
+    const char* str;
+    if(len == FURI_LOG_STRING_REF) {
+        memcpy(&str, *in, sizeof(str));
+        *in += furi_log_arg_words(FuriLogArgPointer);
+    } else {
+        str = (const char*)*in;
+        *in += (len + 1 + 3) / 4;
+    }
+    return str;
+}
+
+/** Capture arguments, returns number of payload words or -1 if not possible */
+static int32_t furi_log_pack_args(
+    uint32_t* payload,
+    size_t payload_words,
+    const char* tag,
+    const char* format,
+    va_list args) {
+    uint32_t* out = payload;
+    uint32_t* end = payload + payload_words;
+
+    if(!furi_log_pack_string(&out, end, tag)) return -1;
+
+    for(const char* ptr = format; *ptr;) {
+        if(*ptr++ != '%') continue;
+
+        FuriLogArgType type;
+        ptr = furi_log_spec_parse(ptr, &type);
+        if(!ptr) return -1;
+        if(type == FuriLogArgNone) continue;
+
+        if(type == FuriLogArgString) {
+            if(!furi_log_pack_string(&out, end, va_arg(args, const char*))) return -1;
+            continue;
+        }
+
+        size_t words = furi_log_arg_words(type);
+        if(end - out < (ptrdiff_t)words) return -1;
+
+        if(type == FuriLogArgInt) {
+            int value = va_arg(args, int);
+            memcpy(out, &value, sizeof(value));
+        } else if(type == FuriLogArgLong) {
+            long value = va_arg(args, long);
+            memcpy(out, &value, sizeof(value));
+        } else if(type == FuriLogArgLongLong) {
+            long long value = va_arg(args, long long);
+            memcpy(out, &value, sizeof(value));
+        } else if(type == FuriLogArgSize) {
+            size_t value = va_arg(args, size_t);
+            memcpy(out, &value, sizeof(value));
+        } else if(type == FuriLogArgPointer) {
+            void* value = va_arg(args, void*);
+            memcpy(out, &value, sizeof(value));
+        } else {
+            double value = va_arg(args, double);
+            memcpy(out, &value, sizeof(value));
+        }
+        out += words;
+    }
+
+    return out - payload;
+}
+
+/** Format captured arguments, one conversion at a time */
+static void furi_log_format_args(FuriString* string, const char* format, const uint32_t* in) {
+    char spec[FURI_LOG_DEFERRED_SPEC_MAX];
+
+    for(const char* ptr = format; *ptr;) {
+        const char* literal = ptr;
+        while(*ptr && *ptr != '%') ptr++;
+        if(ptr != literal) {
+            furi_string_cat_printf(string, "%.*s", (int)(ptr - literal), literal);
+        }
+        if(!*ptr) break;
+
+        FuriLogArgType type;
+        const char* spec_end = furi_log_spec_parse(ptr + 1, &type);
+        furi_check(spec_end);
+        size_t spec_len = MIN((size_t)(spec_end - ptr), sizeof(spec) - 1);
+        memcpy(spec, ptr, spec_len);
+        spec[spec_len] = '\0';
+        ptr = spec_end;
+
+        if(type == FuriLogArgNone) {
+            furi_string_push_back(string, '%');
+        } else if(type == FuriLogArgString) {
+            furi_string_cat_printf(string, spec, furi_log_unpack_string(&in));
+        } else if(type == FuriLogArgInt) {
+            int value;
+            memcpy(&value, in, sizeof(value));
+            furi_string_cat_printf(string, spec, value);
+        } else if(type == FuriLogArgLong) {
+            long value;
+            memcpy(&value, in, sizeof(value));
+            furi_string_cat_printf(string, spec, value);
+        } else if(type == FuriLogArgLongLong) {
+            long long value;
+            memcpy(&value, in, sizeof(value));
+            furi_string_cat_printf(string, spec, value);
+        } else if(type == FuriLogArgSize) {
+            size_t value;
+            memcpy(&value, in, sizeof(value));
+            furi_string_cat_printf(string, spec, value);
+        } else if(type == FuriLogArgPointer) {
+            void* value;
+            memcpy(&value, in, sizeof(value));
+            furi_string_cat_printf(string, spec, value);
+        } else {
+            double value;
+            memcpy(&value, in, sizeof(value));
+            furi_string_cat_printf(string, spec, value);
+        }
+
+        if(type != FuriLogArgString && type != FuriLogArgNone) {
+            in += furi_log_arg_words(type);
+        }
+    }
+}
+
+static FuriLogRecordHeader*
+    furi_log_deferred_reserve(FuriLogDeferred* deferred, size_t size, bool binary) {
+    FuriLogRecordHeader* header = NULL;
+    bool notify = false;
+
+    FURI_CRITICAL_ENTER();
+    uint32_t offset = deferred->head % FURI_LOG_DEFERRED_BUFFER_SIZE;
+    uint32_t contiguous = FURI_LOG_DEFERRED_BUFFER_SIZE - offset;
+    uint32_t needed = size + ((size > contiguous) ? contiguous : 0);
+    uint32_t used = deferred->head - deferred->tail;
+
+    if(FURI_LOG_DEFERRED_BUFFER_SIZE - used < needed) {
+        deferred->dropped++;
+    } else {
+        if(size > contiguous) {
+            FuriLogRecordHeader* pad = (FuriLogRecordHeader*)&deferred->buffer[offset];
+            pad->size = contiguous;
+            pad->type = FuriLogRecordTypePad;
+            deferred->head += contiguous;
+            offset = 0;
+        }
+        header = (FuriLogRecordHeader*)&deferred->buffer[offset];
+        header->size = size;
+        header->type = FuriLogRecordTypeNone;
+        deferred->head += size;
+        notify = (used == 0);
+        if(binary) {
+            deferred->binary++;
+        } else {
+            deferred->text++;
+        }
+    }
+    FURI_CRITICAL_EXIT();
+
+    if(notify) {
+        FuriThreadId thread_id = furi_thread_get_id(deferred->thread);
+        furi_thread_flags_set(thread_id, FURI_LOG_DEFERRED_FLAG_PENDING);
+    }
+
+    return header;
+}
+
+static inline void furi_log_deferred_commit(FuriLogRecordHeader* header, FuriLogRecordType type) {
+    // Record contents must be visible before type
+    __DMB();
+    header->type = type;
+}
+
+/** Store preformatted text, returns false if it does not fit into record */
+static bool furi_log_deferred_text(
+    FuriLogLevel level,
+    FuriLogRecordType type,
+    const char* tag,
+    const char* text) {
+    uint32_t payload[FURI_LOG_DEFERRED_TEXT_MAX / 4];
+    uint32_t* out = payload;
+    uint32_t* end = payload + COUNT_OF(payload);
+
+    if(tag && !furi_log_pack_string(&out, end, tag)) return false;
+
+    size_t len = strlen(text);
+    size_t words = (len + 1 + 3) / 4;
+    if(end - out < (ptrdiff_t)words) return false;
+    memcpy(out, text, len + 1);
+    out += words;
+
+    size_t size = sizeof(FuriLogRecord) + (out - payload) * 4;
+    FuriLogRecord* record =
+        (FuriLogRecord*)furi_log_deferred_reserve(furi_log.deferred, size, false);
+    if(record) {
+        record->header.level = level;
+        record->timestamp = furi_get_tick();
+        record->format = NULL;
+        memcpy(record->payload, payload, size - sizeof(FuriLogRecord));
+        furi_log_deferred_commit(&record->header, type);
+    }
+
+    return true;
+}
+
+static void furi_log_deferred_print(
+    FuriLogLevel level,
+    const char* tag,
+    const char* format,
+    va_list args) {
+    uint32_t payload[(FURI_LOG_DEFERRED_RECORD_MAX - sizeof(FuriLogRecord)) / 4];
+    int32_t words = -1;
+
+    if(furi_log_is_flash(format)) {
+        va_list args_copy;
+        va_copy(args_copy, args);
+        words = furi_log_pack_args(payload, COUNT_OF(payload), tag, format, args_copy);
+        va_end(args_copy);
+    }
+
+    if(words >= 0) {
+        size_t size = sizeof(FuriLogRecord) + words * 4;
+        FuriLogRecord* record =
+            (FuriLogRecord*)furi_log_deferred_reserve(furi_log.deferred, size, true);
+        if(record) {
+            record->header.level = level;
+            record->timestamp = furi_get_tick();
+            record->format = format;
+            memcpy(record->payload, payload, words * 4);
+            furi_log_deferred_commit(&record->header, FuriLogRecordTypeBinary);
+        }
+    } else if(!FURI_IS_ISR()) {
+        // Not capturable, format right here but still output from log thread
+        FuriString* string = furi_string_alloc_vprintf(format, args);
+        if(furi_string_size(string) > FURI_LOG_DEFERRED_TEXT_MAX / 2) {
+            furi_string_left(string, FURI_LOG_DEFERRED_TEXT_MAX / 2);
+        }
+        furi_log_deferred_text(level, FuriLogRecordTypeText, tag, furi_string_get_cstr(string));
+        furi_string_free(string);
+    } else {
+        FURI_CRITICAL_ENTER();
+        furi_log.deferred->dropped++;
+        FURI_CRITICAL_EXIT();
+    }
+}
+
+static const char* furi_log_level_color(FuriLogLevel level, const char** log_letter) {
+    switch(level) {
+    case FuriLogLevelError:
+        *log_letter = "E";
+        return _FURI_LOG_CLR_E;
+    case FuriLogLevelWarn:
+        *log_letter = "W";
+        return _FURI_LOG_CLR_W;
+    case FuriLogLevelInfo:
+        *log_letter = "I";
+        return _FURI_LOG_CLR_I;
+    case FuriLogLevelDebug:
+        *log_letter = "D";
+        return _FURI_LOG_CLR_D;
+    case FuriLogLevelTrace:
+        *log_letter = "T";
+        return _FURI_LOG_CLR_T;
+    default:
+        *log_letter = " ";
+        return _FURI_LOG_CLR_RESET;
+    }
+}
+
+static void furi_log_deferred_output(FuriLogRecord* record, FuriString* string) {
+    if(record->header.type == FuriLogRecordTypeRaw) {
+        furi_log_puts((const char*)record->payload);
+        return;
+    }
+
+    const char* log_letter;
+    const char* color = furi_log_level_color(record->header.level, &log_letter);
+
+    const uint32_t* in = record->payload;
+    const char* tag = furi_log_unpack_string(&in);
+    furi_string_printf(
+        string, "%lu %s[%s][%s] " _FURI_LOG_CLR_RESET, record->timestamp, color, log_letter, tag);
+
+    if(record->header.type == FuriLogRecordTypeBinary) {
+        furi_log_format_args(string, record->format, in);
+    } else {
+        furi_string_cat_str(string, (const char*)in);
+    }
+    furi_string_cat_str(string, "\r\n");
+
+    furi_log_puts(furi_string_get_cstr(string));
+}
+
+static int32_t furi_log_deferred_worker(void* context) {
+    FuriLogDeferred* deferred = context;
+    FuriString* string = furi_string_alloc();
+    uint32_t dropped_reported = 0;
+
+    while(true) {
+        // Poll only for records whose producer was preempted before commit
+        const bool idle = !furi_log.deferred_enabled && (deferred->tail == deferred->head);
+        furi_thread_flags_wait(
+            FURI_LOG_DEFERRED_FLAG_PENDING,
+            FuriFlagWaitAny,
+            idle ? FuriWaitForever : FURI_LOG_DEFERRED_POLL_MS);
+
+        while(deferred->tail != deferred->head) {
+            uint32_t offset = deferred->tail % FURI_LOG_DEFERRED_BUFFER_SIZE;
+            FuriLogRecord* record = (FuriLogRecord*)&deferred->buffer[offset];
+            // Producer was preempted before commit, pick it up on the next round
+            if(record->header.type == FuriLogRecordTypeNone) break;
+            __DMB();
+
+            if(record->header.type != FuriLogRecordTypePad &&
+               furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
+                furi_log_deferred_output(record, string);
+                furi_mutex_release(furi_log.mutex);
+            }
+
+            FURI_CRITICAL_ENTER();
+            deferred->tail += record->header.size;
+            FURI_CRITICAL_EXIT();
+        }
+
+        uint32_t dropped = deferred->dropped;
+        if(dropped != dropped_reported) {
+            furi_string_printf(
+                string, "[log: %lu records dropped]\r\n", dropped - dropped_reported);
+            furi_log_puts(furi_string_get_cstr(string));
+            dropped_reported = dropped;
+        }
+    }
+
+    furi_string_free(string);
+    return 0;
+}
+
+void furi_log_set_deferred(bool enable) {
+    furi_check(!FURI_IS_ISR());
+
+    furi_check(furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk);
+    // Ring and thread are kept once started: producers may still hold a reservation
+    if(enable && !furi_log.deferred) {
+        FuriLogDeferred* deferred = malloc(sizeof(FuriLogDeferred));
+        deferred->buffer = malloc(FURI_LOG_DEFERRED_BUFFER_SIZE);
+        deferred->head = 0;
+        deferred->tail = 0;
+        deferred->dropped = 0;
+        deferred->thread = furi_thread_alloc_ex(
+            "LogWorker", FURI_LOG_DEFERRED_STACK_SIZE, furi_log_deferred_worker, deferred);
+        furi_thread_set_priority(deferred->thread, FuriThreadPriorityLowest);
+        furi_thread_start(deferred->thread);
+        furi_log.deferred = deferred;
+    }
+    const bool enabled = enable && !furi_log.deferred_enabled;
+    furi_log.deferred_enabled = enable;
+    furi_mutex_release(furi_log.mutex);
+
+    if(enabled) {
+        FURI_LOG_I(
+            TAG,
+            "Deferred logging enabled by %s",
+            furi_thread_get_name(furi_thread_get_current_id()));
+    }
+}
+
+bool furi_log_is_deferred(void) {
+    return furi_log.deferred_enabled;
+}
+
+uint32_t furi_log_get_dropped(void) {
+    return furi_log.deferred ? furi_log.deferred->dropped : 0;
+}
+
+void furi_log_get_deferred_stats(FuriLogDeferredStats* stats) {
+    furi_check(stats);
+
+    memset(stats, 0, sizeof(FuriLogDeferredStats));
+    if(furi_log.deferred) {
+        FURI_CRITICAL_ENTER();
+        stats->binary = furi_log.deferred->binary;
+        stats->text = furi_log.deferred->text;
+        stats->dropped = furi_log.deferred->dropped;
+        FURI_CRITICAL_EXIT();
+    }
+}
+
 void furi_log_print_format(FuriLogLevel level, const char* tag, const char* format, ...) {
     do {
         if(level > furi_log.log_level) {
             break;
         }
 
+        if(furi_log.deferred_enabled) {
+            va_list args;
+            va_start(args, format);
+            furi_log_deferred_print(level, tag, format, args);
+            va_end(args);
+            break;
+        }
+
         if(furi_mutex_acquire(furi_log.mutex, furi_kernel_is_running() ? FuriWaitForever : 0) !=
            FuriStatusOk) {
             break;
@@ -120,32 +709,8 @@ void furi_log_print_format(FuriLogLevel level, const char* tag, const char* form
 
         FuriString* string = furi_string_alloc();
 
-        const char* color = _FURI_LOG_CLR_RESET;
-        const char* log_letter = " ";
-        switch(level) {
-        case FuriLogLevelError:
-            color = _FURI_LOG_CLR_E;
-            log_letter = "E";
-            break;
-        case FuriLogLevelWarn:
-            color = _FURI_LOG_CLR_W;
-            log_letter = "W";
-            break;
-        case FuriLogLevelInfo:
-            color = _FURI_LOG_CLR_I;
-            log_letter = "I";
-            break;
-        case FuriLogLevelDebug:
-            color = _FURI_LOG_CLR_D;
-            log_letter = "D";
-            break;
-        case FuriLogLevelTrace:
-            color = _FURI_LOG_CLR_T;
-            log_letter = "T";
-            break;
-        default:
-            break;
-        }
+        const char* log_letter;
+        const char* color = furi_log_level_color(level, &log_letter);
 
         // Timestamp
         furi_string_printf(
@@ -177,7 +742,12 @@ void furi_log_print_raw_format(FuriLogLevel level, const char* format, ...) {
         furi_string_vprintf(string, format, args);
         va_end(args);
 
-        furi_log_puts(furi_string_get_cstr(string));
+        // Keep order with deferred records, large dumps go out right away
+        if(!furi_log.deferred_enabled ||
+           !furi_log_deferred_text(
+               level, FuriLogRecordTypeRaw, NULL, furi_string_get_cstr(string))) {
+            furi_log_puts(furi_string_get_cstr(string));
+        }
         furi_string_free(string);
 
         furi_mutex_release(furi_log.mutex);
@@ -109,6 +109,44 @@ void furi_log_set_level(FuriLogLevel level);
  */
 FuriLogLevel furi_log_get_level(void);
 
+/** Deferred logging statistics, counted since boot */
+typedef struct {
+    uint32_t binary; /**< Records captured as format pointer and raw arguments */
+    uint32_t text; /**< Records formatted at log site: format not in flash or not capturable */
+    uint32_t dropped; /**< Records dropped because ring buffer was full */
+} FuriLogDeferredStats;
+
+/** Enable or disable deferred logging
+ *
+ * In deferred mode log calls only capture arguments into a ring buffer, text
+ * is formatted and sent to handlers by a low priority thread. Log calls become
+ * much cheaper and usable from interrupts, but records are dropped when ring
+ * buffer is full. Only formats located in firmware flash are captured in
+ * binary form, string arguments in RAM are copied and cut to 48 characters,
+ * cut is marked with "...".
+ *
+ * @param[in]  enable  true to enable deferred mode
+ */
+void furi_log_set_deferred(bool enable);
+
+/** Check if deferred logging is enabled
+ *
+ * @return     true if deferred mode is enabled
+ */
+bool furi_log_is_deferred(void);
+
+/** Get count of records dropped in deferred mode
+ *
+ * @return     dropped records count since boot
+ */
+uint32_t furi_log_get_dropped(void);
+
+/** Get deferred logging statistics
+ *
+ * @param[out] stats  statistics
+ */
+void furi_log_get_deferred_stats(FuriLogDeferredStats* stats);
+
 /** Log level to string
  *
  * @param[in]  level  The level
@@ -15,7 +15,6 @@
 
 struct FuriMessageQueue {
     StaticQueue_t container;
-    FuriEventLoopLink event_loop_link;
     uint8_t buffer[];
 };
 
@@ -27,7 +26,8 @@ static_assert(offsetof(FuriMessageQueue, buffer) == sizeof(FuriMessageQueue));
 FuriMessageQueue* furi_message_queue_alloc(uint32_t msg_count, uint32_t msg_size) {
     furi_check((furi_kernel_is_irq_or_masked() == 0U) && (msg_count > 0U) && (msg_size > 0U));
 
-    FuriMessageQueue* instance = malloc(sizeof(FuriMessageQueue) + msg_count * msg_size);
+    FuriMessageQueue* instance =
+        furi_event_loop_object_alloc(sizeof(FuriMessageQueue) + msg_count * msg_size);
 
     // 3 things happens here:
     // - create queue
@@ -47,11 +47,12 @@ void furi_message_queue_free(FuriMessageQueue* instance) {
     furi_check(instance);
 
     // Event Loop must be disconnected
-    furi_check(!instance->event_loop_link.item_in);
-    furi_check(!instance->event_loop_link.item_out);
+    FuriEventLoopLink* link = furi_event_loop_object_get_link(instance);
+    furi_check(!link->item_in);
+    furi_check(!link->item_out);
 
     vQueueDelete((QueueHandle_t)instance);
-    free(instance);
+    furi_event_loop_object_free(instance);
 }
 
 FuriStatus
@@ -91,7 +92,8 @@ FuriStatus
     }
 
     if(stat == FuriStatusOk) {
-        furi_event_loop_link_notify(&instance->event_loop_link, FuriEventLoopEventIn);
+        furi_event_loop_link_notify(
+            furi_event_loop_object_get_link(instance), FuriEventLoopEventIn);
     }
 
     /* Return execution status */
@@ -134,7 +136,8 @@ FuriStatus furi_message_queue_get(FuriMessageQueue* instance, void* msg_ptr, uin
     }
 
     if(stat == FuriStatusOk) {
-        furi_event_loop_link_notify(&instance->event_loop_link, FuriEventLoopEventOut);
+        furi_event_loop_link_notify(
+            furi_event_loop_object_get_link(instance), FuriEventLoopEventOut);
     }
 
     return stat;
@@ -200,19 +203,14 @@ FuriStatus furi_message_queue_reset(FuriMessageQueue* instance) {
     }
 
     if(stat == FuriStatusOk) {
-        furi_event_loop_link_notify(&instance->event_loop_link, FuriEventLoopEventOut);
+        furi_event_loop_link_notify(
+            furi_event_loop_object_get_link(instance), FuriEventLoopEventOut);
     }
 
     /* Return execution status */
     return stat;
 }
 
-static FuriEventLoopLink* furi_message_queue_event_loop_get_link(FuriEventLoopObject* object) {
-    FuriMessageQueue* instance = object;
-    furi_assert(instance);
-    return &instance->event_loop_link;
-}
-
 static uint32_t
     furi_message_queue_event_loop_get_level(FuriEventLoopObject* object, FuriEventLoopEvent event) {
     FuriMessageQueue* instance = object;
@@ -228,6 +226,5 @@ static uint32_t
 }
 
 const FuriEventLoopContract furi_message_queue_event_loop_contract = {
-    .get_link = furi_message_queue_event_loop_get_link,
     .get_level = furi_message_queue_event_loop_get_level,
 };
@@ -12,7 +12,6 @@
 
 struct FuriMutex {
     StaticSemaphore_t container;
-    FuriEventLoopLink event_loop_link;
 };
 
 // IMPORTANT: container MUST be the FIRST struct member
@@ -21,7 +20,7 @@ static_assert(offsetof(FuriMutex, container) == 0);
 FuriMutex* furi_mutex_alloc(FuriMutexType type) {
     furi_check(!FURI_IS_IRQ_MODE());
 
-    FuriMutex* instance = malloc(sizeof(FuriMutex));
+    FuriMutex* instance = furi_event_loop_object_alloc(sizeof(FuriMutex));
 
     SemaphoreHandle_t hMutex;
 
@@ -43,11 +42,12 @@ void furi_mutex_free(FuriMutex* instance) {
     furi_check(instance);
 
     // Event Loop must be disconnected
-    furi_check(!instance->event_loop_link.item_in);
-    furi_check(!instance->event_loop_link.item_out);
+    FuriEventLoopLink* link = furi_event_loop_object_get_link(instance);
+    furi_check(!link->item_in);
+    furi_check(!link->item_out);
 
     vSemaphoreDelete((SemaphoreHandle_t)instance);
-    free(instance);
+    furi_event_loop_object_free(instance);
 }
 
 FuriStatus furi_mutex_acquire(FuriMutex* instance, uint32_t timeout) {
@@ -84,7 +84,8 @@ FuriStatus furi_mutex_acquire(FuriMutex* instance, uint32_t timeout) {
     }
 
     if(stat == FuriStatusOk) {
-        furi_event_loop_link_notify(&instance->event_loop_link, FuriEventLoopEventOut);
+        furi_event_loop_link_notify(
+            furi_event_loop_object_get_link(instance), FuriEventLoopEventOut);
     }
 
     return stat;
@@ -116,7 +117,8 @@ FuriStatus furi_mutex_release(FuriMutex* instance) {
     }
 
     if(stat == FuriStatusOk) {
-        furi_event_loop_link_notify(&instance->event_loop_link, FuriEventLoopEventIn);
+        furi_event_loop_link_notify(
+            furi_event_loop_object_get_link(instance), FuriEventLoopEventIn);
     }
 
     return stat;
@@ -138,12 +140,6 @@ FuriThreadId furi_mutex_get_owner(FuriMutex* instance) {
     return owner;
 }
 
-static FuriEventLoopLink* furi_mutex_event_loop_get_link(FuriEventLoopObject* object) {
-    FuriMutex* instance = object;
-    furi_assert(instance);
-    return &instance->event_loop_link;
-}
-
 static uint32_t
     furi_mutex_event_loop_get_level(FuriEventLoopObject* object, FuriEventLoopEvent event) {
     FuriMutex* instance = object;
@@ -157,6 +153,5 @@ static uint32_t
 }
 
 const FuriEventLoopContract furi_mutex_event_loop_contract = {
-    .get_link = furi_mutex_event_loop_get_link,
     .get_level = furi_mutex_event_loop_get_level,
 };
@@ -1,27 +1,100 @@
 #include "pubsub.h"
 #include "check.h"
+#include "common_defines.h"
+#include "kernel.h"
+#include "message_queue.h"
 #include "mutex.h"
 
-#include <m-list.h>
+#include <furi_hal.h>
+#include <string.h>
 
 struct FuriPubSubSubscription {
     FuriPubSubCallback callback;
     void* callback_context;
+    // Deferred delivery only
+    FuriEventLoop* event_loop;
+    FuriMessageQueue* queue;
+    void* message;
 };
 
-LIST_DEF(FuriPubSubSubscriptionList, FuriPubSubSubscription, M_POD_OPLIST);
+/* Immutable snapshot of subscribers
+ *
+ * Publishers pin current snapshot and walk it without any lock. Subscribe and
+ * unsubscribe build a new snapshot and swap it in, old one is freed by whoever
+ * drops the last reference. Pointer swap and reference counting are done in
+ * a few instruction long critical sections.
+ *
+ * Every swapped out snapshot pins the one that replaced it until it is freed,
+ * so a snapshot with a single reference left has no publishers on it or on
+ * any older snapshot. Unsubscribe waits for that before freeing subscription. */
+typedef struct FuriPubSubList FuriPubSubList;
+
+struct FuriPubSubList {
+    size_t refs;
+    FuriPubSubList* next;
+    size_t count;
+    FuriPubSubSubscription* items[];
+};
 
 struct FuriPubSub {
-    FuriPubSubSubscriptionList_t items;
+    FuriPubSubList* list;
+    // Serializes subscribe and unsubscribe, never taken on publish
     FuriMutex* mutex;
+    // Guarded by critical section
+    uint32_t published;
+    uint32_t dropped;
+    uint32_t queue_depth_max;
+    uint32_t latency_max;
+    uint64_t latency_total;
 };
 
+static FuriPubSubList* furi_pubsub_list_alloc(size_t count) {
+    FuriPubSubList* list =
+        malloc(sizeof(FuriPubSubList) + count * sizeof(FuriPubSubSubscription*));
+    // Reference of FuriPubSub itself, as long as the list is current one
+    list->refs = 1;
+    list->next = NULL;
+    list->count = count;
+    return list;
+}
+
+static FuriPubSubList* furi_pubsub_list_pin(FuriPubSub* pubsub) {
+    FURI_CRITICAL_ENTER();
+    FuriPubSubList* list = pubsub->list;
+    list->refs++;
+    FURI_CRITICAL_EXIT();
+    return list;
+}
+
+static void furi_pubsub_list_unpin(FuriPubSubList* list) {
+    while(list) {
+        FURI_CRITICAL_ENTER();
+        bool last = (--list->refs == 0);
+        FURI_CRITICAL_EXIT();
+        if(!last) break;
+        // Freed snapshot releases the one that replaced it
+        FuriPubSubList* next = list->next;
+        free(list);
+        list = next;
+    }
+}
+
+/* Returns old list with reference of FuriPubSub, caller owns it now */
+static FuriPubSubList* furi_pubsub_list_swap(FuriPubSub* pubsub, FuriPubSubList* list) {
+    FURI_CRITICAL_ENTER();
+    FuriPubSubList* old_list = pubsub->list;
+    old_list->next = list;
+    list->refs++;
+    pubsub->list = list;
+    FURI_CRITICAL_EXIT();
+    return old_list;
+}
+
 FuriPubSub* furi_pubsub_alloc(void) {
     FuriPubSub* pubsub = malloc(sizeof(FuriPubSub));
 
     pubsub->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
-
-    FuriPubSubSubscriptionList_init(pubsub->items);
+    pubsub->list = furi_pubsub_list_alloc(0);
 
     return pubsub;
 }
@@ -29,29 +102,82 @@ FuriPubSub* furi_pubsub_alloc(void) {
 void furi_pubsub_free(FuriPubSub* pubsub) {
     furi_assert(pubsub);
 
-    furi_check(FuriPubSubSubscriptionList_size(pubsub->items) == 0);
+    furi_check(pubsub->list->count == 0);
+    furi_check(pubsub->list->refs == 1);
 
-    FuriPubSubSubscriptionList_clear(pubsub->items);
+    free(pubsub->list);
 
     furi_mutex_free(pubsub->mutex);
 
     free(pubsub);
 }
 
+static void furi_pubsub_add(FuriPubSub* pubsub, FuriPubSubSubscription* item) {
+    furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
+
+    FuriPubSubList* old_list = pubsub->list;
+    FuriPubSubList* list = furi_pubsub_list_alloc(old_list->count + 1);
+    memcpy(list->items, old_list->items, old_list->count * sizeof(FuriPubSubSubscription*));
+    list->items[old_list->count] = item;
+
+    // Publishers may still walk old list, last of them frees it
+    furi_pubsub_list_unpin(furi_pubsub_list_swap(pubsub, list));
+
+    furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
+}
+
 FuriPubSubSubscription*
     furi_pubsub_subscribe(FuriPubSub* pubsub, FuriPubSubCallback callback, void* callback_context) {
     furi_check(pubsub);
     furi_check(callback);
 
-    furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
-    // put uninitialized item to the list
-    FuriPubSubSubscription* item = FuriPubSubSubscriptionList_push_raw(pubsub->items);
+    FuriPubSubSubscription* item = malloc(sizeof(FuriPubSubSubscription));
+    item->callback = callback;
+    item->callback_context = callback_context;
+    item->event_loop = NULL;
+    item->queue = NULL;
+    item->message = NULL;
+
+    furi_pubsub_add(pubsub, item);
 
-    // initialize item
+    return item;
+}
+
+static bool furi_pubsub_deferred_callback(FuriEventLoopObject* object, void* context) {
+    FuriPubSubSubscription* item = context;
+    furi_assert(object == item->queue);
+
+    while(furi_message_queue_get(item->queue, item->message, 0) == FuriStatusOk) {
+        item->callback(item->message, item->callback_context);
+    }
+
+    return true;
+}
+
+FuriPubSubSubscription* furi_pubsub_subscribe_deferred(
+    FuriPubSub* pubsub,
+    FuriEventLoop* event_loop,
+    size_t message_size,
+    size_t queue_size,
+    FuriPubSubCallback callback,
+    void* callback_context) {
+    furi_check(pubsub);
+    furi_check(event_loop);
+    furi_check(message_size);
+    furi_check(queue_size);
+    furi_check(callback);
+
+    FuriPubSubSubscription* item = malloc(sizeof(FuriPubSubSubscription));
     item->callback = callback;
     item->callback_context = callback_context;
+    item->event_loop = event_loop;
+    item->queue = furi_message_queue_alloc(queue_size, message_size);
+    item->message = malloc(message_size);
 
-    furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
+    furi_event_loop_subscribe_message_queue(
+        event_loop, item->queue, FuriEventLoopEventIn, furi_pubsub_deferred_callback, item);
+
+    furi_pubsub_add(pubsub, item);
 
     return item;
 }
@@ -61,38 +187,110 @@ void furi_pubsub_unsubscribe(FuriPubSub* pubsub, FuriPubSubSubscription* pubsub_
     furi_assert(pubsub_subscription);
 
     furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
-    bool result = false;
 
-    // iterate over items
-    FuriPubSubSubscriptionList_it_t it;
-    for(FuriPubSubSubscriptionList_it(it, pubsub->items); !FuriPubSubSubscriptionList_end_p(it);
-        FuriPubSubSubscriptionList_next(it)) {
-        const FuriPubSubSubscription* item = FuriPubSubSubscriptionList_cref(it);
+    FuriPubSubList* old_list = pubsub->list;
+    FuriPubSubList* list = furi_pubsub_list_alloc(old_list->count ? old_list->count - 1 : 0);
 
-        // if the iterator is equal to our element
-        if(item == pubsub_subscription) {
-            FuriPubSubSubscriptionList_remove(pubsub->items, it);
+    bool result = false;
+    size_t count = 0;
+    for(size_t i = 0; i < old_list->count; i++) {
+        if(old_list->items[i] == pubsub_subscription) {
             result = true;
-            break;
+        } else if(count < list->count) {
+            list->items[count++] = old_list->items[i];
         }
     }
 
+    if(result) {
+        old_list = furi_pubsub_list_swap(pubsub, list);
+    } else {
+        free(list);
+    }
+
     furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
     furi_check(result);
+
+    // Callback may be running in publishers that pinned old list or any list before it:
+    // wait for them, so subscription context can be freed right after return. Mutex is
+    // released by now, these callbacks may subscribe or unsubscribe others.
+    while(true) {
+        FURI_CRITICAL_ENTER();
+        bool in_use = old_list->refs > 1;
+        FURI_CRITICAL_EXIT();
+        if(!in_use) break;
+        furi_delay_tick(1);
+    }
+    furi_pubsub_list_unpin(old_list);
+
+    if(pubsub_subscription->queue) {
+        furi_event_loop_unsubscribe(pubsub_subscription->event_loop, pubsub_subscription->queue);
+        furi_message_queue_free(pubsub_subscription->queue);
+        free(pubsub_subscription->message);
+    }
+    free(pubsub_subscription);
 }
 
 void furi_pubsub_publish(FuriPubSub* pubsub, void* message) {
     furi_check(pubsub);
 
-    furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
+    const uint32_t start = DWT->CYCCNT;
+    uint32_t dropped = 0;
+    uint32_t queue_depth_max = 0;
+
+    FuriPubSubList* list = furi_pubsub_list_pin(pubsub);
 
     // iterate over subscribers
-    FuriPubSubSubscriptionList_it_t it;
-    for(FuriPubSubSubscriptionList_it(it, pubsub->items); !FuriPubSubSubscriptionList_end_p(it);
-        FuriPubSubSubscriptionList_next(it)) {
-        const FuriPubSubSubscription* item = FuriPubSubSubscriptionList_cref(it);
-        item->callback(message, item->callback_context);
+    for(size_t i = 0; i < list->count; i++) {
+        const FuriPubSubSubscription* item = list->items[i];
+        if(item->queue) {
+            if(furi_message_queue_put(item->queue, message, 0) != FuriStatusOk) {
+                dropped++;
+            }
+            queue_depth_max = MAX(queue_depth_max, furi_message_queue_get_count(item->queue));
+        } else {
+            item->callback(message, item->callback_context);
+        }
     }
 
-    furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
+    furi_pubsub_list_unpin(list);
+
+    const uint32_t latency = DWT->CYCCNT - start;
+
+    FURI_CRITICAL_ENTER();
+    pubsub->published++;
+    pubsub->dropped += dropped;
+    pubsub->queue_depth_max = MAX(pubsub->queue_depth_max, queue_depth_max);
+    pubsub->latency_max = MAX(pubsub->latency_max, latency);
+    pubsub->latency_total += latency;
+    FURI_CRITICAL_EXIT();
+}
+
+void furi_pubsub_get_stats(FuriPubSub* pubsub, FuriPubSubStats* stats) {
+    furi_check(pubsub);
+    furi_check(stats);
+
+    FURI_CRITICAL_ENTER();
+    stats->published = pubsub->published;
+    stats->dropped = pubsub->dropped;
+    stats->queue_depth_max = pubsub->queue_depth_max;
+    uint32_t latency_max = pubsub->latency_max;
+    uint64_t latency_total = pubsub->latency_total;
+    FURI_CRITICAL_EXIT();
+
+    const uint32_t cycles_per_us = furi_hal_cortex_instructions_per_microsecond();
+    stats->latency_max_us = latency_max / cycles_per_us;
+    stats->latency_avg_us =
+        stats->published ? (uint32_t)(latency_total / stats->published / cycles_per_us) : 0;
+}
+
+void furi_pubsub_reset_stats(FuriPubSub* pubsub) {
+    furi_check(pubsub);
+
+    FURI_CRITICAL_ENTER();
+    pubsub->published = 0;
+    pubsub->dropped = 0;
+    pubsub->queue_depth_max = 0;
+    pubsub->latency_max = 0;
+    pubsub->latency_total = 0;
+    FURI_CRITICAL_EXIT();
 }
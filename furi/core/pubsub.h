@@ -4,6 +4,8 @@
  */
 #pragma once
 
+#include "event_loop.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -17,6 +19,15 @@ typedef struct FuriPubSub FuriPubSub;
 /** FuriPubSubSubscription type */
 typedef struct FuriPubSubSubscription FuriPubSubSubscription;
 
+/** FuriPubSub statistics */
+typedef struct {
+    uint32_t published; /**< Number of publish calls */
+    uint32_t dropped; /**< Messages dropped because deferred queue was full */
+    uint32_t queue_depth_max; /**< Maximum number of pending messages in deferred queue */
+    uint32_t latency_avg_us; /**< Average publish call duration */
+    uint32_t latency_max_us; /**< Maximum publish call duration */
+} FuriPubSubStats;
+
 /** Allocate FuriPubSub
  *
  * Reentrable, Not threadsafe, one owner
@@ -33,7 +44,8 @@ void furi_pubsub_free(FuriPubSub* pubsub);
 
 /** Subscribe to FuriPubSub
  * 
- * Threadsafe, Reentrable
+ * Threadsafe, Reentrable, can be called from subscription callback.
+ * Callback is called in publisher context.
  * 
  * @param      pubsub            pointer to FuriPubSub instance
  * @param[in]  callback          The callback
@@ -44,10 +56,38 @@ void furi_pubsub_free(FuriPubSub* pubsub);
 FuriPubSubSubscription*
     furi_pubsub_subscribe(FuriPubSub* pubsub, FuriPubSubCallback callback, void* callback_context);
 
+/** Subscribe to FuriPubSub with deferred delivery
+ *
+ * Published messages are copied to subscription queue and callback is called
+ * from event loop, so slow subscriber does not stall publishers. Messages
+ * published while queue is full are dropped and counted in statistics.
+ *
+ * Must be called from event loop thread. Message pointer passed to
+ * furi_pubsub_publish must point to at least `message_size` bytes.
+ *
+ * @param      pubsub            pointer to FuriPubSub instance
+ * @param      event_loop        event loop to deliver messages in
+ * @param[in]  message_size      size of message to copy
+ * @param[in]  queue_size        maximum number of pending messages
+ * @param[in]  callback          The callback, gets pointer to message copy
+ * @param      callback_context  The callback context
+ *
+ * @return     pointer to FuriPubSubSubscription instance
+ */
+FuriPubSubSubscription* furi_pubsub_subscribe_deferred(
+    FuriPubSub* pubsub,
+    FuriEventLoop* event_loop,
+    size_t message_size,
+    size_t queue_size,
+    FuriPubSubCallback callback,
+    void* callback_context);
+
 /** Unsubscribe from FuriPubSub
  * 
  * No use of `pubsub_subscription` allowed after call of this method
- * Threadsafe, Reentrable.
+ * Threadsafe, Reentrable. Waits for publishers still calling the callback, so
+ * must not be called from callback of the same FuriPubSub. Deferred
+ * subscription must be unsubscribed from its event loop thread.
  *
  * @param      pubsub               pointer to FuriPubSub instance
  * @param      pubsub_subscription  pointer to FuriPubSubSubscription instance
@@ -56,13 +96,27 @@ void furi_pubsub_unsubscribe(FuriPubSub* pubsub, FuriPubSubSubscription* pubsub_
 
 /** Publish message to FuriPubSub
  *
- * Threadsafe, Reentrable.
+ * Threadsafe, Reentrable, takes no locks and can be called from subscription
+ * callback.
  * 
  * @param      pubsub   pointer to FuriPubSub instance
  * @param      message  message pointer to publish
  */
 void furi_pubsub_publish(FuriPubSub* pubsub, void* message);
 
+/** Get FuriPubSub statistics
+ *
+ * @param      pubsub  pointer to FuriPubSub instance
+ * @param[out] stats   statistics
+ */
+void furi_pubsub_get_stats(FuriPubSub* pubsub, FuriPubSubStats* stats);
+
+/** Reset FuriPubSub statistics
+ *
+ * @param      pubsub  pointer to FuriPubSub instance
+ */
+void furi_pubsub_reset_stats(FuriPubSub* pubsub);
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,7 +14,6 @@
 
 struct FuriSemaphore {
     StaticSemaphore_t container;
-    FuriEventLoopLink event_loop_link;
 };
 
 // IMPORTANT: container MUST be the FIRST struct member
@@ -24,7 +23,7 @@ FuriSemaphore* furi_semaphore_alloc(uint32_t max_count, uint32_t initial_count)
     furi_check(!FURI_IS_IRQ_MODE());
     furi_check((max_count > 0U) && (initial_count <= max_count));
 
-    FuriSemaphore* instance = malloc(sizeof(FuriSemaphore));
+    FuriSemaphore* instance = furi_event_loop_object_alloc(sizeof(FuriSemaphore));
 
     SemaphoreHandle_t hSemaphore;
 
@@ -49,11 +48,12 @@ void furi_semaphore_free(FuriSemaphore* instance) {
     furi_check(!FURI_IS_IRQ_MODE());
 
     // Event Loop must be disconnected
-    furi_check(!instance->event_loop_link.item_in);
-    furi_check(!instance->event_loop_link.item_out);
+    FuriEventLoopLink* link = furi_event_loop_object_get_link(instance);
+    furi_check(!link->item_in);
+    furi_check(!link->item_out);
 
     vSemaphoreDelete((SemaphoreHandle_t)instance);
-    free(instance);
+    furi_event_loop_object_free(instance);
 }
 
 FuriStatus furi_semaphore_acquire(FuriSemaphore* instance, uint32_t timeout) {
@@ -89,7 +89,8 @@ FuriStatus furi_semaphore_acquire(FuriSemaphore* instance, uint32_t timeout) {
     }
 
     if(stat == FuriStatusOk) {
-        furi_event_loop_link_notify(&instance->event_loop_link, FuriEventLoopEventOut);
+        furi_event_loop_link_notify(
+            furi_event_loop_object_get_link(instance), FuriEventLoopEventOut);
     }
 
     return stat;
@@ -120,7 +121,8 @@ FuriStatus furi_semaphore_release(FuriSemaphore* instance) {
     }
 
     if(stat == FuriStatusOk) {
-        furi_event_loop_link_notify(&instance->event_loop_link, FuriEventLoopEventIn);
+        furi_event_loop_link_notify(
+            furi_event_loop_object_get_link(instance), FuriEventLoopEventIn);
     }
 
     return stat;
@@ -159,12 +161,6 @@ uint32_t furi_semaphore_get_space(FuriSemaphore* instance) {
     return space;
 }
 
-static FuriEventLoopLink* furi_semaphore_event_loop_get_link(FuriEventLoopObject* object) {
-    FuriSemaphore* instance = object;
-    furi_assert(instance);
-    return &instance->event_loop_link;
-}
-
 static uint32_t
     furi_semaphore_event_loop_get_level(FuriEventLoopObject* object, FuriEventLoopEvent event) {
     FuriSemaphore* instance = object;
@@ -180,6 +176,5 @@ static uint32_t
 }
 
 const FuriEventLoopContract furi_semaphore_event_loop_contract = {
-    .get_link = furi_semaphore_event_loop_get_link,
     .get_level = furi_semaphore_event_loop_get_level,
 };
@@ -13,7 +13,6 @@
 
 struct FuriStreamBuffer {
     StaticStreamBuffer_t container;
-    FuriEventLoopLink event_loop_link;
     uint8_t buffer[];
 };
 
@@ -28,7 +27,8 @@ FuriStreamBuffer* furi_stream_buffer_alloc(size_t size, size_t trigger_level) {
     // Actual FreeRTOS usable buffer size seems to be one less
     const size_t buffer_size = size + 1;
 
-    FuriStreamBuffer* stream_buffer = malloc(sizeof(FuriStreamBuffer) + buffer_size);
+    FuriStreamBuffer* stream_buffer =
+        furi_event_loop_object_alloc(sizeof(FuriStreamBuffer) + buffer_size);
     StreamBufferHandle_t hStreamBuffer = xStreamBufferCreateStatic(
         buffer_size, trigger_level, stream_buffer->buffer, &stream_buffer->container);
 
@@ -41,11 +41,12 @@ void furi_stream_buffer_free(FuriStreamBuffer* stream_buffer) {
     furi_check(stream_buffer);
 
     // Event Loop must be disconnected
-    furi_check(!stream_buffer->event_loop_link.item_in);
-    furi_check(!stream_buffer->event_loop_link.item_out);
+    FuriEventLoopLink* link = furi_event_loop_object_get_link(stream_buffer);
+    furi_check(!link->item_in);
+    furi_check(!link->item_out);
 
     vStreamBufferDelete((StreamBufferHandle_t)stream_buffer);
-    free(stream_buffer);
+    furi_event_loop_object_free(stream_buffer);
 }
 
 bool furi_stream_set_trigger_level(FuriStreamBuffer* stream_buffer, size_t trigger_level) {
@@ -77,7 +78,8 @@ size_t furi_stream_buffer_send(
         const size_t trigger_level = ((StaticStreamBuffer_t*)stream_buffer)->xTriggerLevelBytes;
 
         if(bytes_available >= trigger_level) {
-            furi_event_loop_link_notify(&stream_buffer->event_loop_link, FuriEventLoopEventIn);
+            furi_event_loop_link_notify(
+                furi_event_loop_object_get_link(stream_buffer), FuriEventLoopEventIn);
         }
     }
 
@@ -103,7 +105,8 @@ size_t furi_stream_buffer_receive(
     }
 
     if(ret > 0) {
-        furi_event_loop_link_notify(&stream_buffer->event_loop_link, FuriEventLoopEventOut);
+        furi_event_loop_link_notify(
+            furi_event_loop_object_get_link(stream_buffer), FuriEventLoopEventOut);
     }
 
     return ret;
@@ -145,18 +148,13 @@ FuriStatus furi_stream_buffer_reset(FuriStreamBuffer* stream_buffer) {
     }
 
     if(status == FuriStatusOk) {
-        furi_event_loop_link_notify(&stream_buffer->event_loop_link, FuriEventLoopEventOut);
+        furi_event_loop_link_notify(
+            furi_event_loop_object_get_link(stream_buffer), FuriEventLoopEventOut);
     }
 
     return status;
 }
 
-static FuriEventLoopLink* furi_stream_buffer_event_loop_get_link(FuriEventLoopObject* object) {
-    FuriStreamBuffer* stream_buffer = object;
-    furi_assert(stream_buffer);
-    return &stream_buffer->event_loop_link;
-}
-
 static uint32_t
     furi_stream_buffer_event_loop_get_level(FuriEventLoopObject* object, FuriEventLoopEvent event) {
     FuriStreamBuffer* stream_buffer = object;
@@ -172,6 +170,5 @@ static uint32_t
 }
 
 const FuriEventLoopContract furi_stream_buffer_event_loop_contract = {
-    .get_link = furi_stream_buffer_event_loop_get_link,
     .get_level = furi_stream_buffer_event_loop_get_level,
 };
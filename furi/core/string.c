@@ -1,8 +1,45 @@
 #include "string.h"
+#include "check.h"
+#include "common_defines.h"
 #include <m-string.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+/* Storage
+ *
+ * Strings shorter than FURI_STRING_INLINE_SIZE live right in FuriString, so
+ * most keys, protocol names and short values take a single allocation. Longer
+ * ones move to the heap or, for arena strings, to the arena block. */
+#define FURI_STRING_INLINE_SIZE 24U
+
+// Keep FuriString headers in arena word aligned
+#define FURI_STRING_ARENA_ALIGN(x) (((x) + sizeof(void*) - 1) & ~(sizeof(void*) - 1))
+
+typedef struct FuriStringArenaBlock FuriStringArenaBlock;
+
+struct FuriStringArenaBlock {
+    FuriStringArenaBlock* next;
+    size_t size;
+    size_t used;
+    uint8_t data[];
+};
+
+struct FuriStringArena {
+    FuriStringArenaBlock* blocks;
+    size_t block_size;
+};
 
 struct FuriString {
-    string_t string;
+    size_t size;
+    size_t alloc; /**< External buffer capacity, 0 when data is inline */
+    FuriStringArena* arena; /**< Owner of string and its buffer, NULL for heap */
+    union {
+        char* ptr;
+        char buffer[FURI_STRING_INLINE_SIZE];
+    };
 };
 
 #undef furi_string_alloc_set
@@ -23,23 +60,133 @@ struct FuriString {
 #undef furi_string_trim
 #undef furi_string_cat
 
+static inline char* furi_string_data(const FuriString* s) {
+    return s->alloc ? s->ptr : (char*)s->buffer;
+}
+
+static inline size_t furi_string_capacity(const FuriString* s) {
+    return s->alloc ? s->alloc : FURI_STRING_INLINE_SIZE;
+}
+
+static void* furi_string_arena_get(FuriStringArena* arena, size_t size) {
+    size = FURI_STRING_ARENA_ALIGN(size);
+
+    FuriStringArenaBlock* block = arena->blocks;
+    if(!block || block->size - block->used < size) {
+        const size_t block_size = MAX(arena->block_size, size);
+        block = malloc(sizeof(FuriStringArenaBlock) + block_size);
+        block->size = block_size;
+        block->used = 0;
+        block->next = arena->blocks;
+        arena->blocks = block;
+    }
+
+    void* ptr = &block->data[block->used];
+    block->used += size;
+    return ptr;
+}
+
+/** Try to grow the last arena allocation in place */
+static bool
+    furi_string_arena_extend(FuriStringArena* arena, char* ptr, size_t alloc, size_t size) {
+    FuriStringArenaBlock* block = arena->blocks;
+    if(!block || (uint8_t*)ptr + alloc != &block->data[block->used]) return false;
+    if(block->size - (block->used - alloc) < size) return false;
+    block->used = block->used - alloc + size;
+    return true;
+}
+
+static void furi_string_release(FuriString* s) {
+    if(s->alloc && !s->arena) {
+        free(s->ptr);
+    }
+    s->alloc = 0;
+}
+
+/** Make room for size characters plus terminator, keeping content */
+static char* furi_string_fit(FuriString* s, size_t size) {
+    const size_t capacity = furi_string_capacity(s);
+    if(size < capacity) return furi_string_data(s);
+
+    size_t alloc = MAX(size + 1, capacity + capacity / 2);
+
+    if(s->arena) {
+        alloc = FURI_STRING_ARENA_ALIGN(alloc);
+        if(s->alloc && furi_string_arena_extend(s->arena, s->ptr, s->alloc, alloc)) {
+            s->alloc = alloc;
+        } else {
+            char* ptr = furi_string_arena_get(s->arena, alloc);
+            memcpy(ptr, furi_string_data(s), s->size + 1);
+            s->ptr = ptr;
+            s->alloc = alloc;
+        }
+    } else if(s->alloc) {
+        s->ptr = realloc(s->ptr, alloc); //-V701
+        s->alloc = alloc;
+    } else {
+        char* ptr = malloc(alloc);
+        memcpy(ptr, s->buffer, s->size + 1);
+        s->ptr = ptr;
+        s->alloc = alloc;
+    }
+
+    return s->ptr;
+}
+
+static inline void furi_string_set_size(FuriString* s, size_t size) {
+    s->size = size;
+    furi_string_data(s)[size] = '\0';
+}
+
+static void furi_string_init(FuriString* s, FuriStringArena* arena) {
+    s->size = 0;
+    s->alloc = 0;
+    s->arena = arena;
+    s->buffer[0] = '\0';
+}
+
+/** Set content, source may point into the string itself */
+static void furi_string_set_buffer(FuriString* s, const char* str, size_t length) {
+    const char* data = furi_string_data(s);
+    if(str >= data && str <= data + s->size) {
+        // Substring of itself: never grows
+        memmove((char*)data, str, length);
+    } else {
+        memcpy(furi_string_fit(s, length), str, length);
+    }
+    furi_string_set_size(s, length);
+}
+
+/** Append content, source may point into the string itself */
+static void furi_string_cat_buffer(FuriString* s, const char* str, size_t length) {
+    const char* data = furi_string_data(s);
+    if(str >= data && str <= data + s->size) {
+        const size_t offset = str - data;
+        char* ptr = furi_string_fit(s, s->size + length);
+        memmove(ptr + s->size, ptr + offset, length);
+    } else {
+        memcpy(furi_string_fit(s, s->size + length) + s->size, str, length);
+    }
+    furi_string_set_size(s, s->size + length);
+}
+
 FuriString* furi_string_alloc(void) {
     FuriString* string = malloc(sizeof(FuriString));
-    string_init(string->string);
+    furi_string_init(string, NULL);
     return string;
 }
 
 FuriString* furi_string_alloc_set(const FuriString* s) {
-    FuriString* string = malloc(sizeof(FuriString)); //-V799
-    string_init_set(string->string, s->string);
+    FuriString* string = furi_string_alloc();
+    furi_string_set_buffer(string, furi_string_data(s), s->size);
     return string;
-} //-V773
+}
 
 FuriString* furi_string_alloc_set_str(const char cstr[]) {
-    FuriString* string = malloc(sizeof(FuriString)); //-V799
-    string_init_set(string->string, cstr);
+    FuriString* string = furi_string_alloc();
+    furi_string_set_buffer(string, cstr, strlen(cstr));
     return string;
-} //-V773
+}
 
 FuriString* furi_string_alloc_printf(const char format[], ...) {
     va_list args;
@@ -50,108 +197,215 @@ FuriString* furi_string_alloc_printf(const char format[], ...) {
 }
 
 FuriString* furi_string_alloc_vprintf(const char format[], va_list args) {
-    FuriString* string = malloc(sizeof(FuriString));
-    string_init_vprintf(string->string, format, args);
+    FuriString* string = furi_string_alloc();
+    furi_string_vprintf(string, format, args);
     return string;
 }
 
 FuriString* furi_string_alloc_move(FuriString* s) {
-    FuriString* string = malloc(sizeof(FuriString));
-    string_init_move(string->string, s->string);
-    free(s);
+    if(!s->arena) return s;
+
+    // Arena memory can not outlive the arena, copy content to the heap
+    FuriString* string = furi_string_alloc_set(s);
+    furi_string_free(s);
+    return string;
+}
+
+FuriString* furi_string_alloc_arena(FuriStringArena* arena) {
+    furi_check(arena);
+    FuriString* string = furi_string_arena_get(arena, sizeof(FuriString));
+    furi_string_init(string, arena);
     return string;
 }
 
 void furi_string_free(FuriString* s) {
-    string_clear(s->string);
+    // Arena strings are released all at once with the arena
+    if(s->arena) return;
+    furi_string_release(s);
     free(s);
 }
 
+FuriStringArena* furi_string_arena_alloc(size_t block_size) {
+    FuriStringArena* arena = malloc(sizeof(FuriStringArena));
+    arena->blocks = NULL;
+    arena->block_size = FURI_STRING_ARENA_ALIGN(MAX(block_size, sizeof(FuriString)));
+    return arena;
+}
+
+void furi_string_arena_reset(FuriStringArena* arena) {
+    furi_check(arena);
+
+    // Keep the first block for the next round, it is the last one in list
+    FuriStringArenaBlock* block = arena->blocks;
+    while(block && block->next) {
+        FuriStringArenaBlock* next = block->next;
+        free(block);
+        block = next;
+    }
+
+    if(block) {
+        if(block->size == arena->block_size) {
+            block->used = 0;
+        } else {
+            free(block);
+            block = NULL;
+        }
+    }
+
+    arena->blocks = block;
+}
+
+void furi_string_arena_free(FuriStringArena* arena) {
+    furi_check(arena);
+
+    while(arena->blocks) {
+        FuriStringArenaBlock* next = arena->blocks->next;
+        free(arena->blocks);
+        arena->blocks = next;
+    }
+
+    free(arena);
+}
+
 void furi_string_reserve(FuriString* s, size_t alloc) {
-    string_reserve(s->string, alloc);
+    alloc = MAX(alloc, s->size + 1);
+
+    if(s->arena) {
+        // Arena memory is not reclaimed anyway, only grow
+        furi_string_fit(s, alloc - 1);
+    } else if(alloc <= FURI_STRING_INLINE_SIZE) {
+        if(s->alloc) {
+            char* ptr = s->ptr;
+            memcpy(s->buffer, ptr, s->size + 1);
+            free(ptr);
+            s->alloc = 0;
+        }
+    } else if(alloc != s->alloc) {
+        if(s->alloc) {
+            s->ptr = realloc(s->ptr, alloc); //-V701
+        } else {
+            char* ptr = malloc(alloc);
+            memcpy(ptr, s->buffer, s->size + 1);
+            s->ptr = ptr;
+        }
+        s->alloc = alloc;
+    }
 }
 
 void furi_string_reset(FuriString* s) {
-    string_clear(s->string);
-    string_init(s->string);
+    if(s->arena) {
+        furi_string_set_size(s, 0);
+    } else {
+        furi_string_release(s);
+        furi_string_init(s, NULL);
+    }
 }
 
 void furi_string_swap(FuriString* v1, FuriString* v2) {
-    string_swap(v1->string, v2->string);
+    if(v1->arena == v2->arena) {
+        FuriString tmp = *v1;
+        *v1 = *v2;
+        *v2 = tmp;
+    } else {
+        // Buffers can not change owner
+        FuriString* tmp = furi_string_alloc_set(v1);
+        furi_string_set_buffer(v1, furi_string_data(v2), v2->size);
+        furi_string_set_buffer(v2, furi_string_data(tmp), tmp->size);
+        furi_string_free(tmp);
+    }
 }
 
 void furi_string_move(FuriString* v1, FuriString* v2) {
-    string_clear(v1->string);
-    string_init_move(v1->string, v2->string);
-    free(v2);
+    if(v1->arena == v2->arena) {
+        furi_string_release(v1);
+        *v1 = *v2;
+        if(!v2->arena) free(v2);
+    } else {
+        furi_string_set_buffer(v1, furi_string_data(v2), v2->size);
+        furi_string_free(v2);
+    }
 }
 
 size_t furi_string_hash(const FuriString* v) {
-    return string_hash(v->string);
+    return m_core_hash(furi_string_data(v), v->size);
 }
 
 char furi_string_get_char(const FuriString* v, size_t index) {
-    return string_get_char(v->string, index);
+    furi_check(index < v->size);
+    return furi_string_data(v)[index];
 }
 
 const char* furi_string_get_cstr(const FuriString* s) {
-    return string_get_cstr(s->string);
+    return furi_string_data(s);
 }
 
 void furi_string_set(FuriString* s, FuriString* source) {
-    string_set(s->string, source->string);
+    furi_string_set_buffer(s, furi_string_data(source), source->size);
 }
 
 void furi_string_set_str(FuriString* s, const char cstr[]) {
-    string_set(s->string, cstr);
+    furi_string_set_buffer(s, cstr, strlen(cstr));
 }
 
 void furi_string_set_strn(FuriString* s, const char str[], size_t n) {
-    string_set_strn(s->string, str, n);
+    furi_string_set_buffer(s, str, strnlen(str, n));
 }
 
 void furi_string_set_char(FuriString* s, size_t index, const char c) {
-    string_set_char(s->string, index, c);
+    furi_check(index < s->size);
+    furi_string_data(s)[index] = c;
 }
 
 int furi_string_cmp(const FuriString* s1, const FuriString* s2) {
-    return string_cmp(s1->string, s2->string);
+    return strcmp(furi_string_data(s1), furi_string_data(s2));
 }
 
 int furi_string_cmp_str(const FuriString* s1, const char str[]) {
-    return string_cmp(s1->string, str);
+    return strcmp(furi_string_data(s1), str);
 }
 
 int furi_string_cmpi(const FuriString* v1, const FuriString* v2) {
-    return string_cmpi(v1->string, v2->string);
+    return furi_string_cmpi_str(v1, furi_string_data(v2));
 }
 
 int furi_string_cmpi_str(const FuriString* v1, const char p2[]) {
-    return string_cmpi_str(v1->string, p2);
+    const char* p1 = furi_string_data(v1);
+    int c1, c2;
+    do {
+        c1 = tolower((unsigned char)*p1++);
+        c2 = tolower((unsigned char)*p2++);
+    } while(c1 == c2 && c1 != 0);
+    return c1 - c2;
 }
 
 size_t furi_string_search(const FuriString* v, const FuriString* needle, size_t start) {
-    return string_search(v->string, needle->string, start);
+    return furi_string_search_str(v, furi_string_data(needle), start);
 }
 
 size_t furi_string_search_str(const FuriString* v, const char needle[], size_t start) {
-    return string_search(v->string, needle, start);
+    if(start > v->size) return FURI_STRING_FAILURE;
+    const char* data = furi_string_data(v);
+    const char* found = strstr(data + start, needle);
+    return found ? (size_t)(found - data) : FURI_STRING_FAILURE;
 }
 
 bool furi_string_equal(const FuriString* v1, const FuriString* v2) {
-    return string_equal_p(v1->string, v2->string);
+    return v1->size == v2->size &&
+           memcmp(furi_string_data(v1), furi_string_data(v2), v1->size) == 0;
 }
 
 bool furi_string_equal_str(const FuriString* v1, const char v2[]) {
-    return string_equal_p(v1->string, v2);
+    return strcmp(furi_string_data(v1), v2) == 0;
 }
 
 void furi_string_push_back(FuriString* v, char c) {
-    string_push_back(v->string, c);
+    char* data = furi_string_fit(v, v->size + 1);
+    data[v->size] = c;
+    furi_string_set_size(v, v->size + 1);
 }
 
 size_t furi_string_size(const FuriString* s) {
-    return string_size(s->string);
+    return s->size;
 }
 
 int furi_string_printf(FuriString* v, const char format[], ...) {
@@ -162,8 +416,26 @@ int furi_string_printf(FuriString* v, const char format[], ...) {
     return result;
 }
 
+/** Format at offset, in place and with second pass only if it did not fit */
+static int furi_string_format_at(FuriString* v, size_t offset, const char format[], va_list args) {
+    va_list args_copy;
+    va_copy(args_copy, args);
+    const size_t space = furi_string_capacity(v) - offset;
+    int ret = vsnprintf(furi_string_data(v) + offset, space, format, args_copy);
+    va_end(args_copy);
+
+    if(ret > 0 && (size_t)ret >= space) {
+        v->size = MIN(v->size, offset);
+        char* data = furi_string_fit(v, offset + ret);
+        ret = vsnprintf(data + offset, ret + 1, format, args);
+    }
+
+    furi_string_set_size(v, offset + MAX(ret, 0));
+    return ret;
+}
+
 int furi_string_vprintf(FuriString* v, const char format[], va_list args) {
-    return string_vprintf(v->string, format, args);
+    return furi_string_format_at(v, 0, format, args);
 }
 
 int furi_string_cat_printf(FuriString* v, const char format[], ...) {
@@ -175,114 +447,187 @@ int furi_string_cat_printf(FuriString* v, const char format[], ...) {
 }
 
 int furi_string_cat_vprintf(FuriString* v, const char format[], va_list args) {
-    FuriString* string = furi_string_alloc();
-    int ret = furi_string_vprintf(string, format, args);
-    furi_string_cat(v, string);
-    furi_string_free(string);
-    return ret;
+    return furi_string_format_at(v, v->size, format, args);
 }
 
 bool furi_string_empty(const FuriString* v) {
-    return string_empty_p(v->string);
+    return v->size == 0;
 }
 
 void furi_string_replace_at(FuriString* v, size_t pos, size_t len, const char str2[]) {
-    string_replace_at(v->string, pos, len, str2);
+    furi_check(pos + len <= v->size);
+
+    const size_t str2_len = strlen(str2);
+    const size_t size = v->size - len + str2_len;
+    char* data = furi_string_fit(v, size);
+    memmove(&data[pos + str2_len], &data[pos + len], v->size - pos - len);
+    memcpy(&data[pos], str2, str2_len);
+    furi_string_set_size(v, size);
 }
 
 size_t
     furi_string_replace(FuriString* string, FuriString* needle, FuriString* replace, size_t start) {
-    return string_replace(string->string, needle->string, replace->string, start);
+    return furi_string_replace_str(
+        string, furi_string_data(needle), furi_string_data(replace), start);
 }
 
 size_t furi_string_replace_str(FuriString* v, const char str1[], const char str2[], size_t start) {
-    return string_replace_str(v->string, str1, str2, start);
+    size_t pos = furi_string_search_str(v, str1, start);
+    if(pos != FURI_STRING_FAILURE) {
+        furi_string_replace_at(v, pos, strlen(str1), str2);
+    }
+    return pos;
 }
 
 void furi_string_replace_all_str(FuriString* v, const char str1[], const char str2[]) {
-    string_replace_all_str(v->string, str1, str2);
+    const size_t str1_len = strlen(str1);
+    const size_t str2_len = strlen(str2);
+    size_t pos = 0;
+    while((pos = furi_string_search_str(v, str1, pos)) != FURI_STRING_FAILURE) {
+        furi_string_replace_at(v, pos, str1_len, str2);
+        pos += str2_len;
+    }
 }
 
 void furi_string_replace_all(FuriString* v, const FuriString* str1, const FuriString* str2) {
-    string_replace_all(v->string, str1->string, str2->string);
+    furi_string_replace_all_str(v, furi_string_data(str1), furi_string_data(str2));
 }
 
 bool furi_string_start_with(const FuriString* v, const FuriString* v2) {
-    return string_start_with_string_p(v->string, v2->string);
+    return v->size >= v2->size &&
+           memcmp(furi_string_data(v), furi_string_data(v2), v2->size) == 0;
 }
 
 bool furi_string_start_with_str(const FuriString* v, const char str[]) {
-    return string_start_with_str_p(v->string, str);
+    return strncmp(furi_string_data(v), str, strlen(str)) == 0;
 }
 
 bool furi_string_end_with(const FuriString* v, const FuriString* v2) {
-    return string_end_with_string_p(v->string, v2->string);
+    return furi_string_end_with_str(v, furi_string_data(v2));
 }
 
 bool furi_string_end_withi(const FuriString* v, const FuriString* v2) {
-    return furi_string_end_withi_str(v, string_get_cstr(v2->string));
+    return furi_string_end_withi_str(v, furi_string_data(v2));
 }
 
 bool furi_string_end_with_str(const FuriString* v, const char str[]) {
-    return string_end_with_str_p(v->string, str);
+    const size_t str_len = strlen(str);
+    if(v->size < str_len) {
+        return false;
+    }
+
+    return memcmp(&furi_string_data(v)[v->size - str_len], str, str_len) == 0;
 }
 
 bool furi_string_end_withi_str(const FuriString* v, const char str[]) {
-    M_STR1NG_CONTRACT(v);
-    M_ASSERT(str != NULL);
+    furi_check(str);
 
     const size_t str_len = strlen(str);
-    const size_t v_len = string_size(v->string);
-
-    if(v_len < str_len) {
+    if(v->size < str_len) {
         return false;
     }
 
-    return strcasecmp(&string_get_cstr(v->string)[v_len - str_len], str) == 0;
+    return strcasecmp(&furi_string_data(v)[v->size - str_len], str) == 0;
 }
 
 size_t furi_string_search_char(const FuriString* v, char c, size_t start) {
-    return string_search_char(v->string, c, start);
+    if(start > v->size) return FURI_STRING_FAILURE;
+    const char* data = furi_string_data(v);
+    const char* found = memchr(data + start, c, v->size - start);
+    return found ? (size_t)(found - data) : FURI_STRING_FAILURE;
 }
 
 size_t furi_string_search_rchar(const FuriString* v, char c, size_t start) {
-    return string_search_rchar(v->string, c, start);
+    const char* data = furi_string_data(v);
+    for(size_t i = v->size; i > start; i--) {
+        if(data[i - 1] == c) return i - 1;
+    }
+    return FURI_STRING_FAILURE;
 }
 
 void furi_string_left(FuriString* v, size_t index) {
-    string_left(v->string, index);
+    if(index < v->size) {
+        furi_string_set_size(v, index);
+    }
 }
 
 void furi_string_right(FuriString* v, size_t index) {
-    string_right(v->string, index);
+    if(index >= v->size) {
+        furi_string_set_size(v, 0);
+    } else {
+        char* data = furi_string_data(v);
+        memmove(data, data + index, v->size - index);
+        furi_string_set_size(v, v->size - index);
+    }
 }
 
 void furi_string_mid(FuriString* v, size_t index, size_t size) {
-    string_mid(v->string, index, size);
+    furi_string_right(v, index);
+    furi_string_left(v, size);
 }
 
 void furi_string_trim(FuriString* v, const char charac[]) {
-    string_strim(v->string, charac);
+    char* data = furi_string_data(v);
+    size_t end = v->size;
+    while(end > 0 && strchr(charac, data[end - 1])) end--;
+    size_t begin = 0;
+    while(begin < end && strchr(charac, data[begin])) begin++;
+    memmove(data, data + begin, end - begin);
+    furi_string_set_size(v, end - begin);
 }
 
 void furi_string_cat(FuriString* v, const FuriString* v2) {
-    string_cat(v->string, v2->string);
+    furi_string_cat_buffer(v, furi_string_data(v2), v2->size);
 }
 
 void furi_string_cat_str(FuriString* v, const char str[]) {
-    string_cat(v->string, str);
+    furi_string_cat_buffer(v, str, strlen(str));
 }
 
 void furi_string_set_n(FuriString* v, const FuriString* ref, size_t offset, size_t length) {
-    string_set_n(v->string, ref->string, offset, length);
+    furi_check(offset <= ref->size);
+    furi_string_set_buffer(v, furi_string_data(ref) + offset, MIN(length, ref->size - offset));
 }
 
 size_t furi_string_utf8_length(FuriString* str) {
-    return string_length_u(str->string);
+    const char* data = furi_string_data(str);
+    m_str1ng_utf8_state_e state = M_STRING_UTF8_STARTING;
+    string_unicode_t u = 0;
+    size_t length = 0;
+    for(size_t i = 0; i < str->size; i++) {
+        m_str1ng_utf8_decode(data[i], &state, &u);
+        if(state == M_STRING_UTF8_STARTING) {
+            length++;
+        } else if(state == M_STRING_UTF8_ERROR) {
+            return FURI_STRING_FAILURE;
+        }
+    }
+    return length;
 }
 
 void furi_string_utf8_push(FuriString* str, FuriStringUnicodeValue u) {
-    string_push_u(str->string, u);
+    char buffer[4];
+    size_t length;
+    if(u < 0x80) {
+        buffer[0] = u;
+        length = 1;
+    } else if(u < 0x800) {
+        buffer[0] = 0xC0 | (u >> 6);
+        buffer[1] = 0x80 | (u & 0x3F);
+        length = 2;
+    } else if(u < 0x10000) {
+        buffer[0] = 0xE0 | (u >> 12);
+        buffer[1] = 0x80 | ((u >> 6) & 0x3F);
+        buffer[2] = 0x80 | (u & 0x3F);
+        length = 3;
+    } else {
+        buffer[0] = 0xF0 | (u >> 18);
+        buffer[1] = 0x80 | ((u >> 12) & 0x3F);
+        buffer[2] = 0x80 | ((u >> 6) & 0x3F);
+        buffer[3] = 0x80 | (u & 0x3F);
+        length = 4;
+    }
+    furi_string_cat_buffer(str, buffer, length);
 }
 
 static m_str1ng_utf8_state_e furi_state_to_state(FuriStringUTF8State state) {
@@ -23,6 +23,9 @@ extern "C" {
 /** Furi string primitive. */
 typedef struct FuriString FuriString;
 
+/** Furi string arena, bulk storage for temporary strings. */
+typedef struct FuriStringArena FuriStringArena;
+
 //---------------------------------------------------------------------------
 //                               Constructors
 //---------------------------------------------------------------------------
@@ -96,6 +99,49 @@ FuriString* furi_string_alloc_move(FuriString* source);
  */
 void furi_string_free(FuriString* string);
 
+//---------------------------------------------------------------------------
+//                                 Arena
+//---------------------------------------------------------------------------
+
+/** Allocate string arena.
+ *
+ * Arena hands out strings and their storage from large blocks, so parsers can
+ * create many temporary strings without a heap allocation for each of them
+ * and release them all at once.
+ *
+ * @param      block_size  arena block size in bytes
+ *
+ * @return     pointer to the instance of FuriStringArena
+ */
+FuriStringArena* furi_string_arena_alloc(size_t block_size);
+
+/** Release all strings allocated from arena.
+ *
+ * Strings allocated from arena must not be used after this call. First block
+ * is kept for reuse.
+ *
+ * @param      arena  The FuriStringArena instance
+ */
+void furi_string_arena_reset(FuriStringArena* arena);
+
+/** Free arena and all strings allocated from it.
+ *
+ * @param      arena  The FuriStringArena instance
+ */
+void furi_string_arena_free(FuriStringArena* arena);
+
+/** Allocate new FuriString in arena.
+ *
+ * String works as any other FuriString, but its memory is owned by arena:
+ * furi_string_free does nothing and memory is released with
+ * furi_string_arena_reset or furi_string_arena_free.
+ *
+ * @param      arena  The FuriStringArena instance
+ *
+ * @return     pointer to the instance of FuriString
+ */
+FuriString* furi_string_alloc_arena(FuriStringArena* arena);
+
 //---------------------------------------------------------------------------
 //                         String memory management
 //---------------------------------------------------------------------------
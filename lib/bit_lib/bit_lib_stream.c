@@ -0,0 +1,124 @@
+#include "bit_lib_stream.h"
+#include <core/check.h>
+#include <string.h>
+
+#define BIT_LIB_STREAM_WORD_BITS (32U)
+
+struct BitLibStream {
+    uint32_t* words;
+    size_t capacity;
+    size_t bit_size;
+    size_t head;
+    size_t start;
+    const BitLibStreamPattern* patterns;
+    size_t pattern_count;
+};
+
+BitLibStream* bit_lib_stream_alloc(size_t bit_size) {
+    furi_check(bit_size > 0);
+    furi_check(bit_size % 8 == 0);
+
+    BitLibStream* stream = malloc(sizeof(BitLibStream));
+    // Whole words, so that two neighbouring words always hold any 32 bit span
+    const size_t word_count = (bit_size + BIT_LIB_STREAM_WORD_BITS - 1) / BIT_LIB_STREAM_WORD_BITS;
+    stream->capacity = word_count * BIT_LIB_STREAM_WORD_BITS;
+    stream->bit_size = bit_size;
+    stream->words = malloc(stream->capacity / 8);
+    bit_lib_stream_reset(stream);
+
+    return stream;
+}
+
+void bit_lib_stream_free(BitLibStream* stream) {
+    furi_check(stream);
+
+    free(stream->words);
+    free(stream);
+}
+
+void bit_lib_stream_reset(BitLibStream* stream) {
+    furi_check(stream);
+
+    memset(stream->words, 0, stream->capacity / 8);
+    stream->head = 0;
+    stream->start = stream->capacity - stream->bit_size;
+}
+
+void bit_lib_stream_set_patterns(
+    BitLibStream* stream,
+    const BitLibStreamPattern* patterns,
+    size_t count) {
+    furi_check(stream);
+    furi_check(patterns || count == 0);
+
+    for(size_t i = 0; i < count; i++) {
+        furi_check(patterns[i].length > 0 && patterns[i].length <= 32);
+        furi_check(patterns[i].position + patterns[i].length <= stream->bit_size);
+    }
+
+    stream->patterns = patterns;
+    stream->pattern_count = count;
+}
+
+static inline uint32_t
+    bit_lib_stream_get_bits(const BitLibStream* stream, size_t position, uint8_t length) {
+    size_t index = stream->start + position;
+    if(index >= stream->capacity) index -= stream->capacity;
+
+    const size_t word_count = stream->capacity / BIT_LIB_STREAM_WORD_BITS;
+    const size_t word = index / BIT_LIB_STREAM_WORD_BITS;
+    const size_t next_word = (word + 1 == word_count) ? 0 : word + 1;
+
+    uint64_t value = ((uint64_t)stream->words[word] << 32) | stream->words[next_word];
+    value <<= index % BIT_LIB_STREAM_WORD_BITS;
+
+    return (uint32_t)(value >> (64 - length));
+}
+
+bool bit_lib_stream_push(BitLibStream* stream, bool bit) {
+    furi_assert(stream);
+
+    uint32_t* word = &stream->words[stream->head / BIT_LIB_STREAM_WORD_BITS];
+    const uint32_t mask = 0x80000000UL >> (stream->head % BIT_LIB_STREAM_WORD_BITS);
+    if(bit) {
+        *word |= mask;
+    } else {
+        *word &= ~mask;
+    }
+
+    if(++stream->head == stream->capacity) stream->head = 0;
+    if(++stream->start == stream->capacity) stream->start = 0;
+
+    for(size_t i = 0; i < stream->pattern_count; i++) {
+        const BitLibStreamPattern* pattern = &stream->patterns[i];
+        if(bit_lib_stream_get_bits(stream, pattern->position, pattern->length) != pattern->value) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+uint32_t bit_lib_stream_get_bits_32(const BitLibStream* stream, size_t position, uint8_t length) {
+    furi_check(stream);
+    furi_check(length > 0 && length <= 32);
+    furi_check(position + length <= stream->bit_size);
+
+    return bit_lib_stream_get_bits(stream, position, length);
+}
+
+void bit_lib_stream_read(const BitLibStream* stream, uint8_t* data, size_t data_size) {
+    furi_check(stream);
+    furi_check(data);
+    furi_check(data_size == stream->bit_size / 8);
+
+    for(size_t position = 0; position < stream->bit_size; position += BIT_LIB_STREAM_WORD_BITS) {
+        const size_t left = stream->bit_size - position;
+        const uint8_t length = left < BIT_LIB_STREAM_WORD_BITS ? left : BIT_LIB_STREAM_WORD_BITS;
+        const uint32_t value = bit_lib_stream_get_bits(stream, position, length);
+
+        for(uint8_t i = 0; i < length / 8; i++) {
+            *data++ = value >> (length - 8 * (i + 1));
+        }
+    }
+}
@@ -0,0 +1,92 @@
+/**
+ * @file bit_lib_stream.h
+ * @brief Circular window over a demodulated bit stream
+ *
+ * Keeps the last N pushed bits with O(1) push. Bit positions are the same as
+ * in a byte array shifted with bit_lib_push_bit(): position 0 is the oldest
+ * bit in the window, so decoders can keep their bit offsets.
+ *
+ * Decoders subscribe to fixed patterns (preambles, trailers, constant bits)
+ * and run their full checks only when push reports that all patterns match.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct BitLibStream BitLibStream;
+
+typedef struct {
+    uint16_t position; /**< pattern position in the window, 0 is the oldest bit */
+    uint8_t length; /**< pattern length in bits, 1 to 32 */
+    uint32_t value; /**< expected bits, right aligned */
+} BitLibStreamPattern;
+
+/** Allocate stream
+ *
+ * @param      bit_size  window size in bits, multiple of 8
+ *
+ * @return     BitLibStream instance, window is filled with zeroes
+ */
+BitLibStream* bit_lib_stream_alloc(size_t bit_size);
+
+/** Free stream
+ *
+ * @param      stream  BitLibStream instance
+ */
+void bit_lib_stream_free(BitLibStream* stream);
+
+/** Fill window with zeroes
+ *
+ * @param      stream  BitLibStream instance
+ */
+void bit_lib_stream_reset(BitLibStream* stream);
+
+/** Set patterns checked after each push
+ *
+ * Patterns are checked in order, put the least likely to match first.
+ *
+ * @param      stream    BitLibStream instance
+ * @param      patterns  pattern array, must outlive the stream
+ * @param      count     pattern count
+ */
+void bit_lib_stream_set_patterns(
+    BitLibStream* stream,
+    const BitLibStreamPattern* patterns,
+    size_t count);
+
+/** Push bit into the window, dropping the oldest one
+ *
+ * @param      stream  BitLibStream instance
+ * @param      bit     bit to push
+ *
+ * @return     true if window matches all patterns
+ */
+bool bit_lib_stream_push(BitLibStream* stream, bool bit);
+
+/** Get up to 32 bits from the window
+ *
+ * @param      stream    BitLibStream instance
+ * @param      position  position in the window, 0 is the oldest bit
+ * @param      length    bit count, 1 to 32
+ *
+ * @return     bits, right aligned
+ */
+uint32_t bit_lib_stream_get_bits_32(const BitLibStream* stream, size_t position, uint8_t length);
+
+/** Copy window to byte array in bit_lib_push_bit() layout
+ *
+ * @param      stream     BitLibStream instance
+ * @param      data       destination
+ * @param      data_size  destination size, must be window size in bytes
+ */
+void bit_lib_stream_read(const BitLibStream* stream, uint8_t* data, size_t data_size);
+
+#ifdef __cplusplus
+}
+#endif
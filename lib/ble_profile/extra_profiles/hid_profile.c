@@ -243,6 +243,65 @@ bool ble_profile_hid_kb_release_all(FuriHalBleProfileBase* profile) {
         sizeof(FuriHalBtHidKbReport));
 }
 
+bool ble_profile_hid_kb_type(
+    FuriHalBleProfileBase* profile,
+    const uint16_t* buttons,
+    size_t count) {
+    furi_check(profile);
+    furi_check(profile->config == ble_profile_hid);
+    furi_check(buttons || count == 0);
+
+    BleProfileHid* hid_profile = (BleProfileHid*)profile;
+    FuriHalBtHidKbReport* kb_report = hid_profile->kb_report;
+
+    // Typed keys take one free slot, held keys and modifiers are left as is
+    uint8_t slot = BLE_PROFILE_HID_KB_MAX_KEYS;
+    for(uint8_t i = 0; i < BLE_PROFILE_HID_KB_MAX_KEYS; i++) {
+        if(kb_report->key[i] == 0) {
+            slot = i;
+            break;
+        }
+    }
+    if(slot == BLE_PROFILE_HID_KB_MAX_KEYS) return false;
+
+    const uint8_t held_mods = kb_report->mods;
+    bool state = true;
+    for(size_t i = 0; (i < count) && state; i++) {
+        uint8_t key = buttons[i] & 0xFF;
+        if(key == HID_KEYBOARD_NONE) continue;
+
+        const uint8_t mods = held_mods | (buttons[i] >> 8);
+        if(kb_report->key[slot] == key || kb_report->mods != mods) {
+            // Same key twice in a row or modifier change: release the previous key and set
+            // modifiers in a report of its own, hosts may apply them late otherwise
+            kb_report->key[slot] = 0;
+            kb_report->mods = mods;
+            state = ble_svc_hid_update_input_report(
+                hid_profile->hid_svc,
+                ReportNumberKeyboard,
+                (uint8_t*)kb_report,
+                sizeof(FuriHalBtHidKbReport));
+            if(!state) break;
+        }
+
+        kb_report->key[slot] = key;
+        state = ble_svc_hid_update_input_report(
+            hid_profile->hid_svc,
+            ReportNumberKeyboard,
+            (uint8_t*)kb_report,
+            sizeof(FuriHalBtHidKbReport));
+    }
+
+    kb_report->key[slot] = 0;
+    kb_report->mods = held_mods;
+    return ble_svc_hid_update_input_report(
+               hid_profile->hid_svc,
+               ReportNumberKeyboard,
+               (uint8_t*)kb_report,
+               sizeof(FuriHalBtHidKbReport)) &&
+           state;
+}
+
 bool ble_profile_hid_consumer_key_press(FuriHalBleProfileBase* profile, uint16_t button) {
     furi_check(profile);
     furi_check(profile->config == ble_profile_hid);
@@ -43,6 +43,23 @@ bool ble_profile_hid_kb_release(FuriHalBleProfileBase* profile, uint16_t button)
  */
 bool ble_profile_hid_kb_release_all(FuriHalBleProfileBase* profile);
 
+/** Type a sequence of keys using as few HID reports as possible
+ *
+ * Each key is pressed in the same report that releases the previous one. An
+ * extra release report is sent between two presses of the same key and before
+ * a key with different modifiers, which are changed in that report. Held keys
+ * stay pressed.
+ *
+ * @param profile   profile instance
+ * @param buttons   key codes, HID_KEYBOARD_NONE entries are skipped
+ * @param count     number of key codes
+ * @return          true on success
+ */
+bool ble_profile_hid_kb_type(
+    FuriHalBleProfileBase* profile,
+    const uint16_t* buttons,
+    size_t count);
+
 /** Set the following consumer key to pressed state and send HID report
  *
  * @param profile   profile instance
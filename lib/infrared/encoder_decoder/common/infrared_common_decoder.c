@@ -229,6 +229,16 @@ InfraredMessage*
     }
     decoder->level = level; // start with low level (Space timing)
 
+    /* Fast reject: idle decoder waits for preamble mark, anything else
+     * would be buffered only to be consumed on the next edge. */
+    const InfraredTimings* timings = &decoder->protocol->timings;
+    if((decoder->state == InfraredCommonDecoderStateWaitPreamble) &&
+       (decoder->timings_cnt == 0) && timings->preamble_mark &&
+       (!level ||
+        !MATCH_TIMING(duration, timings->preamble_mark, timings->preamble_tolerance))) {
+        return NULL;
+    }
+
     decoder->timings[decoder->timings_cnt] = duration;
     decoder->timings_cnt++;
     furi_check(decoder->timings_cnt <= sizeof(decoder->timings));
@@ -10,6 +10,17 @@
 
 #define INFRARED_WORKER_RX_TIMEOUT INFRARED_RAW_RX_TIMING_DELAY_US
 
+/* Edges the capture ISR accumulates before waking the RX thread */
+#define INFRARED_WORKER_RX_BATCH_SIZE 16U
+
+/* Edge this long is a gap between messages or a preamble, RX thread is woken right away
+ * to finish the previous message. Shorter than min split time of any decoder (RC5: 2700) */
+#define INFRARED_WORKER_RX_SPLIT_US 2500U
+
+/* While a signal is being received, edges below batch size are picked up this often,
+ * so the last edges of a message are not held until the next message or the timeout */
+#define INFRARED_WORKER_RX_POLL_MS 5U
+
 #define INFRARED_WORKER_RX_RECEIVED         0x01
 #define INFRARED_WORKER_RX_TIMEOUT_RECEIVED 0x02
 #define INFRARED_WORKER_OVERRUN             0x04
@@ -77,6 +88,7 @@ struct InfraredWorker {
             InfraredWorkerReceivedSignalCallback received_signal_callback;
             void* received_signal_context;
             bool overrun;
+            uint32_t overrun_count;
         } rx;
     };
 };
@@ -99,19 +111,33 @@ static void infrared_worker_rx_timeout_callback(void* context) {
     furi_check(flags_set & INFRARED_WORKER_RX_TIMEOUT_RECEIVED);
 }
 
-static void infrared_worker_rx_callback(void* context, bool level, uint32_t duration) {
+void infrared_worker_rx_callback(void* context, bool level, uint32_t duration) {
     InfraredWorker* instance = context;
 
     furi_assert(duration != 0);
     LevelDuration level_duration = level_duration_make(level, duration);
 
-    size_t ret =
-        furi_stream_buffer_send(instance->stream, &level_duration, sizeof(LevelDuration), 0);
-    uint32_t events = (ret == sizeof(LevelDuration)) ? INFRARED_WORKER_RX_RECEIVED :
-                                                       INFRARED_WORKER_OVERRUN;
+    // Stream buffer accepts partial writes: half of an edge left in it would shift every
+    // following one, so the edge is only sent if it fits completely
+    size_t ret = 0;
+    if(furi_stream_buffer_spaces_available(instance->stream) >= sizeof(LevelDuration)) {
+        ret = furi_stream_buffer_send(instance->stream, &level_duration, sizeof(LevelDuration), 0);
+    }
 
-    uint32_t flags_set = furi_thread_flags_set(furi_thread_get_id(instance->thread), events);
-    furi_check(flags_set & events);
+    uint32_t events = 0;
+    if(ret != sizeof(LevelDuration)) {
+        events = INFRARED_WORKER_OVERRUN;
+    } else if(
+        (duration >= INFRARED_WORKER_RX_SPLIT_US) ||
+        (furi_stream_buffer_bytes_available(instance->stream) >=
+         sizeof(LevelDuration) * INFRARED_WORKER_RX_BATCH_SIZE)) {
+        events = INFRARED_WORKER_RX_RECEIVED;
+    }
+
+    if(events) {
+        uint32_t flags_set = furi_thread_flags_set(furi_thread_get_id(instance->thread), events);
+        furi_check(flags_set & events);
+    }
 }
 
 static void infrared_worker_process_timeout(InfraredWorker* instance) {
@@ -161,17 +187,38 @@ static void
     }
 }
 
+static void infrared_worker_rx_drain(InfraredWorker* instance) {
+    LevelDuration level_durations[INFRARED_WORKER_RX_BATCH_SIZE];
+
+    size_t received;
+    while((received = furi_stream_buffer_receive(
+               instance->stream, level_durations, sizeof(level_durations), 0)) > 0) {
+        if(instance->rx.overrun) continue;
+
+        for(size_t i = 0; i < received / sizeof(LevelDuration); i++) {
+            bool level = level_duration_get_level(level_durations[i]);
+            uint32_t duration = level_duration_get_duration(level_durations[i]);
+            infrared_worker_process_timings(instance, duration, level);
+        }
+    }
+}
+
 static int32_t infrared_worker_rx_thread(void* thread_context) {
     InfraredWorker* instance = thread_context;
     uint32_t events = 0;
-    LevelDuration level_duration;
     uint32_t last_blink_time = 0;
 
     while(1) {
-        events = furi_thread_flags_wait(INFRARED_WORKER_ALL_RX_EVENTS, 0, FuriWaitForever);
+        const uint32_t timeout = instance->signal.timings_cnt ? INFRARED_WORKER_RX_POLL_MS :
+                                                                FuriWaitForever;
+        events = furi_thread_flags_wait(INFRARED_WORKER_ALL_RX_EVENTS, 0, timeout);
+        if(events == (unsigned)FuriFlagErrorTimeout) {
+            infrared_worker_rx_drain(instance);
+            continue;
+        }
         furi_check(events & INFRARED_WORKER_ALL_RX_EVENTS); /* at least one caught */
 
-        if(events & INFRARED_WORKER_RX_RECEIVED) {
+        if(events & (INFRARED_WORKER_RX_RECEIVED | INFRARED_WORKER_RX_TIMEOUT_RECEIVED)) {
             if(!instance->rx.overrun && instance->blink_enable &&
                ((furi_get_tick() - last_blink_time) > 80)) {
                 last_blink_time = furi_get_tick();
@@ -179,18 +226,11 @@ static int32_t infrared_worker_rx_thread(void* thread_context) {
             }
             if(instance->signal.timings_cnt == 0)
                 notification_message(instance->notification, &sequence_display_backlight_on);
-            while(sizeof(LevelDuration) ==
-                  furi_stream_buffer_receive(
-                      instance->stream, &level_duration, sizeof(LevelDuration), 0)) {
-                if(!instance->rx.overrun) {
-                    bool level = level_duration_get_level(level_duration);
-                    uint32_t duration = level_duration_get_duration(level_duration);
-                    infrared_worker_process_timings(instance, duration, level);
-                }
-            }
+            infrared_worker_rx_drain(instance);
         }
         if(events & INFRARED_WORKER_OVERRUN) {
             printf("#");
+            instance->rx.overrun_count++;
             infrared_reset_decoder(instance->infrared_decoder);
             instance->signal.timings_cnt = 0;
             if(instance->blink_enable)
@@ -271,6 +311,7 @@ void infrared_worker_rx_start(InfraredWorker* instance) {
     furi_hal_infrared_async_rx_set_timeout(INFRARED_WORKER_RX_TIMEOUT);
 
     instance->rx.overrun = false;
+    instance->rx.overrun_count = 0;
     instance->state = InfraredWorkerStateRunRx;
 }
 
@@ -290,6 +331,12 @@ void infrared_worker_rx_stop(InfraredWorker* instance) {
     instance->state = InfraredWorkerStateIdle;
 }
 
+uint32_t infrared_worker_rx_get_overrun_count(const InfraredWorker* instance) {
+    furi_check(instance);
+
+    return instance->rx.overrun_count;
+}
+
 bool infrared_worker_signal_is_decoded(const InfraredWorkerSignal* signal) {
     furi_check(signal);
 
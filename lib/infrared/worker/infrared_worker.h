@@ -68,6 +68,28 @@ void infrared_worker_rx_set_received_signal_callback(
     InfraredWorkerReceivedSignalCallback callback,
     void* context);
 
+/** Feed one captured edge to the receiving worker
+ *
+ * This is the capture callback installed by infrared_worker_rx_start(), safe
+ * to call from ISR. Edges that do not fit into the capture buffer are dropped
+ * as a whole and counted as an overrun.
+ *
+ * @param[in]   context - InfraredWorker instance
+ * @param[in]   level - level of the captured period
+ * @param[in]   duration - duration of the captured period in microseconds
+ */
+void infrared_worker_rx_callback(void* context, bool level, uint32_t duration);
+
+/** Get the number of receive overruns since infrared_worker_rx_start()
+ *
+ * An overrun happens when the capture buffer or the raw timings array gets
+ * full, the signal being received is dropped in that case.
+ *
+ * @param[in]   instance - InfraredWorker instance
+ * @return      overrun count
+ */
+uint32_t infrared_worker_rx_get_overrun_count(const InfraredWorker* instance);
+
 /** Enable blinking on receiving any signal on IR port.
  *
  * @param[in]   instance - instance of InfraredWorker
@@ -1,10 +1,18 @@
 #include "lfrfid_raw_file.h"
 #include "tools/varint_pair.h"
 #include <toolbox/stream/file_stream.h>
-#include <toolbox/varint.h>
+#include <toolbox/compress.h>
 
-#define LFRFID_RAW_FILE_MAGIC   0x4C464952
-#define LFRFID_RAW_FILE_VERSION 1
+#define LFRFID_RAW_FILE_MAGIC          0x4C464952
+#define LFRFID_RAW_FILE_VERSION_PLAIN  1
+#define LFRFID_RAW_FILE_VERSION_BLOCKS 2
+#define LFRFID_RAW_FILE_VERSION        LFRFID_RAW_FILE_VERSION_BLOCKS
+
+#define LFRFID_RAW_FILE_INDEX_MAGIC 0x58444E49
+#define LFRFID_RAW_FILE_INDEX_COUNT 128
+
+// Block holds one capture buffer, compressor stores incompressible data as is behind its header
+#define LFRFID_RAW_FILE_BLOCK_SIZE(max_buffer_size) ((max_buffer_size) + 16)
 
 #define TAG "LfRfidRawFile"
 
@@ -16,13 +24,50 @@ typedef struct {
     uint32_t max_buffer_size;
 } LFRFIDRawFileHeader;
 
+typedef struct {
+    uint32_t size;
+    uint32_t pair_count;
+} LFRFIDRawFileBlockHeader;
+
+typedef struct {
+    uint32_t offset;
+    uint32_t pair_index;
+} LFRFIDRawFileIndexEntry;
+
+typedef struct {
+    uint32_t count;
+    uint32_t pair_count;
+    uint32_t magic;
+} LFRFIDRawFileIndexFooter;
+
+// Bigger window than the icon default, captures repeat with the tag frame period
+static const CompressConfigHeatshrink lfrfid_raw_file_compress_config = {
+    .window_sz2 = 9,
+    .lookahead_sz2 = 4,
+    .input_buffer_sz = 256,
+};
+
 struct LFRFIDRawFile {
     Stream* stream;
+    uint32_t version;
     uint32_t max_buffer_size;
 
     uint8_t* buffer;
     uint32_t buffer_size;
     size_t buffer_counter;
+
+    // Block format state
+    Compress* compress;
+    uint8_t* block;
+    size_t data_end;
+    uint32_t pair_index;
+    uint32_t pair_count;
+    uint32_t block_count;
+
+    LFRFIDRawFileIndexEntry* index;
+    uint32_t index_count;
+    uint32_t index_stride;
+    bool index_pending;
 };
 
 LFRFIDRawFile* lfrfid_raw_file_alloc(Storage* storage) {
@@ -34,10 +79,32 @@ LFRFIDRawFile* lfrfid_raw_file_alloc(Storage* storage) {
     return file;
 }
 
+static void lfrfid_raw_file_write_index(LFRFIDRawFile* file) {
+    size_t size = file->index_count * sizeof(LFRFIDRawFileIndexEntry);
+    if(stream_write(file->stream, (uint8_t*)file->index, size) != size) {
+        FURI_LOG_E(TAG, "write index: failed to write entries");
+        return;
+    }
+
+    LFRFIDRawFileIndexFooter footer = {
+        .count = file->index_count,
+        .pair_count = file->pair_index,
+        .magic = LFRFID_RAW_FILE_INDEX_MAGIC,
+    };
+    if(stream_write(file->stream, (uint8_t*)&footer, sizeof(footer)) != sizeof(footer)) {
+        FURI_LOG_E(TAG, "write index: failed to write footer");
+    }
+}
+
 void lfrfid_raw_file_free(LFRFIDRawFile* file) {
     furi_check(file);
 
+    if(file->index_pending) lfrfid_raw_file_write_index(file);
+
     if(file->buffer) free(file->buffer);
+    if(file->block) free(file->block);
+    if(file->index) free(file->index);
+    if(file->compress) compress_free(file->compress);
     stream_free(file->stream);
     free(file);
 }
@@ -56,12 +123,20 @@ bool lfrfid_raw_file_open_read(LFRFIDRawFile* file, const char* file_path) {
     return file_stream_open(file->stream, file_path, FSAM_READ, FSOM_OPEN_EXISTING);
 }
 
+static void lfrfid_raw_file_alloc_blocks(LFRFIDRawFile* file) {
+    const size_t block_size = LFRFID_RAW_FILE_BLOCK_SIZE(file->max_buffer_size);
+    file->buffer = malloc(block_size);
+    file->block = malloc(block_size);
+    file->compress = compress_alloc(CompressTypeHeatshrink, &lfrfid_raw_file_compress_config);
+}
+
 bool lfrfid_raw_file_write_header(
     LFRFIDRawFile* file,
     float frequency,
     float duty_cycle,
     uint32_t max_buffer_size) {
     furi_check(file);
+    furi_check(file->buffer == NULL);
 
     LFRFIDRawFileHeader header = {
         .magic = LFRFID_RAW_FILE_MAGIC,
@@ -71,98 +146,314 @@ bool lfrfid_raw_file_write_header(
         .max_buffer_size = max_buffer_size};
 
     size_t size = stream_write(file->stream, (uint8_t*)&header, sizeof(LFRFIDRawFileHeader));
-    return size == sizeof(LFRFIDRawFileHeader);
+    if(size != sizeof(LFRFIDRawFileHeader)) return false;
+
+    file->version = LFRFID_RAW_FILE_VERSION;
+    file->max_buffer_size = max_buffer_size;
+    lfrfid_raw_file_alloc_blocks(file);
+    file->index = malloc(LFRFID_RAW_FILE_INDEX_COUNT * sizeof(LFRFIDRawFileIndexEntry));
+    file->index_stride = 1;
+    file->index_pending = true;
+
+    return true;
+}
+
+static void lfrfid_raw_file_index_add(LFRFIDRawFile* file, uint32_t offset) {
+    if(file->block_count++ % file->index_stride) return;
+
+    if(file->index_count == LFRFID_RAW_FILE_INDEX_COUNT) {
+        // Keep memory bounded on long captures: drop every other entry, double the stride
+        for(size_t i = 0; i < LFRFID_RAW_FILE_INDEX_COUNT / 2; i++) {
+            file->index[i] = file->index[i * 2];
+        }
+        file->index_count = LFRFID_RAW_FILE_INDEX_COUNT / 2;
+        file->index_stride *= 2;
+        if((file->block_count - 1) % file->index_stride) return;
+    }
+
+    file->index[file->index_count].offset = offset;
+    file->index[file->index_count].pair_index = file->pair_index;
+    file->index_count++;
 }
 
 bool lfrfid_raw_file_write_buffer(LFRFIDRawFile* file, uint8_t* buffer_data, size_t buffer_size) {
     furi_check(file);
+    furi_check(file->buffer);
     furi_check(buffer_data);
     furi_check(buffer_size);
+    furi_check(buffer_size <= file->max_buffer_size);
+
+    // Pair count goes to the block header, so that seek can skip blocks without decoding
+    uint32_t pair_count = 0;
+    size_t data_size = 0;
+    while(data_size < buffer_size) {
+        uint32_t pulse, duration;
+        size_t size = 0;
+        if(!varint_pair_unpack(
+               &buffer_data[data_size], buffer_size - data_size, &pulse, &duration, &size)) {
+            break;
+        }
+        data_size += size;
+        pair_count++;
+    }
+
+    if(pair_count == 0) return true;
 
+    LFRFIDRawFileBlockHeader block_header = {.pair_count = pair_count};
+    size_t block_size = 0;
+    if(!compress_encode(
+           file->compress,
+           buffer_data,
+           data_size,
+           file->block,
+           LFRFID_RAW_FILE_BLOCK_SIZE(file->max_buffer_size),
+           &block_size)) {
+        return false;
+    }
+    block_header.size = block_size;
+
+    const size_t offset = stream_tell(file->stream);
     size_t size;
-    size = stream_write(file->stream, (uint8_t*)&buffer_size, sizeof(size_t));
-    if(size != sizeof(size_t)) return false;
+    size = stream_write(file->stream, (uint8_t*)&block_header, sizeof(block_header));
+    if(size != sizeof(block_header)) return false;
+
+    size = stream_write(file->stream, file->block, block_size);
+    if(size != block_size) return false;
 
-    size = stream_write(file->stream, buffer_data, buffer_size);
-    if(size != buffer_size) return false;
+    lfrfid_raw_file_index_add(file, offset);
+    file->pair_index += pair_count;
 
     return true;
 }
 
+static void lfrfid_raw_file_read_index(LFRFIDRawFile* file) {
+    const size_t file_size = stream_size(file->stream);
+    file->data_end = file_size;
+
+    LFRFIDRawFileIndexFooter footer;
+    if(file_size < sizeof(LFRFIDRawFileHeader) + sizeof(footer)) return;
+    if(!stream_seek(file->stream, file_size - sizeof(footer), StreamOffsetFromStart)) return;
+    if(stream_read(file->stream, (uint8_t*)&footer, sizeof(footer)) != sizeof(footer)) return;
+    if(footer.magic != LFRFID_RAW_FILE_INDEX_MAGIC) {
+        FURI_LOG_W(TAG, "No index, capture was not finished");
+        return;
+    }
+
+    const size_t index_size = footer.count * sizeof(LFRFIDRawFileIndexEntry);
+    if(footer.count == 0 || footer.count > LFRFID_RAW_FILE_INDEX_COUNT ||
+       file_size < sizeof(LFRFIDRawFileHeader) + index_size + sizeof(footer)) {
+        return;
+    }
+
+    const size_t index_offset = file_size - sizeof(footer) - index_size;
+    file->index = malloc(index_size);
+    if(!stream_seek(file->stream, index_offset, StreamOffsetFromStart) ||
+       stream_read(file->stream, (uint8_t*)file->index, index_size) != index_size) {
+        free(file->index);
+        file->index = NULL;
+        return;
+    }
+
+    file->index_count = footer.count;
+    file->pair_count = footer.pair_count;
+    file->data_end = index_offset;
+}
+
 bool lfrfid_raw_file_read_header(LFRFIDRawFile* file, float* frequency, float* duty_cycle) {
     furi_check(file);
+    furi_check(file->buffer == NULL);
     furi_check(frequency);
     furi_check(duty_cycle);
 
     LFRFIDRawFileHeader header;
     size_t size = stream_read(file->stream, (uint8_t*)&header, sizeof(LFRFIDRawFileHeader));
-    if(size == sizeof(LFRFIDRawFileHeader)) {
-        if(header.magic == LFRFID_RAW_FILE_MAGIC && header.version == LFRFID_RAW_FILE_VERSION) {
-            *frequency = header.frequency;
-            *duty_cycle = header.duty_cycle;
-            file->max_buffer_size = header.max_buffer_size;
-            file->buffer = malloc(file->max_buffer_size);
-            file->buffer_size = 0;
-            file->buffer_counter = 0;
-            return true;
-        } else {
-            return false;
-        }
+    if(size != sizeof(LFRFIDRawFileHeader) || header.magic != LFRFID_RAW_FILE_MAGIC) {
+        return false;
+    }
+
+    file->version = header.version;
+    file->max_buffer_size = header.max_buffer_size;
+    file->buffer_size = 0;
+    file->buffer_counter = 0;
+
+    if(header.version == LFRFID_RAW_FILE_VERSION_PLAIN) {
+        file->buffer = malloc(file->max_buffer_size);
+    } else if(header.version == LFRFID_RAW_FILE_VERSION_BLOCKS) {
+        lfrfid_raw_file_alloc_blocks(file);
+        lfrfid_raw_file_read_index(file);
+        stream_seek(file->stream, sizeof(LFRFIDRawFileHeader), StreamOffsetFromStart);
     } else {
         return false;
     }
+
+    *frequency = header.frequency;
+    *duty_cycle = header.duty_cycle;
+    return true;
+}
+
+static bool lfrfid_raw_file_read_plain_buffer(LFRFIDRawFile* file, bool* pass_end) {
+    if(stream_eof(file->stream)) {
+        // rewind stream and pass header
+        stream_seek(file->stream, sizeof(LFRFIDRawFileHeader), StreamOffsetFromStart);
+        if(pass_end) *pass_end = true;
+    }
+
+    // Plain format stores size_t, which is 32 bit on target
+    size_t length = stream_read(file->stream, (uint8_t*)&file->buffer_size, sizeof(uint32_t));
+    if(length != sizeof(uint32_t)) {
+        FURI_LOG_E(TAG, "read pair: failed to read size");
+        return false;
+    }
+
+    if(file->buffer_size > file->max_buffer_size) {
+        FURI_LOG_E(TAG, "read pair: buffer size is too big");
+        return false;
+    }
+
+    length = stream_read(file->stream, file->buffer, file->buffer_size);
+    if(length != file->buffer_size) {
+        FURI_LOG_E(TAG, "read pair: failed to read data");
+        return false;
+    }
+
+    return true;
 }
 
-bool lfrfid_raw_file_read_pair(
+static bool lfrfid_raw_file_read_block(LFRFIDRawFile* file, bool* pass_end) {
+    if(stream_tell(file->stream) >= file->data_end) {
+        stream_seek(file->stream, sizeof(LFRFIDRawFileHeader), StreamOffsetFromStart);
+        file->pair_index = 0;
+        if(pass_end) *pass_end = true;
+    }
+
+    LFRFIDRawFileBlockHeader block_header;
+    size_t length = stream_read(file->stream, (uint8_t*)&block_header, sizeof(block_header));
+    if(length != sizeof(block_header)) {
+        FURI_LOG_E(TAG, "read block: failed to read header");
+        return false;
+    }
+
+    const size_t block_size = LFRFID_RAW_FILE_BLOCK_SIZE(file->max_buffer_size);
+    if(block_header.size == 0 || block_header.size > block_size) {
+        FURI_LOG_E(TAG, "read block: block is too big");
+        return false;
+    }
+
+    length = stream_read(file->stream, file->block, block_header.size);
+    if(length != block_header.size) {
+        FURI_LOG_E(TAG, "read block: failed to read data");
+        return false;
+    }
+
+    size_t decoded_size = 0;
+    if(!compress_decode(
+           file->compress,
+           file->block,
+           block_header.size,
+           file->buffer,
+           block_size,
+           &decoded_size)) {
+        FURI_LOG_E(TAG, "read block: failed to decompress");
+        return false;
+    }
+
+    file->buffer_size = decoded_size;
+
+    return true;
+}
+
+size_t lfrfid_raw_file_read_pairs(
     LFRFIDRawFile* file,
     uint32_t* duration,
     uint32_t* pulse,
+    size_t count,
     bool* pass_end) {
     furi_check(file);
+    furi_check(file->buffer);
     furi_check(duration);
     furi_check(pulse);
 
-    size_t length = 0;
-    if(file->buffer_counter >= file->buffer_size) {
-        if(stream_eof(file->stream)) {
-            // rewind stream and pass header
-            stream_seek(file->stream, sizeof(LFRFIDRawFileHeader), StreamOffsetFromStart);
-            if(pass_end) *pass_end = true;
-        }
+    const bool blocks = file->version == LFRFID_RAW_FILE_VERSION_BLOCKS;
+    size_t read = 0;
 
-        length = stream_read(file->stream, (uint8_t*)&file->buffer_size, sizeof(size_t));
-        if(length != sizeof(size_t)) {
-            FURI_LOG_E(TAG, "read pair: failed to read size");
-            return false;
+    while(read < count) {
+        if(file->buffer_counter >= file->buffer_size) {
+            bool loaded = blocks ? lfrfid_raw_file_read_block(file, pass_end) :
+                                   lfrfid_raw_file_read_plain_buffer(file, pass_end);
+            if(!loaded) break;
+            file->buffer_counter = 0;
         }
 
-        if(file->buffer_size > file->max_buffer_size) {
-            FURI_LOG_E(TAG, "read pair: buffer size is too big");
-            return false;
+        // Buffer is unpacked straight into the destination arrays
+        const size_t start = read;
+        while(read < count && file->buffer_counter < file->buffer_size) {
+            size_t size = 0;
+            if(!varint_pair_unpack(
+                   &file->buffer[file->buffer_counter],
+                   file->buffer_size - file->buffer_counter,
+                   &pulse[read],
+                   &duration[read],
+                   &size)) {
+                break;
+            }
+            file->buffer_counter += size;
+            read++;
         }
 
-        length = stream_read(file->stream, file->buffer, file->buffer_size);
-        if(length != file->buffer_size) {
-            FURI_LOG_E(TAG, "read pair: failed to read data");
-            return false;
+        if(read == start) {
+            FURI_LOG_E(TAG, "read pair: buffer is too small");
+            break;
         }
+        if(blocks) file->pair_index += read - start;
+    }
+
+    return read;
+}
 
-        file->buffer_counter = 0;
+bool lfrfid_raw_file_read_pair(
+    LFRFIDRawFile* file,
+    uint32_t* duration,
+    uint32_t* pulse,
+    bool* pass_end) {
+    return lfrfid_raw_file_read_pairs(file, duration, pulse, 1, pass_end) == 1;
+}
+
+bool lfrfid_raw_file_seek(LFRFIDRawFile* file, uint32_t pair_index) {
+    furi_check(file);
+    furi_check(file->buffer);
+
+    // Plain format has no pair counts to skip by
+    if(file->version != LFRFID_RAW_FILE_VERSION_BLOCKS) return false;
+
+    size_t offset = sizeof(LFRFIDRawFileHeader);
+    uint32_t block_pair_index = 0;
+    for(size_t i = 0; i < file->index_count && file->index[i].pair_index <= pair_index; i++) {
+        offset = file->index[i].offset;
+        block_pair_index = file->index[i].pair_index;
     }
+    if(!stream_seek(file->stream, offset, StreamOffsetFromStart)) return false;
 
-    size_t size = 0;
-    bool result = varint_pair_unpack(
-        &file->buffer[file->buffer_counter],
-        (size_t)(file->buffer_size - file->buffer_counter),
-        pulse,
-        duration,
-        &size);
+    // Skip whole blocks by header, without decompressing them
+    LFRFIDRawFileBlockHeader block_header;
+    while(true) {
+        if(stream_tell(file->stream) >= file->data_end) return false;
 
-    if(result) {
-        file->buffer_counter += size;
-    } else {
-        FURI_LOG_E(TAG, "read pair: buffer is too small");
-        return false;
+        size_t length = stream_read(file->stream, (uint8_t*)&block_header, sizeof(block_header));
+        if(length != sizeof(block_header)) return false;
+        if(block_pair_index + block_header.pair_count > pair_index) break;
+
+        block_pair_index += block_header.pair_count;
+        if(!stream_seek(file->stream, block_header.size, StreamOffsetFromCurrent)) return false;
+    }
+
+    stream_seek(file->stream, -(int32_t)sizeof(block_header), StreamOffsetFromCurrent);
+    file->buffer_size = 0;
+    file->buffer_counter = 0;
+    file->pair_index = block_pair_index;
+
+    while(file->pair_index < pair_index) {
+        uint32_t duration, pulse;
+        if(!lfrfid_raw_file_read_pair(file, &duration, &pulse, NULL)) return false;
     }
 
     return true;
@@ -17,7 +17,7 @@ typedef struct LFRFIDRawFile LFRFIDRawFile;
 LFRFIDRawFile* lfrfid_raw_file_alloc(Storage* storage);
 
 /**
- * @brief Free a LFRFIDRawFile instance
+ * @brief Free a LFRFIDRawFile instance, writes seek index if file was written
  * 
  * @param file 
  */
@@ -56,11 +56,11 @@ bool lfrfid_raw_file_write_header(
     uint32_t max_buffer_size);
 
 /**
- * @brief Write data to RAW file
+ * @brief Write data to RAW file as compressed block
  * 
  * @param file 
- * @param buffer_data 
- * @param buffer_size 
+ * @param buffer_data varint-encoded pairs
+ * @param buffer_size not more than max_buffer_size from header
  * @return bool 
  */
 bool lfrfid_raw_file_write_buffer(LFRFIDRawFile* file, uint8_t* buffer_data, size_t buffer_size);
@@ -90,6 +90,32 @@ bool lfrfid_raw_file_read_pair(
     uint32_t* pulse,
     bool* pass_end);
 
+/**
+ * @brief Read up to count pairs from RAW file, block by block
+ * 
+ * @param file 
+ * @param duration array of count elements
+ * @param pulse array of count elements
+ * @param count 
+ * @param pass_end file was wrapped around, can be NULL
+ * @return size_t pairs read, less than count on error
+ */
+size_t lfrfid_raw_file_read_pairs(
+    LFRFIDRawFile* file,
+    uint32_t* duration,
+    uint32_t* pulse,
+    size_t count,
+    bool* pass_end);
+
+/**
+ * @brief Seek to pair, uses index written at the end of capture
+ * 
+ * @param file 
+ * @param pair_index 
+ * @return bool false for files without blocks or if pair is out of range
+ */
+bool lfrfid_raw_file_seek(LFRFIDRawFile* file, uint32_t pair_index);
+
 #ifdef __cplusplus
 }
 #endif
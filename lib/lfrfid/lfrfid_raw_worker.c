@@ -237,6 +237,25 @@ static void rfid_emulate_dma_isr(bool half, void* context) {
     }
 }
 
+static bool lfrfid_raw_emulate_fill(
+    LFRFIDRawFile* file,
+    uint32_t* buffer_arr,
+    uint32_t* buffer_ccr,
+    size_t count) {
+    // Whole half of DMA buffer is read at once, then converted to timer ticks
+    if(lfrfid_raw_file_read_pairs(file, buffer_arr, buffer_ccr, count, NULL) != count) {
+        return false;
+    }
+
+    for(size_t i = 0; i < count; i++) {
+        buffer_arr[i] /= 8;
+        buffer_arr[i] -= 1;
+        buffer_ccr[i] /= 8;
+    }
+
+    return true;
+}
+
 static int32_t lfrfid_raw_emulate_worker_thread(void* thread_context) {
     LFRFIDRawWorker* worker = thread_context;
 
@@ -256,14 +275,8 @@ static int32_t lfrfid_raw_emulate_worker_thread(void* thread_context) {
         file_valid = lfrfid_raw_file_read_header(file, &worker->frequency, &worker->duty_cycle);
         if(!file_valid) break;
 
-        for(size_t i = 0; i < EMULATE_BUFFER_SIZE; i++) {
-            file_valid = lfrfid_raw_file_read_pair(
-                file, &data->emulate_buffer_arr[i], &data->emulate_buffer_ccr[i], NULL);
-            if(!file_valid) break;
-            data->emulate_buffer_arr[i] /= 8;
-            data->emulate_buffer_arr[i] -= 1;
-            data->emulate_buffer_ccr[i] /= 8;
-        }
+        file_valid = lfrfid_raw_emulate_fill(
+            file, data->emulate_buffer_arr, data->emulate_buffer_ccr, EMULATE_BUFFER_SIZE);
     } while(false);
 
     furi_hal_rfid_tim_emulate_dma_start(
@@ -291,17 +304,11 @@ static int32_t lfrfid_raw_emulate_worker_thread(void* thread_context) {
                     start = (EMULATE_BUFFER_SIZE / 2);
                 }
 
-                for(size_t i = 0; i < (EMULATE_BUFFER_SIZE / 2); i++) {
-                    file_valid = lfrfid_raw_file_read_pair(
-                        file,
-                        &data->emulate_buffer_arr[start + i],
-                        &data->emulate_buffer_ccr[start + i],
-                        NULL);
-                    if(!file_valid) break;
-                    data->emulate_buffer_arr[i] /= 8;
-                    data->emulate_buffer_arr[i] -= 1;
-                    data->emulate_buffer_ccr[i] /= 8;
-                }
+                file_valid = lfrfid_raw_emulate_fill(
+                    file,
+                    &data->emulate_buffer_arr[start],
+                    &data->emulate_buffer_ccr[start],
+                    EMULATE_BUFFER_SIZE / 2);
             } else if(size != 0) {
                 data->ctx.overrun_count++;
             }
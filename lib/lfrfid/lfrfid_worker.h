@@ -22,6 +22,9 @@ typedef enum {
     LFRFIDWorkerReadTypeAuto,
     LFRFIDWorkerReadTypeASKOnly,
     LFRFIDWorkerReadTypePSKOnly,
+    // EXPERIMENTAL: ASK and PSK decoders fed from one PSK carrier capture. ASK and FSK
+    // decoding on PSK carrier is not verified on hardware, never use it by default.
+    LFRFIDWorkerReadTypeExperimentalParallel,
 } LFRFIDWorkerReadType;
 
 typedef enum {
@@ -112,7 +112,8 @@ static LFRFIDWorkerReadState lfrfid_worker_read_internal(
     ProtocolId* result_protocol) {
     LFRFIDWorkerReadState state = LFRFIDWorkerReadTimeout;
 
-    if(feature & LFRFIDFeatureASK) {
+    // PSK carrier is also used when all features are read in parallel
+    if(!(feature & LFRFIDFeaturePSK)) {
         furi_hal_rfid_tim_read_start(125000, 0.5);
         FURI_LOG_D(TAG, "Start ASK");
         if(worker->read_cb) {
@@ -120,7 +121,7 @@ static LFRFIDWorkerReadState lfrfid_worker_read_internal(
         }
     } else {
         furi_hal_rfid_tim_read_start(62500, 0.25);
-        FURI_LOG_D(TAG, "Start PSK");
+        FURI_LOG_D(TAG, "Start %s", (feature & LFRFIDFeatureASK) ? "ASK+PSK" : "PSK");
         if(worker->read_cb) {
             worker->read_cb(LFRFIDWorkerReadStartPSK, PROTOCOL_NO, worker->cb_ctx);
         }
@@ -349,6 +350,10 @@ static void lfrfid_worker_mode_read_process(LFRFIDWorker* worker) {
 
     if(worker->read_type == LFRFIDWorkerReadTypePSKOnly) {
         feature = LFRFIDFeaturePSK;
+    } else if(worker->read_type == LFRFIDWorkerReadTypeExperimentalParallel) {
+        // Single capture feeds every decoder, no waiting for the other modulation window
+        FURI_LOG_W(TAG, "Experimental parallel read: ASK on PSK carrier is not verified");
+        feature = LFRFIDFeatureASK | LFRFIDFeaturePSK;
     } else {
         feature = LFRFIDFeatureASK;
     }
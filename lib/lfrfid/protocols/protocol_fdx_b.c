@@ -3,6 +3,7 @@
 #include "protocol_fdx_b.h"
 #include <toolbox/manchester_decoder.h>
 #include <bit_lib/bit_lib.h>
+#include <bit_lib/bit_lib_stream.h>
 #include "lfrfid_protocols.h"
 #include <furi_hal_rtc.h>
 
@@ -23,20 +24,34 @@
 #define FDX_B_LONG_TIME_LOW   (FDX_B_LONG_TIME - FDX_B_JITTER_TIME)
 #define FDX_B_LONG_TIME_HIGH  (FDX_B_LONG_TIME + FDX_B_JITTER_TIME)
 
+#define FDX_B_PREAMBLE (0b10000000000)
+
+static const BitLibStreamPattern protocol_fdx_b_patterns[] = {
+    {.position = 0, .length = FDX_B_PREAMBLE_BIT_SIZE, .value = FDX_B_PREAMBLE},
+    {.position = FDX_B_ENCODED_BIT_SIZE,
+     .length = FDX_B_PREAMBLE_BIT_SIZE,
+     .value = FDX_B_PREAMBLE},
+};
+
 typedef struct {
     bool last_short;
     bool last_level;
     size_t encoded_index;
     uint8_t encoded_data[FDX_B_ENCODED_BYTE_FULL_SIZE];
+    BitLibStream* encoded_stream;
     uint8_t data[FDXB_DECODED_DATA_SIZE];
 } ProtocolFDXB;
 
 ProtocolFDXB* protocol_fdx_b_alloc(void) {
     ProtocolFDXB* protocol = malloc(sizeof(ProtocolFDXB));
+    protocol->encoded_stream = bit_lib_stream_alloc(FDX_B_ENCODED_BYTE_FULL_SIZE * 8);
+    bit_lib_stream_set_patterns(
+        protocol->encoded_stream, protocol_fdx_b_patterns, COUNT_OF(protocol_fdx_b_patterns));
     return protocol;
 }
 
 void protocol_fdx_b_free(ProtocolFDXB* protocol) {
+    bit_lib_stream_free(protocol->encoded_stream);
     free(protocol);
 }
 
@@ -46,6 +61,7 @@ uint8_t* protocol_fdx_b_get_data(ProtocolFDXB* proto) {
 
 void protocol_fdx_b_decoder_start(ProtocolFDXB* protocol) {
     memset(protocol->encoded_data, 0, FDX_B_ENCODED_BYTE_FULL_SIZE);
+    bit_lib_stream_reset(protocol->encoded_stream);
     protocol->last_short = false;
 }
 
@@ -149,21 +165,19 @@ bool protocol_fdx_b_decoder_feed(ProtocolFDXB* protocol, bool level, uint32_t du
     bool result = false;
     UNUSED(level);
 
-    bool pushed = false;
+    bool matched = false;
 
     // Bi-Phase Manchester decoding
     if(duration >= FDX_B_SHORT_TIME_LOW && duration <= FDX_B_SHORT_TIME_HIGH) {
         if(protocol->last_short == false) {
             protocol->last_short = true;
         } else {
-            pushed = true;
-            bit_lib_push_bit(protocol->encoded_data, FDX_B_ENCODED_BYTE_FULL_SIZE, false);
+            matched = bit_lib_stream_push(protocol->encoded_stream, false);
             protocol->last_short = false;
         }
     } else if(duration >= FDX_B_LONG_TIME_LOW && duration <= FDX_B_LONG_TIME_HIGH) {
         if(protocol->last_short == false) {
-            pushed = true;
-            bit_lib_push_bit(protocol->encoded_data, FDX_B_ENCODED_BYTE_FULL_SIZE, true);
+            matched = bit_lib_stream_push(protocol->encoded_stream, true);
         } else {
             // reset
             protocol->last_short = false;
@@ -173,9 +187,14 @@ bool protocol_fdx_b_decoder_feed(ProtocolFDXB* protocol, bool level, uint32_t du
         protocol->last_short = false;
     }
 
-    if(pushed && protocol_fdx_b_can_be_decoded(protocol)) {
-        protocol_fdx_b_decode(protocol);
-        result = true;
+    // Both preambles matched, control bits and checksum are checked on a linear copy
+    if(matched) {
+        bit_lib_stream_read(
+            protocol->encoded_stream, protocol->encoded_data, FDX_B_ENCODED_BYTE_FULL_SIZE);
+        if(protocol_fdx_b_can_be_decoded(protocol)) {
+            protocol_fdx_b_decode(protocol);
+            result = true;
+        }
     }
 
     return result;
@@ -4,6 +4,7 @@
 #include <lfrfid/tools/fsk_osc.h>
 #include "lfrfid_protocols.h"
 #include <bit_lib/bit_lib.h>
+#include <bit_lib/bit_lib_stream.h>
 
 #define JITTER_TIME (20)
 #define MIN_TIME    (64 - JITTER_TIME)
@@ -19,8 +20,14 @@
 
 #define HID_PREAMBLE 0x1D
 
+static const BitLibStreamPattern protocol_hid_ex_generic_patterns[] = {
+    {.position = 0, .length = 8, .value = HID_PREAMBLE},
+    {.position = (HID_PREAMBLE_SIZE + HID_DATA_SIZE) * 8, .length = 8, .value = HID_PREAMBLE},
+};
+
 typedef struct {
     FSKDemod* fsk_demod;
+    BitLibStream* stream;
 } ProtocolHIDExDecoder;
 
 typedef struct {
@@ -40,6 +47,11 @@ typedef struct {
 ProtocolHIDEx* protocol_hid_ex_generic_alloc(void) {
     ProtocolHIDEx* protocol = malloc(sizeof(ProtocolHIDEx));
     protocol->decoder.fsk_demod = fsk_demod_alloc(MIN_TIME, 6, MAX_TIME, 5);
+    protocol->decoder.stream = bit_lib_stream_alloc(HID_ENCODED_DATA_SIZE * 8);
+    bit_lib_stream_set_patterns(
+        protocol->decoder.stream,
+        protocol_hid_ex_generic_patterns,
+        COUNT_OF(protocol_hid_ex_generic_patterns));
     protocol->encoder.fsk_osc = fsk_osc_alloc(8, 10, 50);
 
     return protocol;
@@ -47,6 +59,7 @@ ProtocolHIDEx* protocol_hid_ex_generic_alloc(void) {
 
 void protocol_hid_ex_generic_free(ProtocolHIDEx* protocol) {
     fsk_demod_free(protocol->decoder.fsk_demod);
+    bit_lib_stream_free(protocol->decoder.stream);
     fsk_osc_free(protocol->encoder.fsk_osc);
     free(protocol);
 }
@@ -57,6 +70,7 @@ uint8_t* protocol_hid_ex_generic_get_data(ProtocolHIDEx* protocol) {
 
 void protocol_hid_ex_generic_decoder_start(ProtocolHIDEx* protocol) {
     memset(protocol->encoded_data, 0, HID_ENCODED_DATA_SIZE);
+    bit_lib_stream_reset(protocol->decoder.stream);
 }
 
 static bool protocol_hid_ex_generic_can_be_decoded(const uint8_t* data) {
@@ -101,7 +115,10 @@ bool protocol_hid_ex_generic_decoder_feed(ProtocolHIDEx* protocol, bool level, u
     fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     if(count > 0) {
         for(size_t i = 0; i < count; i++) {
-            bit_lib_push_bit(protocol->encoded_data, HID_ENCODED_DATA_SIZE, value);
+            // Both preambles are matched by stream, the rest is checked on candidates only
+            if(!bit_lib_stream_push(protocol->decoder.stream, value)) continue;
+            bit_lib_stream_read(
+                protocol->decoder.stream, protocol->encoded_data, HID_ENCODED_DATA_SIZE);
             if(protocol_hid_ex_generic_can_be_decoded(protocol->encoded_data)) {
                 protocol_hid_ex_generic_decode(protocol->encoded_data, protocol->data);
                 result = true;
@@ -1,6 +1,7 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
 #include <bit_lib/bit_lib.h>
+#include <bit_lib/bit_lib_stream.h>
 #include "lfrfid_protocols.h"
 
 #define INDALA26_PREAMBLE_BIT_SIZE  (33)
@@ -17,6 +18,15 @@
 #define INDALA26_US_PER_BIT             (255)
 #define INDALA26_ENCODER_PULSES_PER_BIT (16)
 
+// Preamble 10100000 00000000 00000000 00000000 1, repeated in the next frame
+static const BitLibStreamPattern protocol_indala26_patterns[] = {
+    {.position = INDALA26_ENCODED_BIT_SIZE, .length = 32, .value = 0xA0000000},
+    {.position = INDALA26_ENCODED_BIT_SIZE + 32, .length = 1, .value = 1},
+    {.position = 0, .length = 32, .value = 0xA0000000},
+    {.position = 32, .length = 1, .value = 1},
+    {.position = 60, .length = 2, .value = 0},
+};
+
 typedef struct {
     uint8_t data_index;
     uint8_t bit_clock_index;
@@ -27,20 +37,36 @@ typedef struct {
 
 typedef struct {
     uint8_t encoded_data[INDALA26_ENCODED_DATA_SIZE];
-    uint8_t negative_encoded_data[INDALA26_ENCODED_DATA_SIZE];
-    uint8_t corrupted_encoded_data[INDALA26_ENCODED_DATA_SIZE];
-    uint8_t corrupted_negative_encoded_data[INDALA26_ENCODED_DATA_SIZE];
+    BitLibStream* encoded_stream;
+    BitLibStream* negative_encoded_stream;
+    BitLibStream* corrupted_encoded_stream;
+    BitLibStream* corrupted_negative_encoded_stream;
 
     uint8_t data[INDALA26_DECODED_DATA_SIZE];
     ProtocolIndalaEncoder encoder;
 } ProtocolIndala;
 
+static BitLibStream* protocol_indala26_stream_alloc(void) {
+    BitLibStream* stream = bit_lib_stream_alloc(INDALA26_ENCODED_DATA_SIZE * 8);
+    bit_lib_stream_set_patterns(
+        stream, protocol_indala26_patterns, COUNT_OF(protocol_indala26_patterns));
+    return stream;
+}
+
 ProtocolIndala* protocol_indala26_alloc(void) {
     ProtocolIndala* protocol = malloc(sizeof(ProtocolIndala));
+    protocol->encoded_stream = protocol_indala26_stream_alloc();
+    protocol->negative_encoded_stream = protocol_indala26_stream_alloc();
+    protocol->corrupted_encoded_stream = protocol_indala26_stream_alloc();
+    protocol->corrupted_negative_encoded_stream = protocol_indala26_stream_alloc();
     return protocol;
 }
 
 void protocol_indala26_free(ProtocolIndala* protocol) {
+    bit_lib_stream_free(protocol->encoded_stream);
+    bit_lib_stream_free(protocol->negative_encoded_stream);
+    bit_lib_stream_free(protocol->corrupted_encoded_stream);
+    bit_lib_stream_free(protocol->corrupted_negative_encoded_stream);
     free(protocol);
 }
 
@@ -50,36 +76,23 @@ uint8_t* protocol_indala26_get_data(ProtocolIndala* protocol) {
 
 void protocol_indala26_decoder_start(ProtocolIndala* protocol) {
     memset(protocol->encoded_data, 0, INDALA26_ENCODED_DATA_SIZE);
-    memset(protocol->negative_encoded_data, 0, INDALA26_ENCODED_DATA_SIZE);
-    memset(protocol->corrupted_encoded_data, 0, INDALA26_ENCODED_DATA_SIZE);
-    memset(protocol->corrupted_negative_encoded_data, 0, INDALA26_ENCODED_DATA_SIZE);
+    bit_lib_stream_reset(protocol->encoded_stream);
+    bit_lib_stream_reset(protocol->negative_encoded_stream);
+    bit_lib_stream_reset(protocol->corrupted_encoded_stream);
+    bit_lib_stream_reset(protocol->corrupted_negative_encoded_stream);
 }
 
-static bool protocol_indala26_check_preamble(uint8_t* data, size_t bit_index) {
-    // Preamble 10100000 00000000 00000000 00000000 1
-    if(*(uint32_t*)&data[bit_index / 8] != 0b00000000000000000000000010100000) return false;
-    if(bit_lib_get_bit(data, bit_index + 32) != 1) return false;
-    return true;
-}
-
-static bool protocol_indala26_can_be_decoded(uint8_t* data) {
-    if(!protocol_indala26_check_preamble(data, 0)) return false;
-    if(!protocol_indala26_check_preamble(data, 64)) return false;
-    if(bit_lib_get_bit(data, 61) != 0) return false;
-    if(bit_lib_get_bit(data, 60) != 0) return false;
-    return true;
-}
-
-static bool protocol_indala26_decoder_feed_internal(bool polarity, uint32_t time, uint8_t* data) {
+static bool
+    protocol_indala26_decoder_feed_internal(bool polarity, uint32_t time, BitLibStream* stream) {
     time += (INDALA26_US_PER_BIT / 2);
 
     size_t bit_count = (time / INDALA26_US_PER_BIT);
     bool result = false;
 
+    // Stream patterns cover both preambles and fixed bits, so a match is a complete frame
     if(bit_count < INDALA26_ENCODED_BIT_SIZE) {
         for(size_t i = 0; i < bit_count; i++) {
-            bit_lib_push_bit(data, INDALA26_ENCODED_DATA_SIZE, polarity);
-            if(protocol_indala26_can_be_decoded(data)) {
+            if(bit_lib_stream_push(stream, polarity)) {
                 result = true;
                 break;
             }
@@ -89,26 +102,29 @@ static bool protocol_indala26_decoder_feed_internal(bool polarity, uint32_t time
     return result;
 }
 
-static void protocol_indala26_decoder_save(uint8_t* data_to, const uint8_t* data_from) {
-    bit_lib_copy_bits(data_to, 0, 22, data_from, 33);
-    bit_lib_copy_bits(data_to, 22, 5, data_from, 55);
-    bit_lib_copy_bits(data_to, 27, 2, data_from, 62);
+static void protocol_indala26_decoder_save(ProtocolIndala* protocol, const BitLibStream* stream) {
+    uint8_t* data_from = protocol->encoded_data;
+    bit_lib_stream_read(stream, data_from, INDALA26_ENCODED_DATA_SIZE);
+
+    bit_lib_copy_bits(protocol->data, 0, 22, data_from, 33);
+    bit_lib_copy_bits(protocol->data, 22, 5, data_from, 55);
+    bit_lib_copy_bits(protocol->data, 27, 2, data_from, 62);
 }
 
 bool protocol_indala26_decoder_feed(ProtocolIndala* protocol, bool level, uint32_t duration) {
     bool result = false;
 
     if(duration > (INDALA26_US_PER_BIT / 2)) {
-        if(protocol_indala26_decoder_feed_internal(level, duration, protocol->encoded_data)) {
-            protocol_indala26_decoder_save(protocol->data, protocol->encoded_data);
+        if(protocol_indala26_decoder_feed_internal(level, duration, protocol->encoded_stream)) {
+            protocol_indala26_decoder_save(protocol, protocol->encoded_stream);
             FURI_LOG_D("Indala26", "Positive");
             result = true;
             return result;
         }
 
         if(protocol_indala26_decoder_feed_internal(
-               !level, duration, protocol->negative_encoded_data)) {
-            protocol_indala26_decoder_save(protocol->data, protocol->negative_encoded_data);
+               !level, duration, protocol->negative_encoded_stream)) {
+            protocol_indala26_decoder_save(protocol, protocol->negative_encoded_stream);
             FURI_LOG_D("Indala26", "Negative");
             result = true;
             return result;
@@ -126,8 +142,8 @@ bool protocol_indala26_decoder_feed(ProtocolIndala* protocol, bool level, uint32
         }
 
         if(protocol_indala26_decoder_feed_internal(
-               level, duration, protocol->corrupted_encoded_data)) {
-            protocol_indala26_decoder_save(protocol->data, protocol->corrupted_encoded_data);
+               level, duration, protocol->corrupted_encoded_stream)) {
+            protocol_indala26_decoder_save(protocol, protocol->corrupted_encoded_stream);
             FURI_LOG_D("Indala26", "Positive Corrupted");
 
             result = true;
@@ -135,9 +151,9 @@ bool protocol_indala26_decoder_feed(ProtocolIndala* protocol, bool level, uint32
         }
 
         if(protocol_indala26_decoder_feed_internal(
-               !level, duration, protocol->corrupted_negative_encoded_data)) {
+               !level, duration, protocol->corrupted_negative_encoded_stream)) {
             protocol_indala26_decoder_save(
-                protocol->data, protocol->corrupted_negative_encoded_data);
+                protocol, protocol->corrupted_negative_encoded_stream);
             FURI_LOG_D("Indala26", "Negative Corrupted");
 
             result = true;
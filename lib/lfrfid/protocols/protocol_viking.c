@@ -2,6 +2,7 @@
 #include <toolbox/protocols/protocol.h>
 #include <toolbox/manchester_decoder.h>
 #include <bit_lib/bit_lib.h>
+#include <bit_lib/bit_lib_stream.h>
 #include "lfrfid_protocols.h"
 
 #define VIKING_CLOCK_PER_BIT (32)
@@ -22,9 +23,19 @@
 #define VIKING_READ_LONG_TIME_LOW   (VIKING_READ_LONG_TIME - VIKING_READ_JITTER_TIME)
 #define VIKING_READ_LONG_TIME_HIGH  (VIKING_READ_LONG_TIME + VIKING_READ_JITTER_TIME)
 
+#define VIKING_PREAMBLE (0xF20000)
+
+static const BitLibStreamPattern protocol_viking_patterns[] = {
+    {.position = 0, .length = VIKING_PREAMBLE_BIT_SIZE, .value = VIKING_PREAMBLE},
+    {.position = VIKING_ENCODED_BIT_SIZE,
+     .length = VIKING_PREAMBLE_BIT_SIZE,
+     .value = VIKING_PREAMBLE},
+};
+
 typedef struct {
     uint8_t data[VIKING_DECODED_DATA_SIZE];
     uint8_t encoded_data[VIKING_ENCODED_BYTE_FULL_SIZE];
+    BitLibStream* encoded_stream;
 
     uint8_t encoded_data_index;
     bool encoded_polarity;
@@ -34,10 +45,14 @@ typedef struct {
 
 ProtocolViking* protocol_viking_alloc(void) {
     ProtocolViking* proto = malloc(sizeof(ProtocolViking));
+    proto->encoded_stream = bit_lib_stream_alloc(VIKING_ENCODED_BYTE_FULL_SIZE * 8);
+    bit_lib_stream_set_patterns(
+        proto->encoded_stream, protocol_viking_patterns, COUNT_OF(protocol_viking_patterns));
     return (void*)proto;
 }
 
 void protocol_viking_free(ProtocolViking* protocol) {
+    bit_lib_stream_free(protocol->encoded_stream);
     free(protocol);
 }
 
@@ -75,6 +90,7 @@ static bool protocol_viking_can_be_decoded(ProtocolViking* protocol) {
 
 void protocol_viking_decoder_start(ProtocolViking* protocol) {
     memset(protocol->encoded_data, 0, VIKING_ENCODED_BYTE_FULL_SIZE);
+    bit_lib_stream_reset(protocol->encoded_stream);
     manchester_advance(
         protocol->decoder_manchester_state,
         ManchesterEventReset,
@@ -106,8 +122,10 @@ bool protocol_viking_decoder_feed(ProtocolViking* protocol, bool level, uint32_t
         bool data_ok = manchester_advance(
             protocol->decoder_manchester_state, event, &protocol->decoder_manchester_state, &data);
 
-        if(data_ok) {
-            bit_lib_push_bit(protocol->encoded_data, VIKING_ENCODED_BYTE_FULL_SIZE, data);
+        // Checksum is verified only when both preambles are in place
+        if(data_ok && bit_lib_stream_push(protocol->encoded_stream, data)) {
+            bit_lib_stream_read(
+                protocol->encoded_stream, protocol->encoded_data, VIKING_ENCODED_BYTE_FULL_SIZE);
 
             if(protocol_viking_can_be_decoded(protocol)) {
                 protocol_viking_decode(protocol);
@@ -88,6 +88,9 @@ struct mjs {
     struct gc_arena object_arena;
     struct gc_arena property_arena;
     struct gc_arena ffi_sig_arena;
+    struct mjs_gc_stats gc_stats;
+    mjs_gc_clock_t gc_clock;
+    uint32_t gc_clock_ticks_per_us;
 
     unsigned inhibit_gc : 1;
     unsigned need_gc : 1;
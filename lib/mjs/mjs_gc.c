@@ -37,6 +37,19 @@
  */
 #define GC_ARENA_CELLS_RESERVE 2
 
+/*
+ * When a collection leaves an arena with less than 1/GC_ARENA_GROW_DIVIDER of
+ * its increment size free, a new block is added right away. Otherwise a mostly
+ * live heap would be collected again after just a few allocations.
+ */
+#define GC_ARENA_GROW_DIVIDER 2
+
+/*
+ * Strings buffer that is still above the GC threshold after a collection is
+ * doubled, but never grown by more than this many bytes at once.
+ */
+#define GC_STRINGS_GROW_MAX 2048
+
 static struct gc_block* gc_new_block(struct gc_arena* a, size_t size);
 static void gc_free_block(struct gc_block* b);
 static void gc_mark_mbuf_pt(struct mjs* mjs, const struct mbuf* mbuf);
@@ -165,14 +178,18 @@ MJS_PRIVATE void* gc_alloc_cell(struct mjs* mjs, struct gc_arena* a) {
  *
  * Empty blocks get deallocated. The head of the free list will contais cells
  * from the last (oldest) block. Cells will thus be allocated in block order.
+ *
+ * Returns the number of cells in the rebuilt free list.
  */
-void gc_sweep(struct mjs* mjs, struct gc_arena* a, size_t start) {
+size_t gc_sweep(struct mjs* mjs, struct gc_arena* a, size_t start) {
     struct gc_block* b;
     struct gc_cell* cur;
     struct gc_block** prevp = &a->blocks;
+    size_t free_cells = 0;
 #if MJS_MEMORY_STATS
     a->alive = 0;
 #endif
+    a->blocks_freed = 0;
 
     /*
    * Before we sweep, we should mark all free cells in a way that is
@@ -227,6 +244,8 @@ void gc_sweep(struct mjs* mjs, struct gc_arena* a, size_t start) {
                         a->destructor(mjs, cur);
                     }
                     memset(cur, 0, a->cell_size);
+                    mjs->gc_stats.cells_reclaimed++;
+                    mjs->gc_stats.bytes_reclaimed += a->cell_size;
                 }
 
                 /* Add this cell to the `free` list */
@@ -249,11 +268,36 @@ void gc_sweep(struct mjs* mjs, struct gc_arena* a, size_t start) {
             gc_free_block(b);
             b = *prevp;
             a->free = prev_free;
+            a->blocks_freed++;
         } else {
+            free_cells += freed_in_block;
             prevp = &b->next;
             b = b->next;
         }
     }
+
+    return free_cells;
+}
+
+/*
+ * Adds a new block to the arena if the collection left too few free cells in
+ * it. Returns 1 if the arena was grown.
+ *
+ * An arena whose sweep has just released an empty block is not grown: the
+ * heap would otherwise free and allocate a block on every collection.
+ */
+static int gc_arena_reserve(struct gc_arena* a, size_t free_cells) {
+    struct gc_block* b;
+
+    if(a->blocks_freed > 0 || free_cells > a->size_increment / GC_ARENA_GROW_DIVIDER) {
+        return 0;
+    }
+
+    b = gc_new_block(a, a->size_increment);
+    b->next = a->blocks;
+    a->blocks = b;
+
+    return 1;
 }
 
 /* Mark an FFI signature */
@@ -483,8 +527,45 @@ static void gc_mark_ffi_cbargs_list(struct mjs* mjs, ffi_cb_args_t* cbargs) {
     }
 }
 
+static uint32_t gc_pause_start(struct mjs* mjs) {
+    return mjs->gc_clock ? mjs->gc_clock() : 0;
+}
+
+static void gc_pause_end(struct mjs* mjs, uint32_t start) {
+    static const uint32_t bucket_limits_us[MJS_GC_PAUSE_HISTOGRAM_SIZE - 1] = {
+        1000,
+        2000,
+        5000,
+        10000,
+        20000,
+    };
+    struct mjs_gc_stats* stats = &mjs->gc_stats;
+    uint32_t pause_us = 0;
+    size_t bucket = 0;
+
+    if(mjs->gc_clock) {
+        pause_us = (mjs->gc_clock() - start) / mjs->gc_clock_ticks_per_us;
+    }
+
+    while(bucket < MJS_GC_PAUSE_HISTOGRAM_SIZE - 1 && pause_us >= bucket_limits_us[bucket]) {
+        bucket++;
+    }
+
+    stats->collections++;
+    stats->pause_last_us = pause_us;
+    stats->pause_total_us += pause_us;
+    stats->pause_histogram[bucket]++;
+    if(pause_us > stats->pause_max_us) {
+        stats->pause_max_us = pause_us;
+    }
+}
+
 /* Perform garbage collection */
 void mjs_gc(struct mjs* mjs, int full) {
+    uint32_t pause_start = gc_pause_start(mjs);
+    size_t strings_len = mjs->owned_strings.len;
+    size_t free_objects, free_properties, free_ffi_sigs;
+
     gc_mark_val_array(mjs, (mjs_val_t*)&mjs->vals, sizeof(mjs->vals) / sizeof(mjs_val_t));
 
     gc_mark_mbuf_pt(mjs, &mjs->owned_values);
@@ -495,22 +576,50 @@ void mjs_gc(struct mjs* mjs, int full) {
     gc_mark_ffi_cbargs_list(mjs, mjs->ffi_cb_args);
 
     gc_compact_strings(mjs);
+    mjs->gc_stats.bytes_reclaimed += strings_len - mjs->owned_strings.len;
 
-    gc_sweep(mjs, &mjs->object_arena, 0);
-    gc_sweep(mjs, &mjs->property_arena, 0);
-    gc_sweep(mjs, &mjs->ffi_sig_arena, 0);
+    free_objects = gc_sweep(mjs, &mjs->object_arena, 0);
+    free_properties = gc_sweep(mjs, &mjs->property_arena, 0);
+    free_ffi_sigs = gc_sweep(mjs, &mjs->ffi_sig_arena, 0);
 
     if(full) {
         /*
-     * In case of full GC, we also resize strings buffer, but we still leave
-     * some extra space (at most, `_MJS_STRING_BUF_RESERVE`) in order to avoid
-     * frequent reallocations
-     */
+         * In case of full GC, we also resize strings buffer, but we still leave
+         * some extra space (at most, `_MJS_STRING_BUF_RESERVE`) in order to avoid
+         * frequent reallocations
+         */
         size_t trimmed_size = mjs->owned_strings.len + _MJS_STRING_BUF_RESERVE;
         if(trimmed_size < mjs->owned_strings.size) {
             mbuf_resize(&mjs->owned_strings, trimmed_size);
         }
+    } else {
+        /*
+         * Keep enough headroom after the collection, so that neither the arenas
+         * nor the strings buffer schedule another one right away.
+         */
+        mjs->gc_stats.arena_grows += gc_arena_reserve(&mjs->object_arena, free_objects);
+        mjs->gc_stats.arena_grows += gc_arena_reserve(&mjs->property_arena, free_properties);
+        mjs->gc_stats.arena_grows += gc_arena_reserve(&mjs->ffi_sig_arena, free_ffi_sigs);
+
+        if(gc_strings_is_gc_needed(mjs)) {
+            size_t grow = mjs->owned_strings.size;
+            if(grow > GC_STRINGS_GROW_MAX) {
+                grow = GC_STRINGS_GROW_MAX;
+            }
+            mbuf_resize(&mjs->owned_strings, mjs->owned_strings.size + grow);
+        }
     }
+
+    gc_pause_end(mjs, pause_start);
+}
+
+void mjs_gc_set_clock(struct mjs* mjs, mjs_gc_clock_t clock, uint32_t ticks_per_us) {
+    mjs->gc_clock = ticks_per_us ? clock : NULL;
+    mjs->gc_clock_ticks_per_us = ticks_per_us;
+}
+
+void mjs_gc_get_stats(struct mjs* mjs, struct mjs_gc_stats* stats) {
+    *stats = mjs->gc_stats;
 }
 
 MJS_PRIVATE int gc_check_val(struct mjs* mjs, mjs_val_t v) {
@@ -12,12 +12,48 @@
 extern "C" {
 #endif /* __cplusplus */
 
+/*
+ * Number of buckets in `mjs_gc_stats.pause_histogram`. Bucket upper bounds
+ * are 1, 2, 5, 10 and 20 ms, the last bucket collects everything longer.
+ */
+#define MJS_GC_PAUSE_HISTOGRAM_SIZE 6
+
+/*
+ * Garbage collector statistics, accumulated since the instance was created.
+ */
+struct mjs_gc_stats {
+    uint32_t collections; /* Number of collections performed */
+    uint32_t pause_last_us; /* Duration of the last collection */
+    uint32_t pause_max_us; /* Longest collection so far */
+    uint32_t pause_total_us; /* Total time spent collecting */
+    uint32_t pause_histogram[MJS_GC_PAUSE_HISTOGRAM_SIZE];
+    uint32_t cells_reclaimed; /* Objects, properties and FFI signatures */
+    uint32_t bytes_reclaimed; /* Cell and string bytes given back */
+    uint32_t arena_grows; /* Arena blocks added ahead of time after a GC */
+};
+
+/*
+ * Free running clock used to time collections. Wraps around at 2^32 ticks.
+ */
+typedef uint32_t (*mjs_gc_clock_t)(void);
+
 /*
  * Perform garbage collection.
  * Pass true to full in order to reclaim unused heap back to the OS.
  */
 void mjs_gc(struct mjs* mjs, int full);
 
+/*
+ * Set the clock used for pause statistics. Without a clock, pauses are
+ * reported as zero.
+ */
+void mjs_gc_set_clock(struct mjs* mjs, mjs_gc_clock_t clock, uint32_t ticks_per_us);
+
+/*
+ * Copy garbage collector statistics into `stats`.
+ */
+void mjs_gc_get_stats(struct mjs* mjs, struct mjs_gc_stats* stats);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
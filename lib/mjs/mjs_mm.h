@@ -27,6 +27,7 @@ struct gc_arena {
     size_t size_increment;
     struct gc_cell* free; /* head of free list */
     size_t cell_size;
+    size_t blocks_freed; /* empty blocks released by the last sweep */
 
 #if MJS_MEMORY_STATS
     unsigned long allocations; /* cumulative counter of allocations */
@@ -0,0 +1,18 @@
+#include "mf_classic_dict_attack_stage.h"
+
+#include <furi.h>
+
+MfClassicDictAttackStage mf_classic_dict_attack_stage_enter(
+    MfClassicDictAttackStage stage,
+    MfClassicDictAttackStagePrepareCallback callback,
+    void* context) {
+    furi_check(stage <= MfClassicDictAttackStageSystemDict);
+    furi_check(callback);
+
+    while(!callback(stage, context)) {
+        if(stage == MfClassicDictAttackStageSystemDict) break;
+        stage++;
+    }
+
+    return stage;
+}
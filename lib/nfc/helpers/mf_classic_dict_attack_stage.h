@@ -0,0 +1,54 @@
+/**
+ * @file mf_classic_dict_attack_stage.h
+ * @brief MIFARE Classic dictionary attack stages
+ *
+ * A dictionary attack tries key sources one after another, cheapest and
+ * most likely first. A stage without keys to try is skipped, so the order
+ * in which stages are entered lives here rather than in every user.
+ */
+#pragma once
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    MfClassicDictAttackStageKeyIndex, /**< keys seen on cards of the same family */
+    MfClassicDictAttackStageCuidDict, /**< dictionary made for this card UID */
+    MfClassicDictAttackStageKeyIndexRequery, /**< key index, with the keys found so far */
+    MfClassicDictAttackStageUserDict, /**< user dictionary */
+    MfClassicDictAttackStageSystemDict, /**< system dictionary, always tried last */
+} MfClassicDictAttackStage;
+
+/** Prepare keys of the stage
+ *
+ * @param      stage    stage to prepare
+ * @param      context  callback context
+ *
+ * @return     true if the stage has keys to try
+ */
+typedef bool (*MfClassicDictAttackStagePrepareCallback)(
+    MfClassicDictAttackStage stage,
+    void* context);
+
+/** Enter the first stage with keys, starting from the given one
+ *
+ * Stages are prepared in order until one has keys to try. The system
+ * dictionary stage is entered even if it has none.
+ *
+ * @param      stage     first stage to prepare
+ * @param      callback  prepare callback
+ * @param      context   callback context
+ *
+ * @return     entered stage
+ */
+MfClassicDictAttackStage mf_classic_dict_attack_stage_enter(
+    MfClassicDictAttackStage stage,
+    MfClassicDictAttackStagePrepareCallback callback,
+    void* context);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,484 @@
+#include "mf_classic_key_index.h"
+
+#include <furi.h>
+#include <storage/storage.h>
+
+#define TAG "MfClassicKeyIndex"
+
+#define MF_CLASSIC_KEY_INDEX_MAGIC   (0x5849464DUL)
+#define MF_CLASSIC_KEY_INDEX_VERSION (2)
+
+#define MF_CLASSIC_KEY_INDEX_FINGERPRINT_NUM  (3)
+#define MF_CLASSIC_KEY_INDEX_KIND_SHIFT       (30)
+#define MF_CLASSIC_KEY_INDEX_CARD_KEYS_MAX    (MF_CLASSIC_TOTAL_SECTORS_MAX * 2)
+#define MF_CLASSIC_KEY_INDEX_CARDS_MAX        (128)
+#define MF_CLASSIC_KEY_INDEX_FNV_OFFSET_BASIS (2166136261UL)
+#define MF_CLASSIC_KEY_INDEX_FNV_PRIME        (16777619UL)
+
+typedef enum {
+    MfClassicKeyIndexKindFamily,
+    MfClassicKeyIndexKindManufacturer,
+    MfClassicKeyIndexKindKey,
+} MfClassicKeyIndexKind;
+
+// More specific fingerprints weigh more in key ranking
+static const uint8_t mf_classic_key_index_weight[] = {
+    [MfClassicKeyIndexKindFamily] = 1,
+    [MfClassicKeyIndexKindManufacturer] = 4,
+    [MfClassicKeyIndexKindKey] = 2,
+};
+
+typedef struct {
+    uint32_t fingerprint;
+    uint16_t count;
+    MfClassicKey key;
+} MfClassicKeyIndexEntry;
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t entry_size;
+    uint32_t count;
+    uint32_t card_count;
+    MfClassicKeyIndexStats stats;
+} FURI_PACKED MfClassicKeyIndexHeader;
+
+typedef struct {
+    MfClassicKey key;
+    uint32_t score;
+} MfClassicKeyIndexCandidate;
+
+struct MfClassicKeyIndex {
+    MfClassicKeyIndexEntry* entries;
+    size_t count;
+    size_t capacity;
+    // UID hashes of added cards, oldest first
+    uint32_t cards[MF_CLASSIC_KEY_INDEX_CARDS_MAX];
+    size_t card_count;
+    MfClassicKeyIndexStats stats;
+};
+
+MfClassicKeyIndex* mf_classic_key_index_alloc(size_t capacity) {
+    furi_check(capacity > 0);
+
+    MfClassicKeyIndex* instance = malloc(sizeof(MfClassicKeyIndex));
+    instance->entries = malloc(capacity * sizeof(MfClassicKeyIndexEntry));
+    instance->capacity = capacity;
+
+    return instance;
+}
+
+void mf_classic_key_index_free(MfClassicKeyIndex* instance) {
+    furi_check(instance);
+
+    free(instance->entries);
+    free(instance);
+}
+
+void mf_classic_key_index_reset(MfClassicKeyIndex* instance) {
+    furi_check(instance);
+
+    instance->count = 0;
+    instance->card_count = 0;
+    memset(&instance->stats, 0, sizeof(MfClassicKeyIndexStats));
+}
+
+static uint32_t mf_classic_key_index_get_hash(const uint8_t* data, size_t data_size) {
+    uint32_t hash = MF_CLASSIC_KEY_INDEX_FNV_OFFSET_BASIS;
+    for(size_t i = 0; i < data_size; i++) {
+        hash = (hash ^ data[i]) * MF_CLASSIC_KEY_INDEX_FNV_PRIME;
+    }
+
+    return hash;
+}
+
+static uint32_t mf_classic_key_index_get_fingerprint(
+    MfClassicKeyIndexKind kind,
+    const uint8_t* data,
+    size_t data_size) {
+    const uint32_t hash = mf_classic_key_index_get_hash(data, data_size);
+    const uint32_t hash_mask = (1UL << MF_CLASSIC_KEY_INDEX_KIND_SHIFT) - 1;
+    return ((uint32_t)kind << MF_CLASSIC_KEY_INDEX_KIND_SHIFT) | (hash & hash_mask);
+}
+
+static size_t
+    mf_classic_key_index_get_card_fingerprints(const MfClassicData* data, uint32_t* fingerprints) {
+    size_t count = 0;
+
+    size_t uid_len = 0;
+    mf_classic_get_uid(data, &uid_len);
+    uint8_t family[5] = {data->type, 0, 0, 0, uid_len};
+    iso14443_3a_get_atqa(data->iso14443_3a_data, &family[1]);
+    family[3] = iso14443_3a_get_sak(data->iso14443_3a_data);
+    fingerprints[count++] =
+        mf_classic_key_index_get_fingerprint(MfClassicKeyIndexKindFamily, family, sizeof(family));
+
+    if(mf_classic_is_block_read(data, 0)) {
+        // 4 byte UID is followed by BCC, which only depends on the UID
+        const size_t offset = (uid_len == 4) ? uid_len + 1 : uid_len;
+        fingerprints[count++] = mf_classic_key_index_get_fingerprint(
+            MfClassicKeyIndexKindManufacturer,
+            &data->block[0].data[offset],
+            MF_CLASSIC_BLOCK_SIZE - offset);
+    }
+
+    const uint8_t total_sectors = mf_classic_get_total_sectors_num(data->type);
+    for(uint8_t sector = 0; sector < total_sectors; sector++) {
+        if(!FURI_BIT(data->key_a_mask, sector)) continue;
+
+        const MfClassicSectorTrailer* sec_tr =
+            mf_classic_get_sector_trailer_by_sector(data, sector);
+        uint8_t known_key[1 + sizeof(MfClassicKey)] = {sector};
+        memcpy(&known_key[1], sec_tr->key_a.data, sizeof(MfClassicKey));
+        fingerprints[count++] = mf_classic_key_index_get_fingerprint(
+            MfClassicKeyIndexKindKey, known_key, sizeof(known_key));
+        break;
+    }
+
+    return count;
+}
+
+static bool mf_classic_key_index_is_key_in_list(
+    const MfClassicKey* key,
+    const MfClassicKey* keys,
+    size_t keys_num) {
+    for(size_t i = 0; i < keys_num; i++) {
+        if(memcmp(key->data, keys[i].data, sizeof(MfClassicKey)) == 0) return true;
+    }
+
+    return false;
+}
+
+static size_t mf_classic_key_index_get_card_keys(const MfClassicData* data, MfClassicKey* keys) {
+    size_t count = 0;
+
+    const uint8_t total_sectors = mf_classic_get_total_sectors_num(data->type);
+    for(uint8_t sector = 0; sector < total_sectors; sector++) {
+        const MfClassicSectorTrailer* sec_tr =
+            mf_classic_get_sector_trailer_by_sector(data, sector);
+        if(FURI_BIT(data->key_a_mask, sector) &&
+           !mf_classic_key_index_is_key_in_list(&sec_tr->key_a, keys, count)) {
+            keys[count++] = sec_tr->key_a;
+        }
+        if(FURI_BIT(data->key_b_mask, sector) &&
+           !mf_classic_key_index_is_key_in_list(&sec_tr->key_b, keys, count)) {
+            keys[count++] = sec_tr->key_b;
+        }
+    }
+
+    return count;
+}
+
+static int mf_classic_key_index_compare(
+    const MfClassicKeyIndexEntry* entry,
+    uint32_t fingerprint,
+    const MfClassicKey* key) {
+    if(entry->fingerprint != fingerprint) {
+        return (entry->fingerprint < fingerprint) ? -1 : 1;
+    }
+
+    return memcmp(entry->key.data, key->data, sizeof(MfClassicKey));
+}
+
+static size_t mf_classic_key_index_lower_bound(
+    const MfClassicKeyIndex* instance,
+    uint32_t fingerprint,
+    const MfClassicKey* key) {
+    size_t low = 0;
+    size_t high = instance->count;
+
+    while(low < high) {
+        const size_t middle = low + (high - low) / 2;
+        if(mf_classic_key_index_compare(&instance->entries[middle], fingerprint, key) < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+static void mf_classic_key_index_put(
+    MfClassicKeyIndex* instance,
+    uint32_t fingerprint,
+    const MfClassicKey* key,
+    bool is_new_card) {
+    size_t index = mf_classic_key_index_lower_bound(instance, fingerprint, key);
+    MfClassicKeyIndexEntry* entries = instance->entries;
+
+    if((index < instance->count) &&
+       (mf_classic_key_index_compare(&entries[index], fingerprint, key) == 0)) {
+        if(is_new_card && entries[index].count < UINT16_MAX) entries[index].count++;
+        return;
+    }
+
+    if(instance->count == instance->capacity) {
+        // Drop the least used entry to make room
+        size_t victim = 0;
+        for(size_t i = 1; i < instance->count; i++) {
+            if(entries[i].count < entries[victim].count) victim = i;
+        }
+        memmove(
+            &entries[victim],
+            &entries[victim + 1],
+            (instance->count - victim - 1) * sizeof(MfClassicKeyIndexEntry));
+        instance->count--;
+        if(victim < index) index--;
+    }
+
+    memmove(
+        &entries[index + 1],
+        &entries[index],
+        (instance->count - index) * sizeof(MfClassicKeyIndexEntry));
+    entries[index].fingerprint = fingerprint;
+    entries[index].count = 1;
+    entries[index].key = *key;
+    instance->count++;
+}
+
+static bool mf_classic_key_index_add_card(MfClassicKeyIndex* instance, const MfClassicData* data) {
+    size_t uid_len = 0;
+    const uint8_t* uid = mf_classic_get_uid(data, &uid_len);
+    const uint32_t card = mf_classic_key_index_get_hash(uid, uid_len);
+
+    for(size_t i = 0; i < instance->card_count; i++) {
+        if(instance->cards[i] == card) return false;
+    }
+
+    if(instance->card_count == MF_CLASSIC_KEY_INDEX_CARDS_MAX) {
+        // Forget the oldest card, it is counted again if read again
+        memmove(
+            &instance->cards[0],
+            &instance->cards[1],
+            (instance->card_count - 1) * sizeof(uint32_t));
+        instance->card_count--;
+    }
+    instance->cards[instance->card_count++] = card;
+
+    return true;
+}
+
+bool mf_classic_key_index_add(MfClassicKeyIndex* instance, const MfClassicData* data) {
+    furi_check(instance);
+    furi_check(data);
+
+    // Keys of a card read again are added if new, but not counted twice
+    const bool is_new_card = mf_classic_key_index_add_card(instance, data);
+
+    uint32_t fingerprints[MF_CLASSIC_KEY_INDEX_FINGERPRINT_NUM];
+    const size_t fingerprint_num = mf_classic_key_index_get_card_fingerprints(data, fingerprints);
+
+    MfClassicKey* keys = malloc(MF_CLASSIC_KEY_INDEX_CARD_KEYS_MAX * sizeof(MfClassicKey));
+    const size_t keys_num = mf_classic_key_index_get_card_keys(data, keys);
+
+    for(size_t i = 0; i < fingerprint_num; i++) {
+        for(size_t j = 0; j < keys_num; j++) {
+            mf_classic_key_index_put(instance, fingerprints[i], &keys[j], is_new_card);
+        }
+    }
+
+    free(keys);
+
+    return is_new_card;
+}
+
+static int mf_classic_key_index_candidate_compare(const void* a, const void* b) {
+    const MfClassicKeyIndexCandidate* candidate_a = a;
+    const MfClassicKeyIndexCandidate* candidate_b = b;
+
+    if(candidate_a->score == candidate_b->score) return 0;
+    return (candidate_a->score > candidate_b->score) ? -1 : 1;
+}
+
+size_t mf_classic_key_index_lookup(
+    const MfClassicKeyIndex* instance,
+    const MfClassicData* data,
+    MfClassicKey* keys,
+    size_t keys_max) {
+    furi_check(instance);
+    furi_check(data);
+    furi_check(keys || keys_max == 0);
+
+    uint32_t fingerprints[MF_CLASSIC_KEY_INDEX_FINGERPRINT_NUM];
+    const size_t fingerprint_num = mf_classic_key_index_get_card_fingerprints(data, fingerprints);
+
+    size_t begin[MF_CLASSIC_KEY_INDEX_FINGERPRINT_NUM];
+    size_t end[MF_CLASSIC_KEY_INDEX_FINGERPRINT_NUM];
+    size_t matches_total = 0;
+    const MfClassicKey key_min = {};
+    for(size_t i = 0; i < fingerprint_num; i++) {
+        begin[i] = mf_classic_key_index_lower_bound(instance, fingerprints[i], &key_min);
+        end[i] = begin[i];
+        while((end[i] < instance->count) &&
+              (instance->entries[end[i]].fingerprint == fingerprints[i])) {
+            end[i]++;
+        }
+        matches_total += end[i] - begin[i];
+    }
+    if(matches_total == 0 || keys_max == 0) return 0;
+
+    MfClassicKey* card_keys = malloc(MF_CLASSIC_KEY_INDEX_CARD_KEYS_MAX * sizeof(MfClassicKey));
+    const size_t card_keys_num = mf_classic_key_index_get_card_keys(data, card_keys);
+    MfClassicKeyIndexCandidate* candidates =
+        malloc(matches_total * sizeof(MfClassicKeyIndexCandidate));
+    size_t candidates_num = 0;
+
+    for(size_t i = 0; i < fingerprint_num; i++) {
+        const uint8_t weight =
+            mf_classic_key_index_weight[fingerprints[i] >> MF_CLASSIC_KEY_INDEX_KIND_SHIFT];
+        for(size_t j = begin[i]; j < end[i]; j++) {
+            const MfClassicKeyIndexEntry* entry = &instance->entries[j];
+            if(mf_classic_key_index_is_key_in_list(&entry->key, card_keys, card_keys_num)) {
+                continue;
+            }
+
+            size_t k = 0;
+            while((k < candidates_num) &&
+                  memcmp(candidates[k].key.data, entry->key.data, sizeof(MfClassicKey))) {
+                k++;
+            }
+            if(k == candidates_num) {
+                candidates[k].key = entry->key;
+                candidates[k].score = 0;
+                candidates_num++;
+            }
+            candidates[k].score += weight * entry->count;
+        }
+    }
+
+    qsort(
+        candidates,
+        candidates_num,
+        sizeof(MfClassicKeyIndexCandidate),
+        mf_classic_key_index_candidate_compare);
+
+    const size_t keys_num = MIN(candidates_num, keys_max);
+    for(size_t i = 0; i < keys_num; i++) {
+        keys[i] = candidates[i].key;
+    }
+
+    free(candidates);
+    free(card_keys);
+
+    return keys_num;
+}
+
+size_t mf_classic_key_index_update_stats(
+    MfClassicKeyIndex* instance,
+    const MfClassicKey* keys,
+    size_t keys_num,
+    const MfClassicData* data) {
+    furi_check(instance);
+    furi_check(keys || keys_num == 0);
+    furi_check(data);
+
+    if(keys_num == 0) return 0;
+
+    MfClassicKey* card_keys = malloc(MF_CLASSIC_KEY_INDEX_CARD_KEYS_MAX * sizeof(MfClassicKey));
+    const size_t card_keys_num = mf_classic_key_index_get_card_keys(data, card_keys);
+
+    size_t hits = 0;
+    for(size_t i = 0; i < keys_num; i++) {
+        if(mf_classic_key_index_is_key_in_list(&keys[i], card_keys, card_keys_num)) hits++;
+    }
+    free(card_keys);
+
+    instance->stats.lookups++;
+    instance->stats.suggested += keys_num;
+    instance->stats.hits += hits;
+
+    return hits;
+}
+
+size_t mf_classic_key_index_get_size(const MfClassicKeyIndex* instance) {
+    furi_check(instance);
+
+    return instance->count;
+}
+
+const MfClassicKeyIndexStats* mf_classic_key_index_get_stats(const MfClassicKeyIndex* instance) {
+    furi_check(instance);
+
+    return &instance->stats;
+}
+
+bool mf_classic_key_index_load(MfClassicKeyIndex* instance, const char* path) {
+    furi_check(instance);
+    furi_check(path);
+
+    mf_classic_key_index_reset(instance);
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+
+    bool load_success = false;
+    do {
+        if(!storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) break;
+
+        MfClassicKeyIndexHeader header;
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != MF_CLASSIC_KEY_INDEX_MAGIC) break;
+        if(header.version != MF_CLASSIC_KEY_INDEX_VERSION) break;
+        if(header.entry_size != sizeof(MfClassicKeyIndexEntry)) break;
+        if(header.count > instance->capacity) {
+            FURI_LOG_W(TAG, "Index has %lu entries, over capacity", header.count);
+            break;
+        }
+        if(header.card_count > MF_CLASSIC_KEY_INDEX_CARDS_MAX) break;
+
+        const size_t entries_size = header.count * sizeof(MfClassicKeyIndexEntry);
+        if(storage_file_read(file, instance->entries, entries_size) != entries_size) break;
+        const size_t cards_size = header.card_count * sizeof(uint32_t);
+        if(storage_file_read(file, instance->cards, cards_size) != cards_size) break;
+
+        instance->count = header.count;
+        instance->card_count = header.card_count;
+        instance->stats = header.stats;
+        load_success = true;
+    } while(false);
+
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    if(!load_success) {
+        mf_classic_key_index_reset(instance);
+    }
+
+    return load_success;
+}
+
+bool mf_classic_key_index_save(const MfClassicKeyIndex* instance, const char* path) {
+    furi_check(instance);
+    furi_check(path);
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+
+    bool save_success = false;
+    do {
+        if(!storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) break;
+
+        const MfClassicKeyIndexHeader header = {
+            .magic = MF_CLASSIC_KEY_INDEX_MAGIC,
+            .version = MF_CLASSIC_KEY_INDEX_VERSION,
+            .entry_size = sizeof(MfClassicKeyIndexEntry),
+            .count = instance->count,
+            .card_count = instance->card_count,
+            .stats = instance->stats,
+        };
+        if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) break;
+
+        const size_t entries_size = instance->count * sizeof(MfClassicKeyIndexEntry);
+        if(storage_file_write(file, instance->entries, entries_size) != entries_size) break;
+        const size_t cards_size = instance->card_count * sizeof(uint32_t);
+        if(storage_file_write(file, instance->cards, cards_size) != cards_size) break;
+
+        save_success = true;
+    } while(false);
+
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return save_success;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file mf_classic_key_index.h
+ * @brief MIFARE Classic key index
+ *
+ * Maps card fingerprints to keys seen on earlier cards with the same
+ * fingerprint. Cards of one family (one building, one transport system)
+ * usually share most of their keys while having different UIDs, so the
+ * index can suggest likely keys for a card that was never seen before.
+ *
+ * Fingerprints are taken from what is known about the card:
+ * - card family: type, ATQA, SAK and UID length, always known;
+ * - manufacturer block: bytes of block 0 after the UID, once block 0 is read;
+ * - first known key A with its sector number, once any key A is found.
+ *
+ * Entries are kept sorted in RAM and saved as one binary file. UIDs of
+ * the last added cards are kept as well, so a card read again does not
+ * count its keys twice.
+ */
+#pragma once
+
+#include <nfc/protocols/mf_classic/mf_classic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct MfClassicKeyIndex MfClassicKeyIndex;
+
+typedef struct {
+    uint32_t lookups; /**< lookups that suggested at least one key */
+    uint32_t suggested; /**< keys suggested in these lookups */
+    uint32_t hits; /**< suggested keys that were found on the card */
+} MfClassicKeyIndexStats;
+
+/** Allocate key index
+ *
+ * @param      capacity  maximum entry count, the least used entries are
+ *                       dropped when the index is full
+ *
+ * @return     MfClassicKeyIndex instance
+ */
+MfClassicKeyIndex* mf_classic_key_index_alloc(size_t capacity);
+
+/** Free key index
+ *
+ * @param      instance  MfClassicKeyIndex instance
+ */
+void mf_classic_key_index_free(MfClassicKeyIndex* instance);
+
+/** Remove all entries and reset statistics
+ *
+ * @param      instance  MfClassicKeyIndex instance
+ */
+void mf_classic_key_index_reset(MfClassicKeyIndex* instance);
+
+/** Load key index from file
+ *
+ * @param      instance  MfClassicKeyIndex instance
+ * @param      path      file path
+ *
+ * @return     true on success, index is empty otherwise
+ */
+bool mf_classic_key_index_load(MfClassicKeyIndex* instance, const char* path);
+
+/** Save key index to file
+ *
+ * @param      instance  MfClassicKeyIndex instance
+ * @param      path      file path
+ *
+ * @return     true on success
+ */
+bool mf_classic_key_index_save(const MfClassicKeyIndex* instance, const char* path);
+
+/** Add found keys of the card under all its fingerprints
+ *
+ * Keys of a card with a known UID are added if missing, counts of known
+ * keys are not incremented again.
+ *
+ * @param      instance  MfClassicKeyIndex instance
+ * @param      data      card data
+ *
+ * @return     true if the card UID was not seen before
+ */
+bool mf_classic_key_index_add(MfClassicKeyIndex* instance, const MfClassicData* data);
+
+/** Get likely keys for the card
+ *
+ * Keys that are already found on the card are skipped.
+ *
+ * @param      instance  MfClassicKeyIndex instance
+ * @param      data      card data
+ * @param      keys      destination, most likely key first
+ * @param      keys_max  destination size
+ *
+ * @return     key count
+ */
+size_t mf_classic_key_index_lookup(
+    const MfClassicKeyIndex* instance,
+    const MfClassicData* data,
+    MfClassicKey* keys,
+    size_t keys_max);
+
+/** Count suggested keys that turned out to be card keys
+ *
+ * @param      instance  MfClassicKeyIndex instance
+ * @param      keys      keys returned by lookup
+ * @param      keys_num  key count
+ * @param      data      card data after the keys were tried
+ *
+ * @return     hit count of this lookup
+ */
+size_t mf_classic_key_index_update_stats(
+    MfClassicKeyIndex* instance,
+    const MfClassicKey* keys,
+    size_t keys_num,
+    const MfClassicData* data);
+
+/** Get entry count
+ *
+ * @param      instance  MfClassicKeyIndex instance
+ *
+ * @return     entry count
+ */
+size_t mf_classic_key_index_get_size(const MfClassicKeyIndex* instance);
+
+/** Get lookup statistics
+ *
+ * @param      instance  MfClassicKeyIndex instance
+ *
+ * @return     statistics, kept across save and load
+ */
+const MfClassicKeyIndexStats* mf_classic_key_index_get_stats(const MfClassicKeyIndex* instance);
+
+#ifdef __cplusplus
+}
+#endif
@@ -4,6 +4,7 @@
 
 #include <furi_hal_nfc.h>
 #include <furi/furi.h>
+#include <toolbox/profiler.h>
 
 #define TAG "Nfc"
 
@@ -176,6 +177,7 @@ bool nfc_worker_poller_start_handler(Nfc* instance) {
 }
 
 bool nfc_worker_poller_ready_handler(Nfc* instance) {
+    PROFILER_ZONE("nfc_poller_ready");
     NfcCommand command = NfcCommandContinue;
 
     NfcEvent event = {.type = NfcEventTypePollerReady};
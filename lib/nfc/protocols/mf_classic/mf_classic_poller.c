@@ -3,6 +3,7 @@
 #include <nfc/protocols/nfc_poller_base.h>
 
 #include <furi.h>
+#include <toolbox/profiler.h>
 
 #define TAG "MfClassicPoller"
 
@@ -154,6 +155,66 @@ NfcCommand mf_classic_poller_handler_detect_type(MfClassicPoller* instance) {
     return command;
 }
 
+static void mf_classic_poller_read_fast_key_proven(
+    MfClassicPollerReadFastContext* read_fast_ctx,
+    const MfClassicKey* key,
+    MfClassicKeyType key_type,
+    uint8_t sector) {
+    MfClassicReadFastKey* graph = read_fast_ctx->graph;
+
+    size_t i = 0;
+    while(i < read_fast_ctx->graph_count &&
+          (graph[i].key_type != key_type ||
+           memcmp(graph[i].key.data, key->data, sizeof(MfClassicKey)) != 0)) {
+        i++;
+    }
+    if(i == read_fast_ctx->graph_count) {
+        // Graph is full, key is left to its own sector
+        if(i == MF_CLASSIC_READ_FAST_GRAPH_SIZE) return;
+        graph[i] = (MfClassicReadFastKey){.key = *key, .key_type = key_type};
+        read_fast_ctx->graph_count++;
+    }
+
+    if(FURI_BIT(graph[i].sector_mask, sector)) return;
+    FURI_BIT_SET(graph[i].sector_mask, sector);
+    graph[i].sector_count++;
+
+    // Keep most reused keys first
+    for(; i > 0 && graph[i - 1].sector_count < graph[i].sector_count; i--) {
+        MfClassicReadFastKey tmp = graph[i - 1];
+        graph[i - 1] = graph[i];
+        graph[i] = tmp;
+    }
+}
+
+static void mf_classic_poller_read_fast_plan(
+    MfClassicPoller* instance,
+    const MfClassicDeviceKeys* keys) {
+    PROFILER_ZONE("mfc_read_fast_plan");
+    MfClassicPollerReadFastContext* read_fast_ctx = &instance->mode_ctx.read_fast_ctx;
+
+    read_fast_ctx->keys = *keys;
+    memset(read_fast_ctx->graph, 0, sizeof(read_fast_ctx->graph));
+    read_fast_ctx->graph_count = 0;
+    read_fast_ctx->current_sector = 0;
+    read_fast_ctx->session_active = false;
+    read_fast_ctx->auth_count = 0;
+    read_fast_ctx->nested_auth_count = 0;
+    read_fast_ctx->reselect_count = 0;
+    read_fast_ctx->start_tick = furi_get_tick();
+    for(uint8_t sector = 0; sector < instance->sectors_total; sector++) {
+        if(FURI_BIT(keys->key_a_mask, sector)) {
+            mf_classic_poller_read_fast_key_proven(
+                read_fast_ctx, &keys->key_a[sector], MfClassicKeyTypeA, sector);
+        }
+        if(FURI_BIT(keys->key_b_mask, sector)) {
+            mf_classic_poller_read_fast_key_proven(
+                read_fast_ctx, &keys->key_b[sector], MfClassicKeyTypeB, sector);
+        }
+    }
+    FURI_LOG_D(TAG, "Fast read: %u distinct keys", read_fast_ctx->graph_count);
+}
+
 NfcCommand mf_classic_poller_handler_start(MfClassicPoller* instance) {
     NfcCommand command = NfcCommandContinue;
 
@@ -171,6 +232,10 @@ NfcCommand mf_classic_poller_handler_start(MfClassicPoller* instance) {
         instance->state = MfClassicPollerStateAnalyzeBackdoor;
     } else if(instance->mfc_event_data.poller_mode.mode == MfClassicPollerModeRead) {
         instance->state = MfClassicPollerStateRequestReadSector;
+    } else if(instance->mfc_event_data.poller_mode.mode == MfClassicPollerModeReadFast) {
+        furi_check(instance->mfc_event_data.poller_mode.keys);
+        mf_classic_poller_read_fast_plan(instance, instance->mfc_event_data.poller_mode.keys);
+        instance->state = MfClassicPollerStateReadFastSector;
     } else if(instance->mfc_event_data.poller_mode.mode == MfClassicPollerModeWrite) {
         instance->state = MfClassicPollerStateRequestSectorTrailer;
     } else {
@@ -557,6 +622,169 @@ NfcCommand mf_classic_poller_handler_request_read_sector_blocks(MfClassicPoller*
     return command;
 }
 
+static MfClassicError mf_classic_poller_read_fast_try_key(
+    MfClassicPoller* instance,
+    uint8_t block_num,
+    MfClassicKey* key,
+    MfClassicKeyType key_type) {
+    MfClassicPollerReadFastContext* read_fast_ctx = &instance->mode_ctx.read_fast_ctx;
+
+    // Failed auth or denied read halts the card, select it again without leaving the handler
+    if(instance->iso14443_3a_poller->state != Iso14443_3aPollerStateActivated) {
+        PROFILER_ZONE("mfc_read_fast_reselect");
+        read_fast_ctx->session_active = false;
+        if(iso14443_3a_poller_activate(instance->iso14443_3a_poller, NULL) !=
+           Iso14443_3aErrorNone) {
+            return MfClassicErrorNotPresent;
+        }
+        read_fast_ctx->reselect_count++;
+    }
+
+    PROFILER_ZONE("mfc_read_fast_auth");
+    MfClassicError error;
+    if(read_fast_ctx->session_active) {
+        error = mf_classic_poller_auth_nested(
+            instance, block_num, key, key_type, NULL, false, false);
+        read_fast_ctx->nested_auth_count++;
+    } else {
+        error = mf_classic_poller_auth(instance, block_num, key, key_type, NULL, false);
+    }
+    read_fast_ctx->auth_count++;
+    read_fast_ctx->session_active = (error == MfClassicErrorNone);
+
+    return error;
+}
+
+static MfClassicError mf_classic_poller_read_fast_auth(
+    MfClassicPoller* instance,
+    uint8_t sector,
+    MfClassicKeyType key_type,
+    MfClassicKey* key) {
+    MfClassicPollerReadFastContext* read_fast_ctx = &instance->mode_ctx.read_fast_ctx;
+    const uint8_t block_num = mf_classic_get_first_block_num_of_sector(sector);
+    const bool key_cached = key_type == MfClassicKeyTypeA ?
+                                FURI_BIT(read_fast_ctx->keys.key_a_mask, sector) :
+                                FURI_BIT(read_fast_ctx->keys.key_b_mask, sector);
+    const MfClassicKey* cached_key = key_type == MfClassicKeyTypeA ?
+                                         &read_fast_ctx->keys.key_a[sector] :
+                                         &read_fast_ctx->keys.key_b[sector];
+
+    MfClassicError error = MfClassicErrorAuth;
+    if(key_cached) {
+        *key = *cached_key;
+        error = mf_classic_poller_read_fast_try_key(instance, block_num, key, key_type);
+    }
+
+    // Then keys of the same type proven on other sectors, most reused first
+    size_t tries = 0;
+    for(size_t i = 0; i < read_fast_ctx->graph_count; i++) {
+        if(error == MfClassicErrorNone || error == MfClassicErrorNotPresent) break;
+        if(tries == MF_CLASSIC_READ_FAST_GRAPH_TRIES) break;
+
+        const MfClassicReadFastKey* graph_key = &read_fast_ctx->graph[i];
+        if(graph_key->key_type != key_type) continue;
+        if(key_cached && memcmp(graph_key->key.data, cached_key->data, sizeof(MfClassicKey)) == 0)
+            continue;
+
+        *key = graph_key->key;
+        error = mf_classic_poller_read_fast_try_key(instance, block_num, key, key_type);
+        tries++;
+    }
+
+    if(error == MfClassicErrorNone) {
+        if(!mf_classic_is_key_found(instance->data, sector, key_type)) {
+            uint64_t key_num = bit_lib_bytes_to_num_be(key->data, sizeof(MfClassicKey));
+            mf_classic_set_key_found(instance->data, sector, key_type, key_num);
+        }
+        mf_classic_poller_read_fast_key_proven(read_fast_ctx, key, key_type, sector);
+    }
+
+    return error;
+}
+
+static MfClassicError mf_classic_poller_read_fast_blocks(
+    MfClassicPoller* instance,
+    uint8_t sector,
+    MfClassicKey* key,
+    MfClassicKeyType key_type) {
+    MfClassicPollerReadFastContext* read_fast_ctx = &instance->mode_ctx.read_fast_ctx;
+    const uint8_t first_block = mf_classic_get_first_block_num_of_sector(sector);
+    const uint8_t block_count = mf_classic_get_blocks_num_in_sector(sector);
+    MfClassicError error = MfClassicErrorNone;
+
+    for(uint8_t block_num = first_block; block_num < first_block + block_count; block_num++) {
+        if(mf_classic_is_block_read(instance->data, block_num)) continue;
+
+        if(!read_fast_ctx->session_active) {
+            error = mf_classic_poller_read_fast_try_key(instance, block_num, key, key_type);
+            if(error != MfClassicErrorNone) break;
+        }
+
+        PROFILER_ZONE("mfc_read_fast_block");
+        MfClassicBlock block = {};
+        error = mf_classic_poller_read_block(instance, block_num, &block);
+        if(error == MfClassicErrorNone) {
+            mf_classic_set_block_read(instance->data, block_num, &block);
+            if(key_type == MfClassicKeyTypeA) {
+                mf_classic_poller_check_key_b_is_readable(instance, block_num, &block);
+            }
+        } else {
+            mf_classic_poller_halt(instance);
+            read_fast_ctx->session_active = false;
+        }
+    }
+
+    return error;
+}
+
+NfcCommand mf_classic_poller_handler_read_fast_sector(MfClassicPoller* instance) {
+    MfClassicPollerReadFastContext* read_fast_ctx = &instance->mode_ctx.read_fast_ctx;
+
+    if(read_fast_ctx->current_sector == instance->sectors_total) {
+        if(read_fast_ctx->session_active) mf_classic_poller_halt(instance);
+        FURI_LOG_I(
+            TAG,
+            "Fast read: %lums, %u auth (%u nested), %u reselect",
+            furi_get_tick() - read_fast_ctx->start_tick,
+            read_fast_ctx->auth_count,
+            read_fast_ctx->nested_auth_count,
+            read_fast_ctx->reselect_count);
+        instance->mfc_event_data.read_fast_stats = (MfClassicPollerEventDataReadFastStats){
+            .auth_count = read_fast_ctx->auth_count,
+            .nested_auth_count = read_fast_ctx->nested_auth_count,
+            .reselect_count = read_fast_ctx->reselect_count,
+        };
+        instance->state = MfClassicPollerStateSuccess;
+        return NfcCommandContinue;
+    }
+
+    PROFILER_ZONE("mfc_read_fast_sector");
+    const uint8_t sector = read_fast_ctx->current_sector;
+    MfClassicError error = MfClassicErrorNone;
+
+    const MfClassicKeyType key_types[] = {MfClassicKeyTypeA, MfClassicKeyTypeB};
+    for(size_t i = 0; i < COUNT_OF(key_types); i++) {
+        if(mf_classic_is_sector_read(instance->data, sector)) break;
+
+        const MfClassicKeyType key_type = key_types[i];
+
+        MfClassicKey key = {};
+        error = mf_classic_poller_read_fast_auth(instance, sector, key_type, &key);
+        if(error == MfClassicErrorNotPresent) break;
+        if(error != MfClassicErrorNone) continue;
+
+        error = mf_classic_poller_read_fast_blocks(instance, sector, &key, key_type);
+        if(error == MfClassicErrorNotPresent) break;
+    }
+
+    // Card left the field: sector is read again once the card is selected
+    if(error != MfClassicErrorNotPresent) {
+        read_fast_ctx->current_sector++;
+    }
+
+    return NfcCommandContinue;
+}
+
 NfcCommand mf_classic_poller_handler_analyze_backdoor(MfClassicPoller* instance) {
     NfcCommand command = NfcCommandReset;
     MfClassicPollerDictAttackContext* dict_attack_ctx = &instance->mode_ctx.dict_attack_ctx;
@@ -2157,6 +2385,7 @@ static const MfClassicPollerReadHandler
         [MfClassicPollerStateRequestReadSector] = mf_classic_poller_handler_request_read_sector,
         [MfClassicPollerStateReadSectorBlocks] =
             mf_classic_poller_handler_request_read_sector_blocks,
+        [MfClassicPollerStateReadFastSector] = mf_classic_poller_handler_read_fast_sector,
         [MfClassicPollerStateAuthKeyA] = mf_classic_poller_handler_auth_a,
         [MfClassicPollerStateAuthKeyB] = mf_classic_poller_handler_auth_b,
         [MfClassicPollerStateReadSector] = mf_classic_poller_handler_read_sector,
@@ -46,6 +46,7 @@ typedef enum {
     MfClassicPollerModeWrite, /**< Poller writing mode. */
     MfClassicPollerModeDictAttackStandard, /**< Poller dictionary attack mode. */
     MfClassicPollerModeDictAttackEnhanced, /**< Poller enhanced dictionary attack mode. */
+    MfClassicPollerModeReadFast, /**< Poller reading mode with all known keys provided at once. */
 } MfClassicPollerMode;
 
 /**
@@ -91,6 +92,7 @@ typedef enum {
 typedef struct {
     MfClassicPollerMode mode; /**< Mode to be used by poller. */
     const MfClassicData* data; /**< Data to be used by poller. */
+    const MfClassicDeviceKeys* keys; /**< Known keys, used in fast reading mode. */
 } MfClassicPollerEventDataRequestMode;
 
 /**
@@ -165,6 +167,18 @@ typedef struct {
     bool write_block_provided; /**< Flag indicating if block is provided. */
 } MfClassicPollerEventDataWriteBlockRequest;
 
+/**
+ * @brief MfClassic poller fast read statistics.
+ *
+ * The instance of this structure is filled by poller and passed with
+ * MfClassicPollerEventTypeSuccess event in MfClassicPollerModeReadFast mode.
+ */
+typedef struct {
+    uint16_t auth_count; /**< Number of authentications, nested ones included. */
+    uint16_t nested_auth_count; /**< Number of nested authentications. */
+    uint16_t reselect_count; /**< Number of card reselections after a failed key. */
+} MfClassicPollerEventDataReadFastStats;
+
 /**
  * @brief MfClassic poller key attack event data.
  *
@@ -189,6 +203,7 @@ typedef union {
     MfClassicPollerEventKeyAttackData key_attack_data; /**< Key attack context. */
     MfClassicPollerEventDataSectorTrailerRequest sec_tr_data; /**< Sector trailer request context. */
     MfClassicPollerEventDataWriteBlockRequest write_block_data; /**< Write block request context. */
+    MfClassicPollerEventDataReadFastStats read_fast_stats; /**< Fast read statistics. */
 } MfClassicPollerEventData;
 
 /**
@@ -22,6 +22,8 @@ extern "C" {
 #define MF_CLASSIC_NESTED_RETRY_MAXIMUM         (60)
 #define MF_CLASSIC_NESTED_HARD_RETRY_MAXIMUM    (3)
 #define MF_CLASSIC_NESTED_CALIBRATION_COUNT     (21)
+#define MF_CLASSIC_READ_FAST_GRAPH_SIZE         (16)
+#define MF_CLASSIC_READ_FAST_GRAPH_TRIES        (4)
 #define MF_CLASSIC_NESTED_LOGS_FILE_NAME        ".nested.log"
 #define MF_CLASSIC_NESTED_SYSTEM_DICT_FILE_NAME "mf_classic_dict_nested.nfc"
 #define MF_CLASSIC_NESTED_USER_DICT_FILE_NAME   "mf_classic_dict_user_nested.nfc"
@@ -85,6 +87,9 @@ typedef enum {
     MfClassicPollerStateRequestReadSector,
     MfClassicPollerStateReadSectorBlocks,
 
+    // Fast read states
+    MfClassicPollerStateReadFastSector,
+
     // Dict attack states
     MfClassicPollerStateNextSector,
     MfClassicPollerStateAnalyzeBackdoor,
@@ -165,10 +170,32 @@ typedef struct {
     bool auth_passed;
 } MfClassicPollerReadContext;
 
+typedef struct {
+    MfClassicKey key;
+    MfClassicKeyType key_type;
+    uint8_t sector_count;
+    uint64_t sector_mask;
+} MfClassicReadFastKey;
+
+typedef struct {
+    MfClassicDeviceKeys keys;
+    // Key reuse graph: distinct keys with sectors they are proven on, most used first
+    MfClassicReadFastKey graph[MF_CLASSIC_READ_FAST_GRAPH_SIZE];
+    uint8_t graph_count;
+    uint8_t current_sector;
+    // Card stays authenticated between sectors, next auth is nested
+    bool session_active;
+    uint32_t start_tick;
+    uint16_t auth_count;
+    uint16_t nested_auth_count;
+    uint16_t reselect_count;
+} MfClassicPollerReadFastContext;
+
 typedef union {
     MfClassicPollerWriteContext write_ctx;
     MfClassicPollerDictAttackContext dict_attack_ctx;
     MfClassicPollerReadContext read_ctx;
+    MfClassicPollerReadFastContext read_fast_ctx;
 
 } MfClassicPollerModeContext;
 
@@ -235,7 +262,6 @@ typedef struct {
 
 typedef struct {
     MfClassicDeviceKeys keys;
-    uint8_t current_sector;
 } MfClassicReadContext;
 
 typedef union {
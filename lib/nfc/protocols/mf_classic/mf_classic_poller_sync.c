@@ -391,38 +391,6 @@ MfClassicError mf_classic_poller_sync_change_value(
     return error;
 }
 
-static bool mf_classic_poller_read_get_next_key(
-    MfClassicReadContext* read_ctx,
-    uint8_t* sector_num,
-    MfClassicKey* key,
-    MfClassicKeyType* key_type) {
-    bool next_key_found = false;
-
-    for(uint8_t i = read_ctx->current_sector; i < MF_CLASSIC_TOTAL_SECTORS_MAX; i++) {
-        if(FURI_BIT(read_ctx->keys.key_a_mask, i)) {
-            FURI_BIT_CLEAR(read_ctx->keys.key_a_mask, i);
-            *key = read_ctx->keys.key_a[i];
-            *key_type = MfClassicKeyTypeA;
-            *sector_num = i;
-
-            next_key_found = true;
-            break;
-        }
-        if(FURI_BIT(read_ctx->keys.key_b_mask, i)) {
-            FURI_BIT_CLEAR(read_ctx->keys.key_b_mask, i);
-            *key = read_ctx->keys.key_b[i];
-            *key_type = MfClassicKeyTypeB;
-            *sector_num = i;
-
-            next_key_found = true;
-            read_ctx->current_sector = i;
-            break;
-        }
-    }
-
-    return next_key_found;
-}
-
 NfcCommand mf_classic_poller_read_callback(NfcGenericEvent event, void* context) {
     furi_assert(context);
     furi_assert(event.event_data);
@@ -436,22 +404,8 @@ NfcCommand mf_classic_poller_read_callback(NfcGenericEvent event, void* context)
         poller_context->error = MfClassicErrorNotPresent;
         command = NfcCommandStop;
     } else if(mfc_event->type == MfClassicPollerEventTypeRequestMode) {
-        mfc_event->data->poller_mode.mode = MfClassicPollerModeRead;
-    } else if(mfc_event->type == MfClassicPollerEventTypeRequestReadSector) {
-        MfClassicPollerEventDataReadSectorRequest* req_data =
-            &mfc_event->data->read_sector_request_data;
-        MfClassicKey key = {};
-        MfClassicKeyType key_type = MfClassicKeyTypeA;
-        uint8_t sector_num = 0;
-        if(mf_classic_poller_read_get_next_key(
-               &poller_context->data.read_context, &sector_num, &key, &key_type)) {
-            req_data->sector_num = sector_num;
-            req_data->key = key;
-            req_data->key_type = key_type;
-            req_data->key_provided = true;
-        } else {
-            req_data->key_provided = false;
-        }
+        mfc_event->data->poller_mode.mode = MfClassicPollerModeReadFast;
+        mfc_event->data->poller_mode.keys = &poller_context->data.read_context.keys;
     } else if(mfc_event->type == MfClassicPollerEventTypeSuccess) {
         command = NfcCommandStop;
     }
@@ -2,6 +2,7 @@
 #include "mf_ultralight_listener_defs.h"
 
 #include <lib/nfc/protocols/iso14443_3a/iso14443_3a_listener_i.h>
+#include <lib/nfc/helpers/iso14443_crc.h>
 
 #include <furi.h>
 #include <furi_hal.h>
@@ -32,6 +33,60 @@ static bool mf_ultralight_listener_check_access(
     return access_success;
 }
 
+static bool mf_ultralight_listener_page_is_plain(MfUltralightListener* instance, uint16_t page) {
+    bool readable =
+        mf_ultralight_listener_check_access(instance, page, MfUltralightListenerAccessTypeRead);
+    return readable && !mf_ultralight_is_page_pwd_or_pack(instance->data->type, page);
+}
+
+static bool mf_ultralight_listener_response_cache_supported(MfUltralightListener* instance) {
+    // Mirror contents depend on auth state and counter, I2C tags remap pages by sector
+    bool mirror_configured =
+        mf_ultralight_support_feature(instance->features, MfUltralightFeatureSupportAsciiMirror) &&
+        (instance->config != NULL) &&
+        (instance->config->mirror.mirror_conf != MfUltralightMirrorNone);
+
+    return !mirror_configured && !mf_ultralight_is_i2c_tag(instance->data->type);
+}
+
+static void mf_ultralight_listener_response_cache_invalidate(MfUltralightListener* instance) {
+    instance->response_cache.dirty = true;
+    instance->response_cache.plain_pages = 0;
+    instance->response_cache.read_frames = 0;
+}
+
+static void mf_ultralight_listener_response_cache_build(MfUltralightListener* instance) {
+    furi_assert(instance->auth_state == MfUltralightListenerAuthStateIdle);
+
+    MfUltralightListenerResponseCache* cache = &instance->response_cache;
+    mf_ultralight_listener_response_cache_invalidate(instance);
+    cache->dirty = false;
+
+    do {
+        if(cache->read_frame == NULL) break;
+        if(!mf_ultralight_listener_response_cache_supported(instance)) break;
+
+        // Pages readable without auth are served the same way after auth
+        uint16_t pages_total = instance->data->pages_total;
+        while(cache->plain_pages < pages_total &&
+              mf_ultralight_listener_page_is_plain(instance, cache->plain_pages)) {
+            cache->plain_pages++;
+        }
+
+        // READ windows that roll over or touch restricted pages stay on the regular path
+        if(cache->plain_pages < 4) break;
+        cache->read_frames = cache->plain_pages - 3;
+
+        for(uint16_t i = 0; i < cache->read_frames; i++) {
+            bit_buffer_copy_bytes(
+                instance->tx_buffer, instance->data->page[i].data, MF_ULTRALIGHT_PAGE_SIZE * 4);
+            iso14443_crc_append(Iso14443CrcTypeA, instance->tx_buffer);
+            bit_buffer_write_bytes(
+                instance->tx_buffer, cache->read_frame[i], sizeof(MfUltralightListenerReadFrame));
+        }
+    } while(false);
+}
+
 static void mf_ultralight_listener_send_short_resp(MfUltralightListener* instance, uint8_t data) {
     furi_assert(instance->tx_buffer);
 
@@ -93,6 +148,11 @@ static MfUltralightCommand mf_ultralight_listener_perform_write(
         memcpy(instance->data->page[page].data, rx_data, sizeof(MfUltralightPage));
     }
 
+    // Lock and config pages change access rules too, templates are rebuilt on next halt
+    if(command != MfUltralightCommandNotProcessedNAK) {
+        mf_ultralight_listener_response_cache_invalidate(instance);
+    }
+
     return command;
 }
 
@@ -105,6 +165,17 @@ static MfUltralightCommand
     FURI_LOG_T(TAG, "CMD_READ: %d", start_page);
 
     do {
+        if(start_page < instance->response_cache.read_frames) {
+            bit_buffer_copy_bytes(
+                instance->tx_buffer,
+                instance->response_cache.read_frame[start_page],
+                sizeof(MfUltralightListenerReadFrame));
+            iso14443_3a_listener_tx(instance->iso14443_3a_listener, instance->tx_buffer);
+            mf_ultralight_single_counter_try_increase(instance);
+            command = MfUltralightCommandProcessed;
+            break;
+        }
+
         bool do_i2c_check = mf_ultralight_is_i2c_tag(instance->data->type);
 
         if(do_i2c_check) {
@@ -167,11 +238,18 @@ static MfUltralightCommand
             break;
         }
 
-        MfUltralightPage pages[64] = {};
         uint8_t page_cnt = (end_page - start_page) + 1;
-        mf_ultralight_listener_perform_read(pages, instance, start_page, page_cnt, do_i2c_check);
+        if(end_page < instance->response_cache.plain_pages) {
+            bit_buffer_copy_bytes(
+                instance->tx_buffer, instance->data->page[start_page].data, page_cnt * 4);
+            mf_ultralight_single_counter_try_increase(instance);
+        } else {
+            MfUltralightPage pages[64] = {};
+            mf_ultralight_listener_perform_read(
+                pages, instance, start_page, page_cnt, do_i2c_check);
+            bit_buffer_copy_bytes(instance->tx_buffer, (uint8_t*)pages, page_cnt * 4);
+        }
 
-        bit_buffer_copy_bytes(instance->tx_buffer, (uint8_t*)pages, page_cnt * 4);
         iso14443_3a_listener_send_standard_frame(
             instance->iso14443_3a_listener, instance->tx_buffer);
         command = MfUltralightCommandProcessed;
@@ -733,6 +811,9 @@ static NfcCommand mf_ultralight_reset_listener_state(
     mf_ultralight_single_counter_try_to_unlock(instance, event_type);
     instance->sector = 0;
     instance->auth_state = MfUltralightListenerAuthStateIdle;
+    if(instance->response_cache.dirty) {
+        mf_ultralight_listener_response_cache_build(instance);
+    }
     return NfcCommandSleep;
 }
 
@@ -750,6 +831,11 @@ MfUltralightListener* mf_ultralight_listener_alloc(
     mf_ultralight_composite_command_reset(instance);
     instance->sector = 0;
     instance->tx_buffer = bit_buffer_alloc(MF_ULTRALIGHT_LISTENER_MAX_TX_BUFF_SIZE);
+    if(!mf_ultralight_is_i2c_tag(data->type)) {
+        instance->response_cache.read_frame =
+            malloc(data->pages_total * sizeof(MfUltralightListenerReadFrame));
+    }
+    mf_ultralight_listener_response_cache_build(instance);
 
     instance->mfu_event.data = &instance->mfu_event_data;
     instance->generic_event.protocol = NfcProtocolMfUltralight;
@@ -766,6 +852,7 @@ void mf_ultralight_listener_free(MfUltralightListener* instance) {
     furi_assert(instance->tx_buffer);
 
     bit_buffer_free(instance->tx_buffer);
+    free(instance->response_cache.read_frame);
     furi_string_free(instance->mirror.ascii_mirror_data);
     mbedtls_des3_free(&instance->des_context);
     free(instance);
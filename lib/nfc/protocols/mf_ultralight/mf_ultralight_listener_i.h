@@ -50,6 +50,17 @@ typedef struct {
 typedef uint16_t MfUltralightStaticLockData;
 typedef uint32_t MfUltralightDynamicLockData;
 
+#define MF_ULTRALIGHT_LISTENER_READ_FRAME_SIZE (MF_ULTRALIGHT_PAGE_SIZE * 4 + 2)
+
+typedef uint8_t MfUltralightListenerReadFrame[MF_ULTRALIGHT_LISTENER_READ_FRAME_SIZE];
+
+typedef struct {
+    bool dirty;
+    uint16_t plain_pages;
+    uint16_t read_frames;
+    MfUltralightListenerReadFrame* read_frame;
+} MfUltralightListenerResponseCache;
+
 struct MfUltralightListener {
     Iso14443_3aListener* iso14443_3a_listener;
     MfUltralightListenerAuthState auth_state;
@@ -68,6 +79,7 @@ struct MfUltralightListener {
     bool single_counter_increased;
     MfUltralightMirrorMode mirror;
     MfUltralightListenerCompositeCommandContext composite_cmd;
+    MfUltralightListenerResponseCache response_cache;
     mbedtls_des3_context des_context;
     uint8_t rndB[MF_ULTRALIGHT_C_AUTH_RND_BLOCK_SIZE];
     uint8_t encB[MF_ULTRALIGHT_C_AUTH_RND_BLOCK_SIZE];
@@ -0,0 +1,94 @@
+#include "pwm.h"
+
+#define TAG "SubGhzBlockPwm"
+
+static inline bool subghz_protocol_blocks_pwm_match(SubGhzBlockPwmRange range, uint32_t duration) {
+    // One unsigned compare: durations below min wrap around to large values
+    return duration - range.min <= range.max - range.min;
+}
+
+static bool subghz_protocol_blocks_pwm_frame_end(
+    const SubGhzBlockPwm* pwm,
+    SubGhzBlockDecoder* decoder) {
+    // Repeated frames are not preceded by a header, only by the start pulse
+    decoder->parser_step = pwm->start.max ? SubGhzBlockPwmStepFoundStartBit :
+                                            SubGhzBlockPwmStepReset;
+    return decoder->decode_count_bit >= pwm->count_bit_min &&
+           decoder->decode_count_bit <= pwm->count_bit_max;
+}
+
+bool subghz_protocol_blocks_pwm_feed(
+    const SubGhzBlockPwm* pwm,
+    SubGhzBlockDecoder* decoder,
+    bool level,
+    uint32_t duration) {
+    const bool first_level = (pwm->order == SubGhzBlockPwmOrderPulseGap);
+    bool found = false;
+
+    switch(decoder->parser_step) {
+    case SubGhzBlockPwmStepReset:
+        if(!level && subghz_protocol_blocks_pwm_match(pwm->header, duration)) {
+            if(pwm->start.max) {
+                decoder->parser_step = SubGhzBlockPwmStepFoundStartBit;
+            } else {
+                decoder->decode_data = 0;
+                decoder->decode_count_bit = 0;
+                decoder->parser_step = SubGhzBlockPwmStepSaveDuration;
+            }
+        }
+        break;
+    case SubGhzBlockPwmStepFoundStartBit:
+        if(!level) {
+            break;
+        } else if(subghz_protocol_blocks_pwm_match(pwm->start, duration)) {
+            decoder->decode_data = 0;
+            decoder->decode_count_bit = 0;
+            decoder->parser_step = SubGhzBlockPwmStepSaveDuration;
+        } else {
+            decoder->parser_step = SubGhzBlockPwmStepReset;
+        }
+        break;
+    case SubGhzBlockPwmStepSaveDuration:
+        if(level != first_level) {
+            decoder->parser_step = SubGhzBlockPwmStepReset;
+        } else if(!level && duration >= pwm->frame_gap) {
+            found = subghz_protocol_blocks_pwm_frame_end(pwm, decoder);
+        } else {
+            decoder->te_last = duration;
+            decoder->parser_step = SubGhzBlockPwmStepCheckDuration;
+        }
+        break;
+    case SubGhzBlockPwmStepCheckDuration:
+        if(level == first_level) {
+            decoder->parser_step = SubGhzBlockPwmStepReset;
+        } else if(!level && duration >= pwm->frame_gap) {
+            // Last pulse is followed by the frame gap, its bit is known from the pulse alone
+            if(pwm->frame_gap_is_header &&
+               !subghz_protocol_blocks_pwm_match(pwm->header, duration)) {
+                decoder->parser_step = SubGhzBlockPwmStepReset;
+                break;
+            }
+            if(subghz_protocol_blocks_pwm_match(pwm->te_short, decoder->te_last)) {
+                subghz_protocol_blocks_add_bit(decoder, pwm->invert);
+            } else if(subghz_protocol_blocks_pwm_match(pwm->te_long, decoder->te_last)) {
+                subghz_protocol_blocks_add_bit(decoder, !pwm->invert);
+            }
+            found = subghz_protocol_blocks_pwm_frame_end(pwm, decoder);
+        } else if(
+            subghz_protocol_blocks_pwm_match(pwm->te_short, decoder->te_last) &&
+            subghz_protocol_blocks_pwm_match(pwm->te_long, duration)) {
+            subghz_protocol_blocks_add_bit(decoder, pwm->invert);
+            decoder->parser_step = SubGhzBlockPwmStepSaveDuration;
+        } else if(
+            subghz_protocol_blocks_pwm_match(pwm->te_long, decoder->te_last) &&
+            subghz_protocol_blocks_pwm_match(pwm->te_short, duration)) {
+            subghz_protocol_blocks_add_bit(decoder, !pwm->invert);
+            decoder->parser_step = SubGhzBlockPwmStepSaveDuration;
+        } else {
+            decoder->parser_step = SubGhzBlockPwmStepReset;
+        }
+        break;
+    }
+
+    return found;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "decoder.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Accepted duration range, limits are inclusive */
+typedef struct {
+    uint32_t min;
+    uint32_t max;
+} SubGhzBlockPwmRange;
+
+/** Range of durations within delta of te, same as DURATION_DIFF(x, te) < delta
+ *
+ * Expands to a constant expression, so the limits are computed at compile time.
+ */
+#define SUBGHZ_BLOCK_PWM_RANGE(te, delta)                   \
+    {                                                       \
+        .min = ((te) > (delta)) ? ((te) - (delta) + 1) : 0, \
+        .max = (te) + (delta) - 1,                          \
+    }
+
+typedef enum {
+    SubGhzBlockPwmOrderGapPulse, /**< bit is a gap and a pulse, a long gap ends the frame */
+    SubGhzBlockPwmOrderPulseGap, /**< bit is a pulse and a gap, the last gap ends the frame */
+} SubGhzBlockPwmOrder;
+
+typedef enum {
+    SubGhzBlockPwmStepReset = 0,
+    SubGhzBlockPwmStepFoundStartBit,
+    SubGhzBlockPwmStepSaveDuration,
+    SubGhzBlockPwmStepCheckDuration,
+} SubGhzBlockPwmStep;
+
+/** Timing description of a PWM protocol
+ *
+ * Frame: header gap, optional start pulse, bits, frame gap. A bit is a short
+ * and a long element (0) or a long and a short element (1), the first element
+ * is a gap or a pulse depending on the order.
+ */
+typedef struct {
+    SubGhzBlockPwmRange header; /**< gap before the first frame */
+    SubGhzBlockPwmRange start; /**< start pulse of each frame, max is 0 if there is none */
+    SubGhzBlockPwmRange te_short;
+    SubGhzBlockPwmRange te_long;
+    uint32_t frame_gap; /**< gap this long or longer ends the frame */
+    bool frame_gap_is_header; /**< frame gap must also match the header */
+    SubGhzBlockPwmOrder order;
+    bool invert; /**< short then long element is 1 instead of 0 */
+    uint8_t count_bit_min;
+    uint8_t count_bit_max;
+} SubGhzBlockPwm;
+
+/**
+ * Feed level and duration to the PWM decoder.
+ * On success the frame is left in decode_data and decode_count_bit.
+ * @param pwm Pointer to a SubGhzBlockPwm protocol description
+ * @param decoder Pointer to a SubGhzBlockDecoder instance
+ * @param level Signal level true-high false-low
+ * @param duration Level duration in microseconds
+ * @return true if a frame with a valid bit count was received
+ */
+bool subghz_protocol_blocks_pwm_feed(
+    const SubGhzBlockPwm* pwm,
+    SubGhzBlockDecoder* decoder,
+    bool level,
+    uint32_t duration);
+
+#ifdef __cplusplus
+}
+#endif
@@ -3,6 +3,7 @@
 #include "../blocks/decoder.h"
 #include "../blocks/encoder.h"
 #include "../blocks/generic.h"
+#include "../blocks/pwm.h"
 #include "../blocks/math.h"
 
 #define TAG "SubGhzProtocolAnsonic"
@@ -14,11 +15,28 @@
         (dip & 0x0020 ? '1' : '0'), (dip & 0x0010 ? '1' : '0'), (dip & 0x0001 ? '1' : '0'), \
         (dip & 0x0008 ? '1' : '0')
 
+#define ANSONIC_TE_SHORT      555
+#define ANSONIC_TE_LONG       1111
+#define ANSONIC_TE_DELTA      120
+#define ANSONIC_MIN_COUNT_BIT 12
+
 static const SubGhzBlockConst subghz_protocol_ansonic_const = {
-    .te_short = 555,
-    .te_long = 1111,
-    .te_delta = 120,
-    .min_count_bit_for_found = 12,
+    .te_short = ANSONIC_TE_SHORT,
+    .te_long = ANSONIC_TE_LONG,
+    .te_delta = ANSONIC_TE_DELTA,
+    .min_count_bit_for_found = ANSONIC_MIN_COUNT_BIT,
+};
+
+static const SubGhzBlockPwm subghz_protocol_ansonic_pwm = {
+    .header = SUBGHZ_BLOCK_PWM_RANGE(ANSONIC_TE_SHORT * 35, ANSONIC_TE_DELTA * 35),
+    .start = SUBGHZ_BLOCK_PWM_RANGE(ANSONIC_TE_SHORT, ANSONIC_TE_DELTA),
+    .te_short = SUBGHZ_BLOCK_PWM_RANGE(ANSONIC_TE_SHORT, ANSONIC_TE_DELTA),
+    .te_long = SUBGHZ_BLOCK_PWM_RANGE(ANSONIC_TE_LONG, ANSONIC_TE_DELTA),
+    .frame_gap = ANSONIC_TE_SHORT * 4,
+    .invert = true,
+    .order = SubGhzBlockPwmOrderGapPulse,
+    .count_bit_min = ANSONIC_MIN_COUNT_BIT,
+    .count_bit_max = UINT8_MAX,
 };
 
 struct SubGhzProtocolDecoderAnsonic {
@@ -35,13 +53,6 @@ struct SubGhzProtocolEncoderAnsonic {
     SubGhzBlockGeneric generic;
 };
 
-typedef enum {
-    AnsonicDecoderStepReset = 0,
-    AnsonicDecoderStepFoundStartBit,
-    AnsonicDecoderStepSaveDuration,
-    AnsonicDecoderStepCheckDuration,
-} AnsonicDecoderStep;
-
 const SubGhzProtocolDecoder subghz_protocol_ansonic_decoder = {
     .alloc = subghz_protocol_decoder_ansonic_alloc,
     .free = subghz_protocol_decoder_ansonic_free,
@@ -204,78 +215,23 @@ void subghz_protocol_decoder_ansonic_free(void* context) {
 void subghz_protocol_decoder_ansonic_reset(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderAnsonic* instance = context;
-    instance->decoder.parser_step = AnsonicDecoderStepReset;
+    instance->decoder.parser_step = SubGhzBlockPwmStepReset;
 }
 
 void subghz_protocol_decoder_ansonic_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderAnsonic* instance = context;
 
-    switch(instance->decoder.parser_step) {
-    case AnsonicDecoderStepReset:
-        if((!level) && (DURATION_DIFF(duration, subghz_protocol_ansonic_const.te_short * 35) <
-                        subghz_protocol_ansonic_const.te_delta * 35)) {
-            //Found header Ansonic
-            instance->decoder.parser_step = AnsonicDecoderStepFoundStartBit;
-        }
-        break;
-    case AnsonicDecoderStepFoundStartBit:
-        if(!level) {
-            break;
-        } else if(
-            DURATION_DIFF(duration, subghz_protocol_ansonic_const.te_short) <
-            subghz_protocol_ansonic_const.te_delta) {
-            //Found start bit Ansonic
-            instance->decoder.parser_step = AnsonicDecoderStepSaveDuration;
-            instance->decoder.decode_data = 0;
-            instance->decoder.decode_count_bit = 0;
-        } else {
-            instance->decoder.parser_step = AnsonicDecoderStepReset;
-        }
-        break;
-    case AnsonicDecoderStepSaveDuration:
-        if(!level) { //save interval
-            if(duration >= (subghz_protocol_ansonic_const.te_short * 4)) {
-                instance->decoder.parser_step = AnsonicDecoderStepFoundStartBit;
-                if(instance->decoder.decode_count_bit >=
-                   subghz_protocol_ansonic_const.min_count_bit_for_found) {
-                    instance->generic.serial = 0x0;
-                    instance->generic.btn = 0x0;
-
-                    instance->generic.data = instance->decoder.decode_data;
-                    instance->generic.data_count_bit = instance->decoder.decode_count_bit;
-                    if(instance->base.callback)
-                        instance->base.callback(&instance->base, instance->base.context);
-                }
-                break;
-            }
-            instance->decoder.te_last = duration;
-            instance->decoder.parser_step = AnsonicDecoderStepCheckDuration;
-        } else {
-            instance->decoder.parser_step = AnsonicDecoderStepReset;
-        }
-        break;
-    case AnsonicDecoderStepCheckDuration:
-        if(level) {
-            if((DURATION_DIFF(instance->decoder.te_last, subghz_protocol_ansonic_const.te_short) <
-                subghz_protocol_ansonic_const.te_delta) &&
-               (DURATION_DIFF(duration, subghz_protocol_ansonic_const.te_long) <
-                subghz_protocol_ansonic_const.te_delta)) {
-                subghz_protocol_blocks_add_bit(&instance->decoder, 1);
-                instance->decoder.parser_step = AnsonicDecoderStepSaveDuration;
-            } else if(
-                (DURATION_DIFF(instance->decoder.te_last, subghz_protocol_ansonic_const.te_long) <
-                 subghz_protocol_ansonic_const.te_delta) &&
-                (DURATION_DIFF(duration, subghz_protocol_ansonic_const.te_short) <
-                 subghz_protocol_ansonic_const.te_delta)) {
-                subghz_protocol_blocks_add_bit(&instance->decoder, 0);
-                instance->decoder.parser_step = AnsonicDecoderStepSaveDuration;
-            } else
-                instance->decoder.parser_step = AnsonicDecoderStepReset;
-        } else {
-            instance->decoder.parser_step = AnsonicDecoderStepReset;
-        }
-        break;
+    if(subghz_protocol_blocks_pwm_feed(
+           &subghz_protocol_ansonic_pwm, &instance->decoder, level, duration)) {
+        instance->generic.serial = 0x0;
+        instance->generic.btn = 0x0;
+
+        instance->generic.data = instance->decoder.decode_data;
+        instance->generic.data_count_bit = instance->decoder.decode_count_bit;
+
+        if(instance->base.callback)
+            instance->base.callback(&instance->base, instance->base.context);
     }
 }
 
@@ -4,6 +4,7 @@
 #include "../blocks/decoder.h"
 #include "../blocks/encoder.h"
 #include "../blocks/generic.h"
+#include "../blocks/pwm.h"
 #include "../blocks/math.h"
 
 /*
@@ -21,11 +22,26 @@
 #define AIRFORCE_COUNT_BIT 18
 #define AIRFORCE_NAME      "Airforce"
 
+#define CAME_TE_SHORT 320
+#define CAME_TE_LONG  640
+#define CAME_TE_DELTA 150
+
 static const SubGhzBlockConst subghz_protocol_came_const = {
-    .te_short = 320,
-    .te_long = 640,
-    .te_delta = 150,
-    .min_count_bit_for_found = 12,
+    .te_short = CAME_TE_SHORT,
+    .te_long = CAME_TE_LONG,
+    .te_delta = CAME_TE_DELTA,
+    .min_count_bit_for_found = CAME_12_COUNT_BIT,
+};
+
+static const SubGhzBlockPwm subghz_protocol_came_pwm = {
+    .header = SUBGHZ_BLOCK_PWM_RANGE(CAME_TE_SHORT * 56, CAME_TE_DELTA * 47),
+    .start = SUBGHZ_BLOCK_PWM_RANGE(CAME_TE_SHORT, CAME_TE_DELTA),
+    .te_short = SUBGHZ_BLOCK_PWM_RANGE(CAME_TE_SHORT, CAME_TE_DELTA),
+    .te_long = SUBGHZ_BLOCK_PWM_RANGE(CAME_TE_LONG, CAME_TE_DELTA),
+    .frame_gap = CAME_TE_SHORT * 4,
+    .order = SubGhzBlockPwmOrderGapPulse,
+    .count_bit_min = CAME_12_COUNT_BIT,
+    .count_bit_max = PRASTEL_COUNT_BIT,
 };
 
 struct SubGhzProtocolDecoderCame {
@@ -42,13 +58,6 @@ struct SubGhzProtocolEncoderCame {
     SubGhzBlockGeneric generic;
 };
 
-typedef enum {
-    CameDecoderStepReset = 0,
-    CameDecoderStepFoundStartBit,
-    CameDecoderStepSaveDuration,
-    CameDecoderStepCheckDuration,
-} CameDecoderStep;
-
 const SubGhzProtocolDecoder subghz_protocol_came_decoder = {
     .alloc = subghz_protocol_decoder_came_alloc,
     .free = subghz_protocol_decoder_came_free,
@@ -233,81 +242,26 @@ void subghz_protocol_decoder_came_free(void* context) {
 void subghz_protocol_decoder_came_reset(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderCame* instance = context;
-    instance->decoder.parser_step = CameDecoderStepReset;
+    instance->decoder.parser_step = SubGhzBlockPwmStepReset;
 }
 
 void subghz_protocol_decoder_came_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderCame* instance = context;
-    switch(instance->decoder.parser_step) {
-    case CameDecoderStepReset:
-        if((!level) && (DURATION_DIFF(duration, subghz_protocol_came_const.te_short * 56) <
-                        subghz_protocol_came_const.te_delta * 47)) {
-            //Found header CAME
-            instance->decoder.parser_step = CameDecoderStepFoundStartBit;
-        }
-        break;
-    case CameDecoderStepFoundStartBit:
-        if(!level) {
-            break;
-        } else if(
-            DURATION_DIFF(duration, subghz_protocol_came_const.te_short) <
-            subghz_protocol_came_const.te_delta) {
-            //Found start bit CAME
-            instance->decoder.parser_step = CameDecoderStepSaveDuration;
-            instance->decoder.decode_data = 0;
-            instance->decoder.decode_count_bit = 0;
-        } else {
-            instance->decoder.parser_step = CameDecoderStepReset;
-        }
-        break;
-    case CameDecoderStepSaveDuration:
-        if(!level) { //save interval
-            if(duration >= (subghz_protocol_came_const.te_short * 4)) {
-                instance->decoder.parser_step = CameDecoderStepFoundStartBit;
-                if((instance->decoder.decode_count_bit ==
-                    subghz_protocol_came_const.min_count_bit_for_found) ||
-                   (instance->decoder.decode_count_bit == AIRFORCE_COUNT_BIT) ||
-                   (instance->decoder.decode_count_bit == PRASTEL_COUNT_BIT) ||
-                   (instance->decoder.decode_count_bit == CAME_24_COUNT_BIT)) {
-                    instance->generic.serial = 0x0;
-                    instance->generic.btn = 0x0;
-
-                    instance->generic.data = instance->decoder.decode_data;
-                    instance->generic.data_count_bit = instance->decoder.decode_count_bit;
-
-                    if(instance->base.callback)
-                        instance->base.callback(&instance->base, instance->base.context);
-                }
-                break;
-            }
-            instance->decoder.te_last = duration;
-            instance->decoder.parser_step = CameDecoderStepCheckDuration;
-        } else {
-            instance->decoder.parser_step = CameDecoderStepReset;
-        }
-        break;
-    case CameDecoderStepCheckDuration:
-        if(level) {
-            if((DURATION_DIFF(instance->decoder.te_last, subghz_protocol_came_const.te_short) <
-                subghz_protocol_came_const.te_delta) &&
-               (DURATION_DIFF(duration, subghz_protocol_came_const.te_long) <
-                subghz_protocol_came_const.te_delta)) {
-                subghz_protocol_blocks_add_bit(&instance->decoder, 0);
-                instance->decoder.parser_step = CameDecoderStepSaveDuration;
-            } else if(
-                (DURATION_DIFF(instance->decoder.te_last, subghz_protocol_came_const.te_long) <
-                 subghz_protocol_came_const.te_delta) &&
-                (DURATION_DIFF(duration, subghz_protocol_came_const.te_short) <
-                 subghz_protocol_came_const.te_delta)) {
-                subghz_protocol_blocks_add_bit(&instance->decoder, 1);
-                instance->decoder.parser_step = CameDecoderStepSaveDuration;
-            } else
-                instance->decoder.parser_step = CameDecoderStepReset;
-        } else {
-            instance->decoder.parser_step = CameDecoderStepReset;
-        }
-        break;
+    if(subghz_protocol_blocks_pwm_feed(
+           &subghz_protocol_came_pwm, &instance->decoder, level, duration) &&
+       (instance->decoder.decode_count_bit == CAME_12_COUNT_BIT ||
+        instance->decoder.decode_count_bit == AIRFORCE_COUNT_BIT ||
+        instance->decoder.decode_count_bit == CAME_24_COUNT_BIT ||
+        instance->decoder.decode_count_bit == PRASTEL_COUNT_BIT)) {
+        instance->generic.serial = 0x0;
+        instance->generic.btn = 0x0;
+
+        instance->generic.data = instance->decoder.decode_data;
+        instance->generic.data_count_bit = instance->decoder.decode_count_bit;
+
+        if(instance->base.callback)
+            instance->base.callback(&instance->base, instance->base.context);
     }
 }
 
@@ -4,15 +4,32 @@
 #include "../blocks/decoder.h"
 #include "../blocks/encoder.h"
 #include "../blocks/generic.h"
+#include "../blocks/pwm.h"
 #include "../blocks/math.h"
 
 #define TAG "SubGhzProtocolGateTx"
 
+#define GATE_TX_TE_SHORT      350
+#define GATE_TX_TE_LONG       700
+#define GATE_TX_TE_DELTA      100
+#define GATE_TX_MIN_COUNT_BIT 24
+
 static const SubGhzBlockConst subghz_protocol_gate_tx_const = {
-    .te_short = 350,
-    .te_long = 700,
-    .te_delta = 100,
-    .min_count_bit_for_found = 24,
+    .te_short = GATE_TX_TE_SHORT,
+    .te_long = GATE_TX_TE_LONG,
+    .te_delta = GATE_TX_TE_DELTA,
+    .min_count_bit_for_found = GATE_TX_MIN_COUNT_BIT,
+};
+
+static const SubGhzBlockPwm subghz_protocol_gate_tx_pwm = {
+    .header = SUBGHZ_BLOCK_PWM_RANGE(GATE_TX_TE_SHORT * 47, GATE_TX_TE_DELTA * 47),
+    .start = SUBGHZ_BLOCK_PWM_RANGE(GATE_TX_TE_LONG, GATE_TX_TE_DELTA * 3),
+    .te_short = SUBGHZ_BLOCK_PWM_RANGE(GATE_TX_TE_SHORT, GATE_TX_TE_DELTA),
+    .te_long = SUBGHZ_BLOCK_PWM_RANGE(GATE_TX_TE_LONG, GATE_TX_TE_DELTA * 3),
+    .frame_gap = GATE_TX_TE_SHORT * 10 + GATE_TX_TE_DELTA,
+    .order = SubGhzBlockPwmOrderGapPulse,
+    .count_bit_min = GATE_TX_MIN_COUNT_BIT,
+    .count_bit_max = GATE_TX_MIN_COUNT_BIT,
 };
 
 struct SubGhzProtocolDecoderGateTx {
@@ -29,13 +46,6 @@ struct SubGhzProtocolEncoderGateTx {
     SubGhzBlockGeneric generic;
 };
 
-typedef enum {
-    GateTXDecoderStepReset = 0,
-    GateTXDecoderStepFoundStartBit,
-    GateTXDecoderStepSaveDuration,
-    GateTXDecoderStepCheckDuration,
-} GateTXDecoderStep;
-
 const SubGhzProtocolDecoder subghz_protocol_gate_tx_decoder = {
     .alloc = subghz_protocol_decoder_gate_tx_alloc,
     .free = subghz_protocol_decoder_gate_tx_free,
@@ -196,76 +206,20 @@ void subghz_protocol_decoder_gate_tx_free(void* context) {
 void subghz_protocol_decoder_gate_tx_reset(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderGateTx* instance = context;
-    instance->decoder.parser_step = GateTXDecoderStepReset;
+    instance->decoder.parser_step = SubGhzBlockPwmStepReset;
 }
 
 void subghz_protocol_decoder_gate_tx_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderGateTx* instance = context;
 
-    switch(instance->decoder.parser_step) {
-    case GateTXDecoderStepReset:
-        if((!level) && (DURATION_DIFF(duration, subghz_protocol_gate_tx_const.te_short * 47) <
-                        subghz_protocol_gate_tx_const.te_delta * 47)) {
-            //Found Preambula
-            instance->decoder.parser_step = GateTXDecoderStepFoundStartBit;
-        }
-        break;
-    case GateTXDecoderStepFoundStartBit:
-        if(level && (DURATION_DIFF(duration, subghz_protocol_gate_tx_const.te_long) <
-                     subghz_protocol_gate_tx_const.te_delta * 3)) {
-            //Found start bit
-            instance->decoder.parser_step = GateTXDecoderStepSaveDuration;
-            instance->decoder.decode_data = 0;
-            instance->decoder.decode_count_bit = 0;
-        } else {
-            instance->decoder.parser_step = GateTXDecoderStepReset;
-        }
-        break;
-    case GateTXDecoderStepSaveDuration:
-        if(!level) {
-            if(duration >= ((uint32_t)subghz_protocol_gate_tx_const.te_short * 10 +
-                            subghz_protocol_gate_tx_const.te_delta)) {
-                instance->decoder.parser_step = GateTXDecoderStepFoundStartBit;
-                if(instance->decoder.decode_count_bit ==
-                   subghz_protocol_gate_tx_const.min_count_bit_for_found) {
-                    instance->generic.data = instance->decoder.decode_data;
-                    instance->generic.data_count_bit = instance->decoder.decode_count_bit;
-
-                    if(instance->base.callback)
-                        instance->base.callback(&instance->base, instance->base.context);
-                }
-                instance->decoder.decode_data = 0;
-                instance->decoder.decode_count_bit = 0;
-                break;
-            } else {
-                instance->decoder.te_last = duration;
-                instance->decoder.parser_step = GateTXDecoderStepCheckDuration;
-            }
-        }
-        break;
-    case GateTXDecoderStepCheckDuration:
-        if(level) {
-            if((DURATION_DIFF(instance->decoder.te_last, subghz_protocol_gate_tx_const.te_short) <
-                subghz_protocol_gate_tx_const.te_delta) &&
-               (DURATION_DIFF(duration, subghz_protocol_gate_tx_const.te_long) <
-                subghz_protocol_gate_tx_const.te_delta * 3)) {
-                subghz_protocol_blocks_add_bit(&instance->decoder, 0);
-                instance->decoder.parser_step = GateTXDecoderStepSaveDuration;
-            } else if(
-                (DURATION_DIFF(instance->decoder.te_last, subghz_protocol_gate_tx_const.te_long) <
-                 subghz_protocol_gate_tx_const.te_delta * 3) &&
-                (DURATION_DIFF(duration, subghz_protocol_gate_tx_const.te_short) <
-                 subghz_protocol_gate_tx_const.te_delta)) {
-                subghz_protocol_blocks_add_bit(&instance->decoder, 1);
-                instance->decoder.parser_step = GateTXDecoderStepSaveDuration;
-            } else {
-                instance->decoder.parser_step = GateTXDecoderStepReset;
-            }
-        } else {
-            instance->decoder.parser_step = GateTXDecoderStepReset;
-        }
-        break;
+    if(subghz_protocol_blocks_pwm_feed(
+           &subghz_protocol_gate_tx_pwm, &instance->decoder, level, duration)) {
+        instance->generic.data = instance->decoder.decode_data;
+        instance->generic.data_count_bit = instance->decoder.decode_count_bit;
+
+        if(instance->base.callback)
+            instance->base.callback(&instance->base, instance->base.context);
     }
 }
 
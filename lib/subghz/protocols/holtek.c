@@ -4,6 +4,7 @@
 #include "../blocks/decoder.h"
 #include "../blocks/encoder.h"
 #include "../blocks/generic.h"
+#include "../blocks/pwm.h"
 #include "../blocks/math.h"
 
 /*
@@ -18,11 +19,27 @@
 #define HOLTEK_HEADER_MASK 0xF000000000
 #define HOLTEK_HEADER      0x5000000000
 
+#define HOLTEK_TE_SHORT      430
+#define HOLTEK_TE_LONG       870
+#define HOLTEK_TE_DELTA      100
+#define HOLTEK_MIN_COUNT_BIT 40
+
 static const SubGhzBlockConst subghz_protocol_holtek_const = {
-    .te_short = 430,
-    .te_long = 870,
-    .te_delta = 100,
-    .min_count_bit_for_found = 40,
+    .te_short = HOLTEK_TE_SHORT,
+    .te_long = HOLTEK_TE_LONG,
+    .te_delta = HOLTEK_TE_DELTA,
+    .min_count_bit_for_found = HOLTEK_MIN_COUNT_BIT,
+};
+
+static const SubGhzBlockPwm subghz_protocol_holtek_pwm = {
+    .header = SUBGHZ_BLOCK_PWM_RANGE(HOLTEK_TE_SHORT * 36, HOLTEK_TE_DELTA * 36),
+    .start = SUBGHZ_BLOCK_PWM_RANGE(HOLTEK_TE_SHORT, HOLTEK_TE_DELTA),
+    .te_short = SUBGHZ_BLOCK_PWM_RANGE(HOLTEK_TE_SHORT, HOLTEK_TE_DELTA),
+    .te_long = SUBGHZ_BLOCK_PWM_RANGE(HOLTEK_TE_LONG, HOLTEK_TE_DELTA * 2),
+    .frame_gap = HOLTEK_TE_SHORT * 10 + HOLTEK_TE_DELTA,
+    .order = SubGhzBlockPwmOrderGapPulse,
+    .count_bit_min = HOLTEK_MIN_COUNT_BIT,
+    .count_bit_max = HOLTEK_MIN_COUNT_BIT,
 };
 
 struct SubGhzProtocolDecoderHoltek {
@@ -39,13 +56,6 @@ struct SubGhzProtocolEncoderHoltek {
     SubGhzBlockGeneric generic;
 };
 
-typedef enum {
-    HoltekDecoderStepReset = 0,
-    HoltekDecoderStepFoundStartBit,
-    HoltekDecoderStepSaveDuration,
-    HoltekDecoderStepCheckDuration,
-} HoltekDecoderStep;
-
 const SubGhzProtocolDecoder subghz_protocol_holtek_decoder = {
     .alloc = subghz_protocol_decoder_holtek_alloc,
     .free = subghz_protocol_decoder_holtek_free,
@@ -209,82 +219,21 @@ void subghz_protocol_decoder_holtek_free(void* context) {
 void subghz_protocol_decoder_holtek_reset(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderHoltek* instance = context;
-    instance->decoder.parser_step = HoltekDecoderStepReset;
+    instance->decoder.parser_step = SubGhzBlockPwmStepReset;
 }
 
 void subghz_protocol_decoder_holtek_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderHoltek* instance = context;
 
-    switch(instance->decoder.parser_step) {
-    case HoltekDecoderStepReset:
-        if((!level) && (DURATION_DIFF(duration, subghz_protocol_holtek_const.te_short * 36) <
-                        subghz_protocol_holtek_const.te_delta * 36)) {
-            //Found Preambula
-            instance->decoder.parser_step = HoltekDecoderStepFoundStartBit;
-        }
-        break;
-    case HoltekDecoderStepFoundStartBit:
-        if((level) && (DURATION_DIFF(duration, subghz_protocol_holtek_const.te_short) <
-                       subghz_protocol_holtek_const.te_delta)) {
-            //Found StartBit
-            instance->decoder.parser_step = HoltekDecoderStepSaveDuration;
-            instance->decoder.decode_data = 0;
-            instance->decoder.decode_count_bit = 0;
-        } else {
-            instance->decoder.parser_step = HoltekDecoderStepReset;
-        }
-        break;
-    case HoltekDecoderStepSaveDuration:
-        //save duration
-        if(!level) {
-            if(duration >= ((uint32_t)subghz_protocol_holtek_const.te_short * 10 +
-                            subghz_protocol_holtek_const.te_delta)) {
-                if(instance->decoder.decode_count_bit ==
-                   subghz_protocol_holtek_const.min_count_bit_for_found) {
-                    if((instance->decoder.decode_data & HOLTEK_HEADER_MASK) == HOLTEK_HEADER) {
-                        instance->generic.data = instance->decoder.decode_data;
-                        instance->generic.data_count_bit = instance->decoder.decode_count_bit;
-
-                        if(instance->base.callback)
-                            instance->base.callback(&instance->base, instance->base.context);
-                    }
-                }
-                instance->decoder.decode_data = 0;
-                instance->decoder.decode_count_bit = 0;
-                instance->decoder.parser_step = HoltekDecoderStepFoundStartBit;
-                break;
-            } else {
-                instance->decoder.te_last = duration;
-
-                instance->decoder.parser_step = HoltekDecoderStepCheckDuration;
-            }
-        } else {
-            instance->decoder.parser_step = HoltekDecoderStepReset;
-        }
-        break;
-    case HoltekDecoderStepCheckDuration:
-        if(level) {
-            if((DURATION_DIFF(instance->decoder.te_last, subghz_protocol_holtek_const.te_short) <
-                subghz_protocol_holtek_const.te_delta) &&
-               (DURATION_DIFF(duration, subghz_protocol_holtek_const.te_long) <
-                subghz_protocol_holtek_const.te_delta * 2)) {
-                subghz_protocol_blocks_add_bit(&instance->decoder, 0);
-                instance->decoder.parser_step = HoltekDecoderStepSaveDuration;
-            } else if(
-                (DURATION_DIFF(instance->decoder.te_last, subghz_protocol_holtek_const.te_long) <
-                 subghz_protocol_holtek_const.te_delta * 2) &&
-                (DURATION_DIFF(duration, subghz_protocol_holtek_const.te_short) <
-                 subghz_protocol_holtek_const.te_delta)) {
-                subghz_protocol_blocks_add_bit(&instance->decoder, 1);
-                instance->decoder.parser_step = HoltekDecoderStepSaveDuration;
-            } else {
-                instance->decoder.parser_step = HoltekDecoderStepReset;
-            }
-        } else {
-            instance->decoder.parser_step = HoltekDecoderStepReset;
-        }
-        break;
+    if(subghz_protocol_blocks_pwm_feed(
+           &subghz_protocol_holtek_pwm, &instance->decoder, level, duration) &&
+       (instance->decoder.decode_data & HOLTEK_HEADER_MASK) == HOLTEK_HEADER) {
+        instance->generic.data = instance->decoder.decode_data;
+        instance->generic.data_count_bit = instance->decoder.decode_count_bit;
+
+        if(instance->base.callback)
+            instance->base.callback(&instance->base, instance->base.context);
     }
 }
 
@@ -4,6 +4,7 @@
 #include "../blocks/decoder.h"
 #include "../blocks/encoder.h"
 #include "../blocks/generic.h"
+#include "../blocks/pwm.h"
 #include "../blocks/math.h"
 
 #define TAG "SubGhzProtocolLinear"
@@ -15,11 +16,27 @@
         (dip & 0x0008 ? '1' : '0'), (dip & 0x0004 ? '1' : '0'), (dip & 0x0002 ? '1' : '0'), \
         (dip & 0x0001 ? '1' : '0')
 
+#define LINEAR_TE_SHORT      500
+#define LINEAR_TE_LONG       1500
+#define LINEAR_TE_DELTA      150
+#define LINEAR_MIN_COUNT_BIT 10
+
 static const SubGhzBlockConst subghz_protocol_linear_const = {
-    .te_short = 500,
-    .te_long = 1500,
-    .te_delta = 150,
-    .min_count_bit_for_found = 10,
+    .te_short = LINEAR_TE_SHORT,
+    .te_long = LINEAR_TE_LONG,
+    .te_delta = LINEAR_TE_DELTA,
+    .min_count_bit_for_found = LINEAR_MIN_COUNT_BIT,
+};
+
+static const SubGhzBlockPwm subghz_protocol_linear_pwm = {
+    .header = SUBGHZ_BLOCK_PWM_RANGE(LINEAR_TE_SHORT * 42, LINEAR_TE_DELTA * 20),
+    .te_short = SUBGHZ_BLOCK_PWM_RANGE(LINEAR_TE_SHORT, LINEAR_TE_DELTA),
+    .te_long = SUBGHZ_BLOCK_PWM_RANGE(LINEAR_TE_LONG, LINEAR_TE_DELTA),
+    .frame_gap = LINEAR_TE_SHORT * 5,
+    .frame_gap_is_header = true,
+    .order = SubGhzBlockPwmOrderPulseGap,
+    .count_bit_min = LINEAR_MIN_COUNT_BIT,
+    .count_bit_max = LINEAR_MIN_COUNT_BIT,
 };
 
 struct SubGhzProtocolDecoderLinear {
@@ -36,12 +53,6 @@ struct SubGhzProtocolEncoderLinear {
     SubGhzBlockGeneric generic;
 };
 
-typedef enum {
-    LinearDecoderStepReset = 0,
-    LinearDecoderStepSaveDuration,
-    LinearDecoderStepCheckDuration,
-} LinearDecoderStep;
-
 const SubGhzProtocolDecoder subghz_protocol_linear_decoder = {
     .alloc = subghz_protocol_decoder_linear_alloc,
     .free = subghz_protocol_decoder_linear_free,
@@ -214,82 +225,22 @@ void subghz_protocol_decoder_linear_free(void* context) {
 void subghz_protocol_decoder_linear_reset(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderLinear* instance = context;
-    instance->decoder.parser_step = LinearDecoderStepReset;
+    instance->decoder.parser_step = SubGhzBlockPwmStepReset;
 }
 
 void subghz_protocol_decoder_linear_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderLinear* instance = context;
-    switch(instance->decoder.parser_step) {
-    case LinearDecoderStepReset:
-        if((!level) && (DURATION_DIFF(duration, subghz_protocol_linear_const.te_short * 42) <
-                        subghz_protocol_linear_const.te_delta * 20)) {
-            //Found header Linear
-            instance->decoder.decode_data = 0;
-            instance->decoder.decode_count_bit = 0;
-            instance->decoder.parser_step = LinearDecoderStepSaveDuration;
-        }
-        break;
-    case LinearDecoderStepSaveDuration:
-        if(level) {
-            instance->decoder.te_last = duration;
-            instance->decoder.parser_step = LinearDecoderStepCheckDuration;
-        } else {
-            instance->decoder.parser_step = LinearDecoderStepReset;
-        }
-        break;
-    case LinearDecoderStepCheckDuration:
-        if(!level) { //save interval
-            if(duration >= (subghz_protocol_linear_const.te_short * 5)) {
-                instance->decoder.parser_step = LinearDecoderStepReset;
-                //checking that the duration matches the guardtime
-                if(DURATION_DIFF(duration, subghz_protocol_linear_const.te_short * 42) >
-                   subghz_protocol_linear_const.te_delta * 20) {
-                    break;
-                }
-                if(DURATION_DIFF(instance->decoder.te_last, subghz_protocol_linear_const.te_short) <
-                   subghz_protocol_linear_const.te_delta) {
-                    subghz_protocol_blocks_add_bit(&instance->decoder, 0);
-                } else if(
-                    DURATION_DIFF(instance->decoder.te_last, subghz_protocol_linear_const.te_long) <
-                    subghz_protocol_linear_const.te_delta) {
-                    subghz_protocol_blocks_add_bit(&instance->decoder, 1);
-                }
-                if(instance->decoder.decode_count_bit ==
-                   subghz_protocol_linear_const.min_count_bit_for_found) {
-                    instance->generic.serial = 0x0;
-                    instance->generic.btn = 0x0;
-
-                    instance->generic.data = instance->decoder.decode_data;
-                    instance->generic.data_count_bit = instance->decoder.decode_count_bit;
-
-                    if(instance->base.callback)
-                        instance->base.callback(&instance->base, instance->base.context);
-                }
-                break;
-            }
-
-            if((DURATION_DIFF(instance->decoder.te_last, subghz_protocol_linear_const.te_short) <
-                subghz_protocol_linear_const.te_delta) &&
-               (DURATION_DIFF(duration, subghz_protocol_linear_const.te_long) <
-                subghz_protocol_linear_const.te_delta)) {
-                subghz_protocol_blocks_add_bit(&instance->decoder, 0);
-                instance->decoder.parser_step = LinearDecoderStepSaveDuration;
-            } else if(
-                (DURATION_DIFF(instance->decoder.te_last, subghz_protocol_linear_const.te_long) <
-                 subghz_protocol_linear_const.te_delta) &&
-                (DURATION_DIFF(duration, subghz_protocol_linear_const.te_short) <
-                 subghz_protocol_linear_const.te_delta)) {
-                subghz_protocol_blocks_add_bit(&instance->decoder, 1);
-                instance->decoder.parser_step = LinearDecoderStepSaveDuration;
-            } else {
-                instance->decoder.parser_step = LinearDecoderStepReset;
-            }
+    if(subghz_protocol_blocks_pwm_feed(
+           &subghz_protocol_linear_pwm, &instance->decoder, level, duration)) {
+        instance->generic.serial = 0x0;
+        instance->generic.btn = 0x0;
 
-        } else {
-            instance->decoder.parser_step = LinearDecoderStepReset;
-        }
-        break;
+        instance->generic.data = instance->decoder.decode_data;
+        instance->generic.data_count_bit = instance->decoder.decode_count_bit;
+
+        if(instance->base.callback)
+            instance->base.callback(&instance->base, instance->base.context);
     }
 }
 
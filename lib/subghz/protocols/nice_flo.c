@@ -3,15 +3,32 @@
 #include "../blocks/decoder.h"
 #include "../blocks/encoder.h"
 #include "../blocks/generic.h"
+#include "../blocks/pwm.h"
 #include "../blocks/math.h"
 
 #define TAG "SubGhzProtocolNiceFlo"
 
+#define NICE_FLO_TE_SHORT      700
+#define NICE_FLO_TE_LONG       1400
+#define NICE_FLO_TE_DELTA      200
+#define NICE_FLO_MIN_COUNT_BIT 12
+
 static const SubGhzBlockConst subghz_protocol_nice_flo_const = {
-    .te_short = 700,
-    .te_long = 1400,
-    .te_delta = 200,
-    .min_count_bit_for_found = 12,
+    .te_short = NICE_FLO_TE_SHORT,
+    .te_long = NICE_FLO_TE_LONG,
+    .te_delta = NICE_FLO_TE_DELTA,
+    .min_count_bit_for_found = NICE_FLO_MIN_COUNT_BIT,
+};
+
+static const SubGhzBlockPwm subghz_protocol_nice_flo_pwm = {
+    .header = SUBGHZ_BLOCK_PWM_RANGE(NICE_FLO_TE_SHORT * 36, NICE_FLO_TE_DELTA * 36),
+    .start = SUBGHZ_BLOCK_PWM_RANGE(NICE_FLO_TE_SHORT, NICE_FLO_TE_DELTA),
+    .te_short = SUBGHZ_BLOCK_PWM_RANGE(NICE_FLO_TE_SHORT, NICE_FLO_TE_DELTA),
+    .te_long = SUBGHZ_BLOCK_PWM_RANGE(NICE_FLO_TE_LONG, NICE_FLO_TE_DELTA),
+    .frame_gap = NICE_FLO_TE_SHORT * 4,
+    .order = SubGhzBlockPwmOrderGapPulse,
+    .count_bit_min = NICE_FLO_MIN_COUNT_BIT,
+    .count_bit_max = UINT8_MAX,
 };
 
 struct SubGhzProtocolDecoderNiceFlo {
@@ -28,13 +45,6 @@ struct SubGhzProtocolEncoderNiceFlo {
     SubGhzBlockGeneric generic;
 };
 
-typedef enum {
-    NiceFloDecoderStepReset = 0,
-    NiceFloDecoderStepFoundStartBit,
-    NiceFloDecoderStepSaveDuration,
-    NiceFloDecoderStepCheckDuration,
-} NiceFloDecoderStep;
-
 const SubGhzProtocolDecoder subghz_protocol_nice_flo_decoder = {
     .alloc = subghz_protocol_decoder_nice_flo_alloc,
     .free = subghz_protocol_decoder_nice_flo_free,
@@ -201,78 +211,23 @@ void subghz_protocol_decoder_nice_flo_free(void* context) {
 void subghz_protocol_decoder_nice_flo_reset(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderNiceFlo* instance = context;
-    instance->decoder.parser_step = NiceFloDecoderStepReset;
+    instance->decoder.parser_step = SubGhzBlockPwmStepReset;
 }
 
 void subghz_protocol_decoder_nice_flo_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderNiceFlo* instance = context;
 
-    switch(instance->decoder.parser_step) {
-    case NiceFloDecoderStepReset:
-        if((!level) && (DURATION_DIFF(duration, subghz_protocol_nice_flo_const.te_short * 36) <
-                        subghz_protocol_nice_flo_const.te_delta * 36)) {
-            //Found header Nice Flo
-            instance->decoder.parser_step = NiceFloDecoderStepFoundStartBit;
-        }
-        break;
-    case NiceFloDecoderStepFoundStartBit:
-        if(!level) {
-            break;
-        } else if(
-            DURATION_DIFF(duration, subghz_protocol_nice_flo_const.te_short) <
-            subghz_protocol_nice_flo_const.te_delta) {
-            //Found start bit Nice Flo
-            instance->decoder.parser_step = NiceFloDecoderStepSaveDuration;
-            instance->decoder.decode_data = 0;
-            instance->decoder.decode_count_bit = 0;
-        } else {
-            instance->decoder.parser_step = NiceFloDecoderStepReset;
-        }
-        break;
-    case NiceFloDecoderStepSaveDuration:
-        if(!level) { //save interval
-            if(duration >= (subghz_protocol_nice_flo_const.te_short * 4)) {
-                instance->decoder.parser_step = NiceFloDecoderStepFoundStartBit;
-                if(instance->decoder.decode_count_bit >=
-                   subghz_protocol_nice_flo_const.min_count_bit_for_found) {
-                    instance->generic.serial = 0x0;
-                    instance->generic.btn = 0x0;
-
-                    instance->generic.data = instance->decoder.decode_data;
-                    instance->generic.data_count_bit = instance->decoder.decode_count_bit;
-                    if(instance->base.callback)
-                        instance->base.callback(&instance->base, instance->base.context);
-                }
-                break;
-            }
-            instance->decoder.te_last = duration;
-            instance->decoder.parser_step = NiceFloDecoderStepCheckDuration;
-        } else {
-            instance->decoder.parser_step = NiceFloDecoderStepReset;
-        }
-        break;
-    case NiceFloDecoderStepCheckDuration:
-        if(level) {
-            if((DURATION_DIFF(instance->decoder.te_last, subghz_protocol_nice_flo_const.te_short) <
-                subghz_protocol_nice_flo_const.te_delta) &&
-               (DURATION_DIFF(duration, subghz_protocol_nice_flo_const.te_long) <
-                subghz_protocol_nice_flo_const.te_delta)) {
-                subghz_protocol_blocks_add_bit(&instance->decoder, 0);
-                instance->decoder.parser_step = NiceFloDecoderStepSaveDuration;
-            } else if(
-                (DURATION_DIFF(instance->decoder.te_last, subghz_protocol_nice_flo_const.te_long) <
-                 subghz_protocol_nice_flo_const.te_delta) &&
-                (DURATION_DIFF(duration, subghz_protocol_nice_flo_const.te_short) <
-                 subghz_protocol_nice_flo_const.te_delta)) {
-                subghz_protocol_blocks_add_bit(&instance->decoder, 1);
-                instance->decoder.parser_step = NiceFloDecoderStepSaveDuration;
-            } else
-                instance->decoder.parser_step = NiceFloDecoderStepReset;
-        } else {
-            instance->decoder.parser_step = NiceFloDecoderStepReset;
-        }
-        break;
+    if(subghz_protocol_blocks_pwm_feed(
+           &subghz_protocol_nice_flo_pwm, &instance->decoder, level, duration)) {
+        instance->generic.serial = 0x0;
+        instance->generic.btn = 0x0;
+
+        instance->generic.data = instance->decoder.decode_data;
+        instance->generic.data_count_bit = instance->decoder.decode_count_bit;
+
+        if(instance->base.callback)
+            instance->base.callback(&instance->base, instance->base.context);
     }
 }
 
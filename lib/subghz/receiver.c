@@ -3,6 +3,7 @@
 #include "registry.h"
 
 #include <m-array.h>
+#include <toolbox/profiler.h>
 
 typedef struct {
     SubGhzProtocolEncoderBase* base;
@@ -61,6 +62,8 @@ void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t durat
     furi_check(instance);
     furi_check(instance->slots);
 
+    PROFILER_ZONE("subghz_receiver_decode");
+
     for
         M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
             if((slot->base->protocol->flag & instance->filter) != 0) {
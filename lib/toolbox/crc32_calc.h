@@ -7,6 +7,41 @@
 extern "C" {
 #endif
 
+/** CRC32 calculation engine */
+typedef enum {
+    Crc32EngineAuto, /**< Slicing8, peripheral is shared with BT and only used on request */
+    Crc32EngineNibble, /**< 4-bit table, two table steps per byte */
+    Crc32EngineSlicing8, /**< Slicing-by-8 tables, 8 bytes per step */
+    Crc32EngineHardware, /**< CRC peripheral, waits for it, Slicing8 if it is not usable */
+
+    Crc32EngineNum,
+} Crc32Engine;
+
+/** Set engine used by crc32_calc_buffer and crc32_calc_file
+ *
+ * @param      engine  CRC32 engine
+ */
+void crc32_calc_set_engine(Crc32Engine engine);
+
+/** Get engine used by crc32_calc_buffer and crc32_calc_file
+ *
+ * @return     CRC32 engine
+ */
+Crc32Engine crc32_calc_get_engine(void);
+
+/** Calculate CRC32 with specified engine
+ *
+ * All engines give the same result.
+ *
+ * @param      engine  CRC32 engine
+ * @param      crc     previous CRC value, 0 for new calculation
+ * @param      buffer  data
+ * @param      size    data size
+ *
+ * @return     CRC value
+ */
+uint32_t crc32_calc_buffer_ex(Crc32Engine engine, uint32_t crc, const void* buffer, size_t size);
+
 uint32_t crc32_calc_buffer(uint32_t crc, const void* buffer, size_t size);
 
 typedef void (*FileCrcProgressCb)(const uint8_t progress, void* context);
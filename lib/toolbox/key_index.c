@@ -0,0 +1,353 @@
+#include "key_index.h"
+
+#include <furi.h>
+#include <toolbox/hex.h>
+#include <toolbox/stream/buffered_file_stream.h>
+
+#define TAG "KeyIndex"
+
+#define KEY_INDEX_MAGIC    (0x58444946UL)
+#define KEY_INDEX_VERSION  (2)
+#define KEY_INDEX_KEY_SIZE (16)
+
+#define KEY_INDEX_SOURCE_HEADER_LINES (2)
+#define KEY_INDEX_SOURCE_SEPARATOR    ": "
+
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t key_size;
+    uint16_t count;
+    uint32_t source_size;
+    uint32_t source_modified; /**< 0 if index is built before source is installed */
+} FURI_PACKED KeyIndexHeader;
+
+typedef struct {
+    uint8_t key_size;
+    uint8_t value_size;
+    uint16_t value_offset;
+    uint8_t key[KEY_INDEX_KEY_SIZE];
+} FURI_PACKED KeyIndexEntry;
+
+typedef struct {
+    KeyIndexEntry entry;
+    uint32_t order; /**< position in source, first occurrence wins */
+    uint32_t value_position; /**< value offset in source */
+} KeyIndexSourceEntry;
+
+static int key_index_compare(
+    const uint8_t* key,
+    size_t key_size,
+    const uint8_t* other,
+    size_t other_size) {
+    int result = memcmp(key, other, MIN(key_size, other_size));
+    if(result == 0) {
+        result = (int)key_size - (int)other_size;
+    }
+    return result;
+}
+
+static KeyIndexStatus key_index_search(
+    File* file,
+    const KeyIndexHeader* header,
+    const uint8_t* key,
+    size_t key_size,
+    FuriString* value) {
+    // Entry is stored with key truncated to key size from header
+    const size_t entry_size = sizeof(KeyIndexEntry) - KEY_INDEX_KEY_SIZE + header->key_size;
+    const size_t pool_offset = sizeof(KeyIndexHeader) + header->count * entry_size;
+
+    KeyIndexEntry entry;
+    size_t low = 0;
+    size_t high = header->count;
+
+    while(low < high) {
+        const size_t middle = low + (high - low) / 2;
+        if(!storage_file_seek(file, sizeof(KeyIndexHeader) + middle * entry_size, true)) {
+            return KeyIndexStatusError;
+        }
+        if(storage_file_read(file, &entry, entry_size) != entry_size) {
+            return KeyIndexStatusError;
+        }
+        if(entry.key_size > header->key_size) {
+            return KeyIndexStatusError;
+        }
+
+        const int result = key_index_compare(entry.key, entry.key_size, key, key_size);
+        if(result < 0) {
+            low = middle + 1;
+        } else if(result > 0) {
+            high = middle;
+        } else {
+            char buffer[UINT8_MAX];
+            if(!storage_file_seek(file, pool_offset + entry.value_offset, true)) {
+                return KeyIndexStatusError;
+            }
+            if(storage_file_read(file, buffer, entry.value_size) != entry.value_size) {
+                return KeyIndexStatusError;
+            }
+            furi_string_set_strn(value, buffer, entry.value_size);
+            return KeyIndexStatusOk;
+        }
+    }
+
+    return KeyIndexStatusNotFound;
+}
+
+static int key_index_source_entry_compare(const void* a, const void* b) {
+    const KeyIndexSourceEntry* entry_a = a;
+    const KeyIndexSourceEntry* entry_b = b;
+
+    int result = key_index_compare(
+        entry_a->entry.key, entry_a->entry.key_size, entry_b->entry.key, entry_b->entry.key_size);
+    if(result == 0) {
+        result = (entry_a->order > entry_b->order) - (entry_a->order < entry_b->order);
+    }
+    return result;
+}
+
+static bool key_index_source_stat(
+    Storage* storage,
+    const char* source_path,
+    uint32_t* size,
+    uint32_t* modified) {
+    FileInfo info;
+    if(storage_common_stat(storage, source_path, &info) != FSE_OK) return false;
+    if(storage_common_modified(storage, source_path, modified) != FSE_OK) return false;
+    *size = info.size;
+    return true;
+}
+
+static bool key_index_parse_line(
+    FuriString* line,
+    uint32_t position,
+    uint32_t order,
+    KeyIndexSourceEntry* source_entry) {
+    furi_string_trim(line, "\n");
+    const char* line_str = furi_string_get_cstr(line);
+    if(line_str[0] == '\0' || line_str[0] == '#') return false;
+
+    const size_t separator = furi_string_search_str(line, KEY_INDEX_SOURCE_SEPARATOR);
+    if(separator == FURI_STRING_FAILURE || separator % 2 ||
+       separator / 2 > KEY_INDEX_KEY_SIZE) {
+        return false;
+    }
+    const size_t value_start = separator + strlen(KEY_INDEX_SOURCE_SEPARATOR);
+    const size_t value_size = furi_string_size(line) - value_start;
+    if(value_size > UINT8_MAX) return false;
+
+    KeyIndexEntry* entry = &source_entry->entry;
+    memset(entry, 0, sizeof(KeyIndexEntry));
+    for(size_t i = 0; i < separator / 2; i++) {
+        if(!hex_char_to_uint8(line_str[i * 2], line_str[i * 2 + 1], &entry->key[i])) {
+            return false;
+        }
+    }
+    entry->key_size = separator / 2;
+    entry->value_size = value_size;
+    source_entry->order = order;
+    source_entry->value_position = position + value_start;
+
+    return true;
+}
+
+static size_t key_index_read_source(Stream* stream, KeyIndexSourceEntry** entries) {
+    FuriString* line = furi_string_alloc();
+    size_t capacity = 0;
+    size_t count = 0;
+    uint32_t line_num = 0;
+
+    while(true) {
+        const uint32_t position = stream_tell(stream);
+        if(!stream_read_line(stream, line)) break;
+        // Filetype and version are checked by the text lookup
+        if(line_num++ < KEY_INDEX_SOURCE_HEADER_LINES) continue;
+
+        if(count == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            *entries = realloc(*entries, capacity * sizeof(KeyIndexSourceEntry)); //-V701
+        }
+        if(key_index_parse_line(line, position, line_num, &(*entries)[count])) {
+            count++;
+        }
+    }
+
+    furi_string_free(line);
+    return count;
+}
+
+static bool key_index_write(
+    File* file,
+    Stream* stream,
+    KeyIndexHeader* header,
+    const KeyIndexSourceEntry* entries,
+    size_t count) {
+    // Header is written last, so interrupted build leaves invalid index
+    const KeyIndexHeader empty_header = {0};
+    if(storage_file_write(file, &empty_header, sizeof(empty_header)) != sizeof(empty_header)) {
+        return false;
+    }
+
+    const size_t entry_size = sizeof(KeyIndexEntry) - KEY_INDEX_KEY_SIZE + header->key_size;
+    uint32_t pool_size = 0;
+    for(size_t i = 0; i < count; i++) {
+        if(pool_size > UINT16_MAX) return false;
+        KeyIndexEntry entry = entries[i].entry;
+        entry.value_offset = pool_size;
+        if(storage_file_write(file, &entry, entry_size) != entry_size) return false;
+        pool_size += entry.value_size;
+    }
+
+    char buffer[UINT8_MAX];
+    for(size_t i = 0; i < count; i++) {
+        const size_t value_size = entries[i].entry.value_size;
+        if(!stream_seek(stream, entries[i].value_position, StreamOffsetFromStart)) return false;
+        if(stream_read(stream, (uint8_t*)buffer, value_size) != value_size) return false;
+        if(storage_file_write(file, buffer, value_size) != value_size) return false;
+    }
+
+    return storage_file_seek(file, 0, true) &&
+           storage_file_write(file, header, sizeof(KeyIndexHeader)) == sizeof(KeyIndexHeader);
+}
+
+bool key_index_build(Storage* storage, const char* source_path, const char* path) {
+    furi_check(storage);
+    furi_check(source_path);
+    furi_check(path);
+
+    bool success = false;
+    Stream* stream = buffered_file_stream_alloc(storage);
+    File* file = storage_file_alloc(storage);
+    KeyIndexSourceEntry* entries = NULL;
+    KeyIndexHeader header = {
+        .magic = KEY_INDEX_MAGIC,
+        .version = KEY_INDEX_VERSION,
+    };
+
+    do {
+        uint32_t source_size;
+        uint32_t source_modified;
+        if(!key_index_source_stat(storage, source_path, &source_size, &source_modified)) break;
+        header.source_size = source_size;
+        header.source_modified = source_modified;
+        if(!buffered_file_stream_open(stream, source_path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+            break;
+        }
+
+        size_t count = key_index_read_source(stream, &entries);
+        if(count == 0) break;
+
+        // Same order as memcmp and length, duplicates resolve to the first occurrence
+        qsort(entries, count, sizeof(KeyIndexSourceEntry), key_index_source_entry_compare);
+        size_t unique = 0;
+        for(size_t i = 0; i < count; i++) {
+            if(unique && !key_index_compare(
+                             entries[i].entry.key,
+                             entries[i].entry.key_size,
+                             entries[unique - 1].entry.key,
+                             entries[unique - 1].entry.key_size)) {
+                continue;
+            }
+            header.key_size = MAX(header.key_size, entries[i].entry.key_size);
+            entries[unique++] = entries[i];
+        }
+        if(unique > UINT16_MAX) break;
+        header.count = unique;
+
+        if(!storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) break;
+        success = key_index_write(file, stream, &header, entries, unique);
+    } while(false);
+
+    if(!success) {
+        FURI_LOG_E(TAG, "Failed to build index %s from %s", path, source_path);
+    }
+
+    free(entries);
+    storage_file_free(file);
+    buffered_file_stream_close(stream);
+    stream_free(stream);
+
+    return success;
+}
+
+typedef enum {
+    KeyIndexOpenOk,
+    KeyIndexOpenStale, /**< Index does not match its source */
+    KeyIndexOpenError,
+} KeyIndexOpenResult;
+
+static KeyIndexOpenResult key_index_open(
+    Storage* storage,
+    File* file,
+    const char* path,
+    const char* source_path,
+    KeyIndexHeader* header) {
+    if(!storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        return source_path ? KeyIndexOpenStale : KeyIndexOpenError;
+    }
+    if(storage_file_read(file, header, sizeof(KeyIndexHeader)) != sizeof(KeyIndexHeader) ||
+       header->magic != KEY_INDEX_MAGIC || header->version != KEY_INDEX_VERSION) {
+        FURI_LOG_W(TAG, "Unsupported index: %s", path);
+        return source_path ? KeyIndexOpenStale : KeyIndexOpenError;
+    }
+    if(header->key_size > KEY_INDEX_KEY_SIZE) return KeyIndexOpenError;
+
+    uint32_t source_size;
+    uint32_t source_modified;
+    // Index without reachable source can't be checked, but is all there is
+    if(!source_path ||
+       !key_index_source_stat(storage, source_path, &source_size, &source_modified)) {
+        return KeyIndexOpenOk;
+    }
+    if(header->source_size != source_size) return KeyIndexOpenStale;
+    if(header->source_modified == source_modified) return KeyIndexOpenOk;
+    if(header->source_modified != 0) return KeyIndexOpenStale;
+
+    // Index built with resources: adopt time of the source installed along with it
+    storage_file_close(file);
+    header->source_modified = source_modified;
+    if(!storage_file_open(file, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING) ||
+       storage_file_write(file, header, sizeof(KeyIndexHeader)) != sizeof(KeyIndexHeader)) {
+        return KeyIndexOpenError;
+    }
+    return KeyIndexOpenOk;
+}
+
+KeyIndexStatus key_index_find(
+    Storage* storage,
+    const char* path,
+    const char* source_path,
+    const uint8_t* key,
+    size_t key_size,
+    FuriString* value) {
+    furi_check(storage);
+    furi_check(path);
+    furi_check(key);
+    furi_check(value);
+
+    KeyIndexStatus status = KeyIndexStatusError;
+    File* file = storage_file_alloc(storage);
+
+    do {
+        KeyIndexHeader header;
+        KeyIndexOpenResult result = key_index_open(storage, file, path, source_path, &header);
+        if(result == KeyIndexOpenStale) {
+            FURI_LOG_I(TAG, "Rebuilding stale index: %s", path);
+            if(storage_file_is_open(file)) storage_file_close(file);
+            if(!key_index_build(storage, source_path, path)) break;
+            result = key_index_open(storage, file, path, source_path, &header);
+        }
+        if(result != KeyIndexOpenOk) break;
+
+        if(key_size > header.key_size) {
+            status = KeyIndexStatusNotFound;
+            break;
+        }
+
+        status = key_index_search(file, &header, key, key_size, value);
+    } while(false);
+
+    storage_file_free(file);
+
+    return status;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file key_index.h
+ * @brief Binary search in compiled key-value index files
+ *
+ * Index is compiled at build time from Flipper Format key-value resources
+ * with hex keys (scripts/flipper/assets/keyindex.py) and placed next to the
+ * source file with `.idx` extension. It is rebuilt on device when it no longer
+ * matches the source. Layout, all numbers are little endian:
+ *
+ * - header: magic "FIDX", version (1 byte), key size (1 byte), count (2 bytes),
+ *   source size (4 bytes) and source modification time (4 bytes, 0 when index
+ *   is built with resources, set on first lookup against installed source)
+ * - table: count entries sorted by key, each entry is key length (1 byte),
+ *   value length (1 byte), value offset in pool (2 bytes) and key padded with
+ *   zeroes to key size
+ * - pool: values without terminators
+ *
+ * Lookup reads only the entries visited by binary search and the value.
+ */
+#pragma once
+
+#include <core/string.h>
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    KeyIndexStatusOk, /**< Key is found, value is set */
+    KeyIndexStatusNotFound, /**< Index is valid, but has no such key */
+    KeyIndexStatusError, /**< Index is missing or malformed */
+} KeyIndexStatus;
+
+/** Find value by key in index file
+ *
+ * If source path is given, index is checked against source size and
+ * modification time, missing or stale index is rebuilt from the source.
+ *
+ * @param      storage      Storage instance
+ * @param      path         path to index file
+ * @param      source_path  path to source file, NULL to use index as is
+ * @param      key          key bytes
+ * @param      key_size     key size in bytes
+ * @param      value        string to store value to
+ *
+ * @return     KeyIndexStatus, on error caller may fall back to source file
+ */
+KeyIndexStatus key_index_find(
+    Storage* storage,
+    const char* path,
+    const char* source_path,
+    const uint8_t* key,
+    size_t key_size,
+    FuriString* value);
+
+/** Build index file from key-value source file
+ *
+ * @param      storage      Storage instance
+ * @param      source_path  path to source file
+ * @param      path         path to index file, overwritten
+ *
+ * @return     true on success
+ */
+bool key_index_build(Storage* storage, const char* source_path, const char* path);
+
+#ifdef __cplusplus
+}
+#endif
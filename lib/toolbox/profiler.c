@@ -2,8 +2,12 @@
 #include <stdlib.h>
 #include <m-dict.h>
 #include <furi.h>
+#include <furi_hal.h>
 #include <furi_hal_gpio.h>
 
+#include <stm32wbxx_ll_lptim.h>
+#include <stm32wbxx_ll_rcc.h>
+
 typedef struct {
     uint32_t start;
     uint32_t length;
@@ -85,3 +89,294 @@ void profiler_dump(Profiler* profiler) {
         }
     }
 }
+
+/*
+ * Scoped zones
+ */
+
+static ProfilerZone* profiler_zones = NULL;
+static volatile bool profiler_zones_enabled = false;
+
+ProfilerZoneScope profiler_zone_enter(ProfilerZone* zone) {
+    ProfilerZoneScope scope = {.zone = NULL, .start = 0};
+
+    if(profiler_zones_enabled) {
+        scope.zone = zone;
+        scope.start = DWT->CYCCNT;
+    }
+
+    return scope;
+}
+
+void profiler_zone_leave(ProfilerZoneScope* scope) {
+    if(!scope->zone) return;
+
+    const uint32_t cycles = DWT->CYCCNT - scope->start;
+    ProfilerZone* zone = scope->zone;
+
+    FURI_CRITICAL_ENTER();
+
+    // First use, register zone
+    if(!zone->next) {
+        // Registered zones are never unlinked, list end points to itself
+        zone->next = profiler_zones ? profiler_zones : zone;
+        profiler_zones = zone;
+        zone->cycles_min = UINT32_MAX;
+    }
+
+    zone->count++;
+    zone->cycles_total += cycles;
+    zone->cycles_min = MIN(zone->cycles_min, cycles);
+    zone->cycles_max = MAX(zone->cycles_max, cycles);
+
+    FURI_CRITICAL_EXIT();
+}
+
+void profiler_zones_set_enabled(bool enabled) {
+    profiler_zones_enabled = enabled;
+}
+
+bool profiler_zones_is_enabled(void) {
+    return profiler_zones_enabled;
+}
+
+static ProfilerZone* profiler_zones_next(ProfilerZone* zone) {
+    return zone->next == zone ? NULL : zone->next;
+}
+
+void profiler_zones_reset(void) {
+    FURI_CRITICAL_ENTER();
+
+    for(ProfilerZone* zone = profiler_zones; zone; zone = profiler_zones_next(zone)) {
+        zone->count = 0;
+        zone->cycles_total = 0;
+        zone->cycles_min = UINT32_MAX;
+        zone->cycles_max = 0;
+    }
+
+    FURI_CRITICAL_EXIT();
+}
+
+void profiler_zones_dump(void) {
+    const uint32_t cycles_per_us = furi_hal_cortex_instructions_per_microsecond();
+
+    printf("%-32s %10s %10s %10s %10s\r\n", "Zone", "Count", "Min, us", "Avg, us", "Max, us");
+
+    FURI_CRITICAL_ENTER();
+    ProfilerZone* zone = profiler_zones;
+    FURI_CRITICAL_EXIT();
+
+    // Zones are only ever prepended, so walking from the snapshot is safe
+    for(; zone; zone = profiler_zones_next(zone)) {
+        FURI_CRITICAL_ENTER();
+        const ProfilerZone stats = *zone;
+        FURI_CRITICAL_EXIT();
+
+        if(!stats.count) continue;
+
+        printf(
+            "%-32s %10lu %10lu %10lu %10lu\r\n",
+            stats.name,
+            stats.count,
+            stats.cycles_min / cycles_per_us,
+            (uint32_t)(stats.cycles_total / stats.count / cycles_per_us),
+            stats.cycles_max / cycles_per_us);
+    }
+}
+
+/*
+ * Sampling profiler
+ */
+
+#define PROFILER_SAMPLER_TIMER           LPTIM2
+#define PROFILER_SAMPLER_TIMER_BUS       FuriHalBusLPTIM2
+#define PROFILER_SAMPLER_TIMER_IRQ       FuriHalInterruptIdLpTim2
+#define PROFILER_SAMPLER_TIMER_IRQN      LPTIM2_IRQn
+#define PROFILER_SAMPLER_FREQUENCY_MIN   (10UL)
+#define PROFILER_SAMPLER_FREQUENCY_MAX   (10000UL)
+#define PROFILER_SAMPLER_TIMER_CLOCK     (64000000UL)
+#define PROFILER_SAMPLER_EXC_FRAME_LR    (5)
+#define PROFILER_SAMPLER_EXC_FRAME_PC    (6)
+#define PROFILER_SAMPLER_EXC_NVIC_OFFSET (16)
+
+static const uint32_t profiler_sampler_prescaler[] = {
+    LL_LPTIM_PRESCALER_DIV1,
+    LL_LPTIM_PRESCALER_DIV2,
+    LL_LPTIM_PRESCALER_DIV4,
+    LL_LPTIM_PRESCALER_DIV8,
+    LL_LPTIM_PRESCALER_DIV16,
+    LL_LPTIM_PRESCALER_DIV32,
+    LL_LPTIM_PRESCALER_DIV64,
+    LL_LPTIM_PRESCALER_DIV128,
+};
+
+struct ProfilerSampler {
+    ProfilerSample* ring;
+    size_t mask;
+    // Written by ISR only
+    volatile size_t head;
+    volatile uint32_t dropped;
+    // Written by reader only
+    volatile size_t tail;
+    bool running;
+};
+
+// Exception preempted by sampling interrupt
+static uint32_t profiler_sampler_get_preempted_exception(void) {
+    const uint32_t shcsr = SCB->SHCSR;
+    if(shcsr & SCB_SHCSR_SYSTICKACT_Msk) return SysTick_IRQn + PROFILER_SAMPLER_EXC_NVIC_OFFSET;
+    if(shcsr & SCB_SHCSR_PENDSVACT_Msk) return PendSV_IRQn + PROFILER_SAMPLER_EXC_NVIC_OFFSET;
+    if(shcsr & SCB_SHCSR_SVCALLACT_Msk) return SVCall_IRQn + PROFILER_SAMPLER_EXC_NVIC_OFFSET;
+
+    for(size_t i = 0; i < COUNT_OF(NVIC->IABR); i++) {
+        uint32_t active = NVIC->IABR[i];
+        if(i == PROFILER_SAMPLER_TIMER_IRQN / 32) {
+            active &= ~(1UL << (PROFILER_SAMPLER_TIMER_IRQN % 32));
+        }
+        if(active) {
+            return i * 32 + __builtin_ctz(active) + PROFILER_SAMPLER_EXC_NVIC_OFFSET;
+        }
+    }
+
+    return 0;
+}
+
+static void profiler_sampler_isr(void* context) {
+    ProfilerSampler* sampler = context;
+
+    if(!LL_LPTIM_IsActiveFlag_ARRM(PROFILER_SAMPLER_TIMER)) return;
+    LL_LPTIM_ClearFlag_ARRM(PROFILER_SAMPLER_TIMER);
+
+    const size_t head = sampler->head;
+    if(head - sampler->tail > sampler->mask) {
+        sampler->dropped++;
+        return;
+    }
+
+    ProfilerSample* sample = &sampler->ring[head & sampler->mask];
+
+    if(SCB->ICSR & SCB_ICSR_RETTOBASE_Msk) {
+        // Thread was interrupted, its exception frame is on top of process stack
+        const uint32_t* frame = (const uint32_t*)__get_PSP();
+        sample->pc = frame[PROFILER_SAMPLER_EXC_FRAME_PC];
+        sample->lr = frame[PROFILER_SAMPLER_EXC_FRAME_LR];
+        sample->thread = furi_thread_get_current_id();
+        sample->exception = 0;
+    } else {
+        sample->pc = 0;
+        sample->lr = 0;
+        sample->thread = NULL;
+        sample->exception = profiler_sampler_get_preempted_exception();
+    }
+
+    // Publish sample only after it is written
+    __DMB();
+    sampler->head = head + 1;
+}
+
+ProfilerSampler* profiler_sampler_alloc(size_t depth) {
+    furi_check(depth && !(depth & (depth - 1)));
+
+    ProfilerSampler* sampler = malloc(sizeof(ProfilerSampler));
+    sampler->ring = malloc(sizeof(ProfilerSample) * depth);
+    sampler->mask = depth - 1;
+
+    return sampler;
+}
+
+void profiler_sampler_free(ProfilerSampler* sampler) {
+    furi_check(sampler);
+
+    profiler_sampler_stop(sampler);
+
+    free(sampler->ring);
+    free(sampler);
+}
+
+bool profiler_sampler_start(ProfilerSampler* sampler, uint32_t frequency) {
+    furi_check(sampler);
+    furi_check(!sampler->running);
+    furi_check(frequency >= PROFILER_SAMPLER_FREQUENCY_MIN);
+    furi_check(frequency <= PROFILER_SAMPLER_FREQUENCY_MAX);
+
+    // Shared with LPTIM2 PWM output
+    if(furi_hal_bus_is_enabled(PROFILER_SAMPLER_TIMER_BUS)) return false;
+
+    const uint32_t divider = PROFILER_SAMPLER_TIMER_CLOCK / frequency;
+    size_t prescaler = 0;
+    while((divider >> prescaler) > 0xFFFF) {
+        prescaler++;
+    }
+    furi_check(prescaler < COUNT_OF(profiler_sampler_prescaler));
+
+    sampler->head = 0;
+    sampler->tail = 0;
+    sampler->dropped = 0;
+    sampler->running = true;
+
+    // Timer clock is stopped in deep sleep
+    furi_hal_power_insomnia_enter();
+
+    furi_hal_bus_enable(PROFILER_SAMPLER_TIMER_BUS);
+
+    // Configuration and interrupt enable registers are writable only while timer is disabled
+    LL_RCC_SetLPTIMClockSource(LL_RCC_LPTIM2_CLKSOURCE_PCLK1);
+    LL_LPTIM_SetClockSource(PROFILER_SAMPLER_TIMER, LL_LPTIM_CLK_SOURCE_INTERNAL);
+    LL_LPTIM_SetPrescaler(PROFILER_SAMPLER_TIMER, profiler_sampler_prescaler[prescaler]);
+    LL_LPTIM_SetCounterMode(PROFILER_SAMPLER_TIMER, LL_LPTIM_COUNTER_MODE_INTERNAL);
+    LL_LPTIM_EnableIT_ARRM(PROFILER_SAMPLER_TIMER);
+
+    // Highest priority: sample inside critical sections and other interrupts too
+    furi_hal_interrupt_set_isr_ex(
+        PROFILER_SAMPLER_TIMER_IRQ,
+        FuriHalInterruptPriorityKamiSama,
+        profiler_sampler_isr,
+        sampler);
+
+    LL_LPTIM_Enable(PROFILER_SAMPLER_TIMER);
+    LL_LPTIM_SetAutoReload(PROFILER_SAMPLER_TIMER, (divider >> prescaler) - 1);
+    LL_LPTIM_StartCounter(PROFILER_SAMPLER_TIMER, LL_LPTIM_OPERATING_MODE_CONTINUOUS);
+
+    return true;
+}
+
+void profiler_sampler_stop(ProfilerSampler* sampler) {
+    furi_check(sampler);
+
+    if(!sampler->running) return;
+
+    furi_hal_interrupt_set_isr(PROFILER_SAMPLER_TIMER_IRQ, NULL, NULL);
+    furi_hal_bus_disable(PROFILER_SAMPLER_TIMER_BUS);
+
+    furi_hal_power_insomnia_exit();
+
+    sampler->running = false;
+}
+
+size_t profiler_sampler_read(ProfilerSampler* sampler, ProfilerSample* samples, size_t count) {
+    furi_check(sampler);
+    furi_check(samples);
+
+    const size_t head = sampler->head;
+    size_t tail = sampler->tail;
+
+    // Samples up to head are published
+    __DMB();
+
+    size_t read = 0;
+    while(read < count && tail != head) {
+        samples[read++] = sampler->ring[tail & sampler->mask];
+        tail++;
+    }
+
+    // Release slots only after they are copied
+    __DMB();
+    sampler->tail = tail;
+
+    return read;
+}
+
+uint32_t profiler_sampler_get_dropped(ProfilerSampler* sampler) {
+    furi_check(sampler);
+    return sampler->dropped;
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <furi.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -18,6 +20,136 @@ void profiler_stop(Profiler* profiler, const char* key);
 
 void profiler_dump(Profiler* profiler);
 
+/* Scoped zones
+ *
+ * Zone accumulates min/avg/max CPU cycles spent in a scope. Zones register
+ * themselves on first use and collect statistics only while enabled with
+ * profiler_zones_set_enabled(), otherwise zone costs one call and a branch.
+ * Zones can be used from any thread and from interrupts.
+ */
+
+typedef struct ProfilerZone ProfilerZone;
+
+struct ProfilerZone {
+    const char* name;
+    ProfilerZone* next;
+    uint32_t count;
+    uint32_t cycles_min;
+    uint32_t cycles_max;
+    uint64_t cycles_total;
+};
+
+typedef struct {
+    ProfilerZone* zone;
+    uint32_t start;
+} ProfilerZoneScope;
+
+/** Enter zone, use PROFILER_ZONE() instead */
+ProfilerZoneScope profiler_zone_enter(ProfilerZone* zone);
+
+/** Leave zone, use PROFILER_ZONE() instead */
+void profiler_zone_leave(ProfilerZoneScope* scope);
+
+#define PROFILER_CONCAT_(a, b) a##b
+#define PROFILER_CONCAT(a, b)  PROFILER_CONCAT_(a, b)
+
+/** Profile the rest of the enclosing scope as named zone
+ *
+ * @param      zone_name  zone name, string literal
+ */
+#define PROFILER_ZONE(zone_name)                                                           \
+    static ProfilerZone PROFILER_CONCAT(profiler_zone_, __LINE__) = {.name = zone_name}; \
+    ProfilerZoneScope PROFILER_CONCAT(profiler_zone_scope_, __LINE__)                      \
+        __attribute__((cleanup(profiler_zone_leave))) =                                    \
+            profiler_zone_enter(&PROFILER_CONCAT(profiler_zone_, __LINE__))
+
+/** Enable or disable zone statistics collection
+ *
+ * @param      enabled  true to collect statistics
+ */
+void profiler_zones_set_enabled(bool enabled);
+
+/** Check if zone statistics collection is enabled
+ *
+ * @return     true if enabled
+ */
+bool profiler_zones_is_enabled(void);
+
+/** Reset statistics of all registered zones */
+void profiler_zones_reset(void);
+
+/** Print statistics of all registered zones */
+void profiler_zones_dump(void);
+
+/* Sampling profiler
+ *
+ * Hardware timer interrupt records PC and LR of the running thread into a
+ * ring buffer. Interrupt preempting another interrupt records active
+ * exception number instead. Sampler uses LPTIM2 and can not run together
+ * with LPTIM2 PWM output.
+ */
+
+typedef struct {
+    uint32_t pc; /**< Program counter, 0 if interrupt was sampled */
+    uint32_t lr; /**< Link register, 0 if interrupt was sampled */
+    FuriThreadId thread; /**< Running thread, NULL if interrupt was sampled */
+    uint32_t exception; /**< Sampled exception number, 0 if thread was sampled */
+} ProfilerSample;
+
+typedef struct ProfilerSampler ProfilerSampler;
+
+/** Allocate sampling profiler
+ *
+ * @param      depth  ring buffer depth in samples, power of 2
+ *
+ * @return     ProfilerSampler instance
+ */
+ProfilerSampler* profiler_sampler_alloc(size_t depth);
+
+/** Free sampling profiler, stops it if running
+ *
+ * @param      sampler  ProfilerSampler instance
+ */
+void profiler_sampler_free(ProfilerSampler* sampler);
+
+/** Start sampling
+ *
+ * Device is kept out of deep sleep while sampling.
+ *
+ * @param      sampler    ProfilerSampler instance
+ * @param      frequency  sampling frequency in Hz, 10 to 10000
+ *
+ * @return     true on success, false if sampling timer is busy
+ */
+bool profiler_sampler_start(ProfilerSampler* sampler, uint32_t frequency);
+
+/** Stop sampling, collected samples can still be read
+ *
+ * @param      sampler  ProfilerSampler instance
+ */
+void profiler_sampler_stop(ProfilerSampler* sampler);
+
+/** Read collected samples
+ *
+ * Must be called often enough to keep up with sampling, samples taken while
+ * ring buffer is full are dropped.
+ *
+ * @param      sampler  ProfilerSampler instance
+ * @param      samples  output buffer
+ * @param      count    output buffer size in samples
+ *
+ * @return     number of samples read
+ */
+size_t profiler_sampler_read(ProfilerSampler* sampler, ProfilerSample* samples, size_t count);
+
+/** Get number of dropped samples
+ *
+ * @param      sampler  ProfilerSampler instance
+ *
+ * @return     dropped samples count since start
+ */
+uint32_t profiler_sampler_get_dropped(ProfilerSampler* sampler);
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,6 +14,12 @@
 #define FILE_OPEN_NTRIES      10
 #define FILE_OPEN_RETRY_DELAY 25
 
+#define HEATSHRINK_INPUT_BUFFER_SIZE 2048
+
+#define TAR_WRITER_BLOCK_SIZE  4096
+#define TAR_WRITER_BLOCK_COUNT 3
+#define TAR_WRITER_STACK_SIZE  2048
+
 TarOpenMode tar_archive_get_mode_for_path(const char* path) {
     char ext[8];
 
@@ -34,6 +40,8 @@ typedef struct TarArchive {
     mtar_t tar;
     tar_unpack_file_cb unpack_cb;
     void* unpack_cb_context;
+    int32_t unpacked_files;
+    int32_t unpacked_bytes;
 } TarArchive;
 
 /* Plain file backend - uncompressed, supports read and write */
@@ -130,6 +138,8 @@ TarArchive* tar_archive_alloc(Storage* storage) {
     archive->storage = storage;
     archive->stream = storage_file_alloc(archive->storage);
     archive->unpack_cb = NULL;
+    archive->unpacked_files = 0;
+    archive->unpacked_bytes = 0;
     return archive;
 }
 
@@ -185,7 +195,7 @@ bool tar_archive_open(TarArchive* archive, const char* path, TarOpenMode mode) {
         hs_stream->stream = stream;
         hs_stream->heatshrink_config.window_sz2 = header.window_sz2;
         hs_stream->heatshrink_config.lookahead_sz2 = header.lookahead_sz2;
-        hs_stream->heatshrink_config.input_buffer_sz = FILE_BLOCK_SIZE;
+        hs_stream->heatshrink_config.input_buffer_sz = HEATSHRINK_INPUT_BUFFER_SIZE;
         hs_stream->decoder = compress_stream_decoder_alloc(
             CompressTypeHeatshrink, &hs_stream->heatshrink_config, file_read_cb, stream);
         mtar_init(&archive->tar, mtar_access, &heatshrink_ops, hs_stream);
@@ -286,8 +296,176 @@ bool tar_archive_file_finalize(TarArchive* archive) {
     return mtar_end_data(&archive->tar) == MTAR_ESUCCESS;
 }
 
+/* Write-behind extraction: archive is read and decompressed on the caller
+ * thread while output files are written on a separate writer thread. Data
+ * is passed in large blocks from a fixed pool, so the reader only waits for
+ * SD card when all blocks are in flight. */
+
+typedef enum {
+    TarWriterCmdMkdir,
+    TarWriterCmdOpen,
+    TarWriterCmdData,
+    TarWriterCmdClose,
+    TarWriterCmdStop,
+} TarWriterCmdType;
+
+typedef struct {
+    TarWriterCmdType type;
+    union {
+        FuriString* path;
+        struct {
+            uint8_t* data;
+            size_t size;
+        };
+    };
+} TarWriterCmd;
+
+typedef struct {
+    Storage* storage;
+    File* file;
+    FuriThread* thread;
+    FuriMessageQueue* commands;
+    FuriMessageQueue* free_blocks;
+    uint8_t* blocks;
+    volatile bool failed;
+} TarWriter;
+
+static bool tar_writer_open_file(TarWriter* writer, const char* path) {
+    uint8_t n_tries = FILE_OPEN_NTRIES;
+    while(n_tries-- > 0) {
+        if(storage_file_open(writer->file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+            return true;
+        }
+        FURI_LOG_W(TAG, "Failed to open '%s', reties: %d", path, n_tries);
+        storage_file_close(writer->file);
+        furi_delay_ms(FILE_OPEN_RETRY_DELAY);
+    }
+    return false;
+}
+
+static int32_t tar_writer_thread(void* context) {
+    TarWriter* writer = context;
+    TarWriterCmd cmd;
+
+    bool running = true;
+    while(running) {
+        furi_check(
+            furi_message_queue_get(writer->commands, &cmd, FuriWaitForever) == FuriStatusOk);
+
+        // After a failure commands are only drained, so reader never blocks
+        switch(cmd.type) {
+        case TarWriterCmdMkdir:
+            if(!writer->failed &&
+               !storage_simply_mkdir(writer->storage, furi_string_get_cstr(cmd.path))) {
+                FURI_LOG_E(TAG, "Failed to create '%s'", furi_string_get_cstr(cmd.path));
+                writer->failed = true;
+            }
+            furi_string_free(cmd.path);
+            break;
+        case TarWriterCmdOpen:
+            if(!writer->failed && !tar_writer_open_file(writer, furi_string_get_cstr(cmd.path))) {
+                writer->failed = true;
+            }
+            furi_string_free(cmd.path);
+            break;
+        case TarWriterCmdData:
+            if(!writer->failed &&
+               storage_file_write(writer->file, cmd.data, cmd.size) != cmd.size) {
+                FURI_LOG_E(TAG, "Write failed");
+                writer->failed = true;
+            }
+            furi_check(
+                furi_message_queue_put(writer->free_blocks, &cmd.data, 0) == FuriStatusOk);
+            break;
+        case TarWriterCmdClose:
+            storage_file_close(writer->file);
+            break;
+        case TarWriterCmdStop:
+            storage_file_close(writer->file);
+            running = false;
+            break;
+        }
+    }
+
+    return 0;
+}
+
+static TarWriter* tar_writer_alloc(Storage* storage) {
+    TarWriter* writer = malloc(sizeof(TarWriter));
+    writer->storage = storage;
+    writer->file = storage_file_alloc(storage);
+    writer->failed = false;
+
+    writer->commands =
+        furi_message_queue_alloc(TAR_WRITER_BLOCK_COUNT * 2 + 2, sizeof(TarWriterCmd));
+    writer->free_blocks = furi_message_queue_alloc(TAR_WRITER_BLOCK_COUNT, sizeof(uint8_t*));
+
+    // Whole blocks at aligned offsets are written by FatFs directly, bypassing sector buffer
+    writer->blocks = malloc(TAR_WRITER_BLOCK_SIZE * TAR_WRITER_BLOCK_COUNT);
+    for(size_t i = 0; i < TAR_WRITER_BLOCK_COUNT; i++) {
+        uint8_t* block = writer->blocks + i * TAR_WRITER_BLOCK_SIZE;
+        furi_message_queue_put(writer->free_blocks, &block, 0);
+    }
+
+    writer->thread =
+        furi_thread_alloc_ex("TarWriter", TAR_WRITER_STACK_SIZE, tar_writer_thread, writer);
+    furi_thread_start(writer->thread);
+    return writer;
+}
+
+static bool tar_writer_free(TarWriter* writer) {
+    TarWriterCmd cmd = {.type = TarWriterCmdStop};
+    furi_message_queue_put(writer->commands, &cmd, FuriWaitForever);
+    furi_thread_join(writer->thread);
+    furi_thread_free(writer->thread);
+
+    bool success = !writer->failed;
+
+    free(writer->blocks);
+    furi_message_queue_free(writer->free_blocks);
+    furi_message_queue_free(writer->commands);
+    storage_file_free(writer->file);
+    free(writer);
+    return success;
+}
+
+static void tar_writer_send_path(TarWriter* writer, TarWriterCmdType type, FuriString* path) {
+    TarWriterCmd cmd = {.type = type, .path = furi_string_alloc_set(path)};
+    furi_message_queue_put(writer->commands, &cmd, FuriWaitForever);
+}
+
+static bool
+    tar_writer_extract_current_file(TarArchive* archive, TarWriter* writer, FuriString* dst_path) {
+    mtar_t* tar = &archive->tar;
+    tar_writer_send_path(writer, TarWriterCmdOpen, dst_path);
+
+    bool success = true;
+    while(!mtar_eof_data(tar)) {
+        TarWriterCmd cmd = {.type = TarWriterCmdData};
+        furi_message_queue_get(writer->free_blocks, &cmd.data, FuriWaitForever);
+
+        int32_t readcnt = mtar_read_data(tar, cmd.data, TAR_WRITER_BLOCK_SIZE);
+        if(readcnt <= 0 || writer->failed) {
+            furi_message_queue_put(writer->free_blocks, &cmd.data, 0);
+            success = false;
+            break;
+        }
+
+        cmd.size = readcnt;
+        furi_message_queue_put(writer->commands, &cmd, FuriWaitForever);
+        archive->unpacked_bytes += readcnt;
+    }
+
+    TarWriterCmd cmd = {.type = TarWriterCmdClose};
+    furi_message_queue_put(writer->commands, &cmd, FuriWaitForever);
+    archive->unpacked_files++;
+
+    return success && !writer->failed;
+}
+
 typedef struct {
     TarArchive* archive;
+    TarWriter* writer;
     const char* work_dir;
     TarArchiveNameConverter converter;
 } TarArchiveDirectoryOpParams;
@@ -351,13 +529,12 @@ static int archive_extract_foreach_cb(mtar_t* tar, const mtar_header_t* header,
             return 0;
         }
 
+        // Directories are created by writer in order with files, reader does not wait for them
         full_extracted_fname = furi_string_alloc();
         path_concat(op_params->work_dir, header->name, full_extracted_fname);
-
-        bool create_res =
-            storage_simply_mkdir(archive->storage, furi_string_get_cstr(full_extracted_fname));
+        tar_writer_send_path(op_params->writer, TarWriterCmdMkdir, full_extracted_fname);
         furi_string_free(full_extracted_fname);
-        return create_res ? 0 : -1;
+        return op_params->writer->failed ? -1 : 0;
     }
 
     if(header->type != MTAR_TREG) {
@@ -376,7 +553,7 @@ static int archive_extract_foreach_cb(mtar_t* tar, const mtar_header_t* header,
     path_concat(op_params->work_dir, furi_string_get_cstr(converted_fname), full_extracted_fname);
 
     bool success =
-        archive_extract_current_file(archive, furi_string_get_cstr(full_extracted_fname));
+        tar_writer_extract_current_file(archive, op_params->writer, full_extracted_fname);
 
     furi_string_free(converted_fname);
     furi_string_free(full_extracted_fname);
@@ -396,7 +573,36 @@ bool tar_archive_unpack_to(
 
     FURI_LOG_I(TAG, "Restoring '%s'", destination);
 
-    return mtar_foreach(&archive->tar, archive_extract_foreach_cb, &param) == MTAR_ESUCCESS;
+    archive->unpacked_files = 0;
+    archive->unpacked_bytes = 0;
+    uint32_t start_tick = furi_get_tick();
+
+    param.writer = tar_writer_alloc(archive->storage);
+    bool success =
+        mtar_foreach(&archive->tar, archive_extract_foreach_cb, &param) == MTAR_ESUCCESS;
+    // Wait for pending writes, they may fail too
+    success = tar_writer_free(param.writer) && success;
+
+    uint32_t elapsed_ms = furi_get_tick() - start_tick;
+    FURI_LOG_I(
+        TAG,
+        "Unpacked %ld files, %ld bytes in %lu ms, %lu KiB/s",
+        archive->unpacked_files,
+        archive->unpacked_bytes,
+        elapsed_ms,
+        (uint32_t)((uint64_t)archive->unpacked_bytes * 1000 / 1024 / (elapsed_ms + 1)));
+
+    return success;
+}
+
+void tar_archive_get_unpack_stats(TarArchive* archive, int32_t* files, int32_t* bytes) {
+    furi_check(archive);
+    if(files) {
+        *files = archive->unpacked_files;
+    }
+    if(bytes) {
+        *bytes = archive->unpacked_bytes;
+    }
 }
 
 bool tar_archive_add_file(
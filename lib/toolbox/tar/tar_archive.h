@@ -114,6 +114,14 @@ int32_t tar_archive_get_entries_count(TarArchive* archive);
  */
 bool tar_archive_get_read_progress(TarArchive* archive, int32_t* processed, int32_t* total);
 
+/** Get statistics of the last tar_archive_unpack_to call
+ *
+ * @param       archive Tar archive object
+ * @param[out]  files   Number of unpacked files, can be NULL
+ * @param[out]  bytes   Number of unpacked bytes, can be NULL
+ */
+void tar_archive_get_unpack_stats(TarArchive* archive, int32_t* files, int32_t* bytes);
+
 /** Unpack single file from tar archive
  *
  * @param       archive       Tar archive object. Must be opened in read mode
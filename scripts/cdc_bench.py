@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+
+import os
+import threading
+import time
+
+from flipper.app import App
+from flipper.storage import FlipperStorage
+from flipper.utils.cdc import resolve_port
+
+
+class Main(App):
+    # Measures USB VCP throughput with `loopback` CLI command
+    def init(self):
+        self.parser.add_argument("-p", "--port", help="CDC Port", default="auto")
+        self.parser.add_argument(
+            "-s", "--size", help="Bytes per run", type=int, default=256 * 1024
+        )
+        self.parser.add_argument(
+            "-c", "--chunk", help="Host write chunk size", type=int, default=4096
+        )
+        self.parser.add_argument(
+            "--direct",
+            action="store_true",
+            help="Use direct VCP consumer, same as RPC session",
+        )
+        self.parser.set_defaults(func=self.bench)
+
+    def _run(self, flipper: FlipperStorage, direct: bool) -> bool:
+        size = self.args.size
+        payload = os.urandom(size)
+        mode = " direct" if direct else ""
+
+        flipper.send(f"loopback {size}{mode}\r")
+        header = flipper.read.until(flipper.CLI_EOL)
+        while not header.startswith(b"Loopback"):
+            if header.startswith(b"Direct mode") or header.startswith(b"Usage"):
+                self.logger.error(header.decode("ascii"))
+                flipper.read.until(flipper.CLI_PROMPT)
+                return False
+            header = flipper.read.until(flipper.CLI_EOL)
+
+        def writer():
+            for offset in range(0, size, self.args.chunk):
+                flipper.port.write(payload[offset : offset + self.args.chunk])
+
+        time_start = time.monotonic()
+        thread = threading.Thread(target=writer)
+        thread.start()
+
+        received = bytearray(flipper.read.buffer)
+        flipper.read.buffer = bytearray()
+        while len(received) < size:
+            data = flipper.port.read(max(1, flipper.port.in_waiting))
+            if not data:
+                break
+            received.extend(data)
+        time_end = time.monotonic()
+        thread.join()
+
+        flipper.read.buffer = received[size:]
+        received = received[:size]
+        report = flipper.read.until(flipper.CLI_PROMPT).decode("ascii").strip()
+
+        if received != payload:
+            self.logger.error(f"Data mismatch, received {len(received)} of {size}")
+            return False
+
+        elapsed = time_end - time_start
+        self.logger.info(
+            f"{'direct' if direct else 'cli'}: {size} bytes in {elapsed * 1000:.0f} ms, "
+            f"{size / elapsed / 1024:.1f} KiB/s round trip"
+        )
+        self.logger.info(f"Device: {report}")
+        return True
+
+    def bench(self):
+        if not (port := resolve_port(self.logger, self.args.port)):
+            return 1
+
+        with FlipperStorage(port) as flipper:
+            flipper.port.timeout = 5
+            if not self._run(flipper, False):
+                return 1
+            if self.args.direct and not self._run(flipper, True):
+                return 1
+
+            stats = flipper.send_and_wait_prompt("info vcp\r")
+            self.logger.info(stats.decode("ascii").strip())
+
+        return 0
+
+
+if __name__ == "__main__":
+    Main()()
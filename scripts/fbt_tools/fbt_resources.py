@@ -1,6 +1,7 @@
 import os
 import shutil
 
+from flipper.assets.keyindex import is_key_index_source, key_index_path, write_key_index
 from SCons.Action import Action
 from SCons.Builder import Builder
 from SCons.Errors import StopError
@@ -69,6 +70,9 @@ def _resources_dist_action(target, source, env):
         if isinstance(src, File):
             os.makedirs(os.path.dirname(target.path), exist_ok=True)
             shutil.copy(src.path, target.path)
+            # Lookup tables get compiled binary index next to them
+            if is_key_index_source(src.path):
+                write_key_index(src.path, key_index_path(target.path))
         elif isinstance(src, Dir):
             shutil.copytree(src.path, target.path)
         else:
@@ -0,0 +1,85 @@
+import os
+import struct
+
+# Compiles Flipper Format key-value resources with hex keys into sorted binary
+# index, see lib/toolbox/key_index.h for the format description and lookup.
+
+KEY_INDEX_MAGIC = 0x58444946  # "FIDX"
+KEY_INDEX_VERSION = 2
+KEY_INDEX_KEY_SIZE_MAX = 16
+KEY_INDEX_SUFFIX = ".idx"
+
+# Resource filetypes to build index for
+KEY_INDEX_FILETYPES = ("Flipper EMV resources",)
+
+
+def key_index_path(path: str) -> str:
+    return path.rsplit(".", 1)[0] + KEY_INDEX_SUFFIX
+
+
+def is_key_index_source(path: str) -> bool:
+    try:
+        with open(path, "r", encoding="utf-8") as file:
+            header = file.readline(128).strip()
+    except (UnicodeDecodeError, OSError):
+        return False
+    return any(header == f"Filetype: {filetype}" for filetype in KEY_INDEX_FILETYPES)
+
+
+def read_key_value_file(path: str) -> dict:
+    entries = {}
+    with open(path, "r", encoding="utf-8") as file:
+        for line in file.readlines()[2:]:
+            line = line.rstrip("\r\n")
+            if not line.strip() or line.startswith("#"):
+                continue
+            key, value = line.split(": ", 1)
+            key = bytes.fromhex(key)
+            # Same as Flipper Format lookup: value is taken as is, first occurrence wins
+            entries.setdefault(key, value.encode("utf-8"))
+    return entries
+
+
+def compile_key_index(entries: dict, source_size: int) -> bytes:
+    if not entries:
+        raise ValueError("No entries to index")
+    if len(entries) > 0xFFFF:
+        raise ValueError("Too many entries")
+
+    key_size = max(len(key) for key in entries)
+    if key_size > KEY_INDEX_KEY_SIZE_MAX:
+        raise ValueError(f"Key is longer than {KEY_INDEX_KEY_SIZE_MAX} bytes")
+
+    table = bytearray()
+    pool = bytearray()
+    # Bytes order, shorter key first on common prefix: same as memcmp and length
+    for key in sorted(entries):
+        value = entries[key]
+        if len(value) > 0xFF:
+            raise ValueError(f"Value for {key.hex()} is too long")
+        if len(pool) > 0xFFFF:
+            raise ValueError("String pool is too large")
+        table += struct.pack("<BBH", len(key), len(value), len(pool))
+        table += key.ljust(key_size, b"\0")
+        pool += value
+
+    # Modification time on device is not known yet, it is set on first lookup
+    header = struct.pack(
+        "<IBBHII",
+        KEY_INDEX_MAGIC,
+        KEY_INDEX_VERSION,
+        key_size,
+        len(entries),
+        source_size,
+        0,
+    )
+    return header + table + pool
+
+
+def write_key_index(source_path: str, index_path: str):
+    with open(index_path, "wb") as file:
+        file.write(
+            compile_key_index(
+                read_key_value_file(source_path), os.path.getsize(source_path)
+            )
+        )
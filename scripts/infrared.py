@@ -1,10 +1,20 @@
 #!/usr/bin/env python3
 
+import glob
+import subprocess
+import tempfile
 from os import path
 
 from flipper.app import App
 from flipper.utils.fff import *
 
+ROOT_DIR = path.normpath(path.join(path.dirname(__file__), ".."))
+REPLAY_DIR = path.join(ROOT_DIR, "scripts", "infrared_replay")
+DECODER_DIR = path.join(ROOT_DIR, "lib", "infrared", "encoder_decoder")
+IRTEST_DIR = path.join(
+    ROOT_DIR, "applications/debug/unit_tests/resources/unit_tests/infrared"
+)
+
 
 class Main(App):
     def init(self):
@@ -17,6 +27,110 @@ class Main(App):
         self.parser_cleanup.add_argument("filename", type=str)
         self.parser_cleanup.set_defaults(func=self.cleanup)
 
+        self.parser_bench = self.subparsers.add_parser(
+            "bench", help="Replay unit test captures through decoders on host"
+        )
+        self.parser_bench.add_argument(
+            "files",
+            type=str,
+            nargs="*",
+            help="IR test files, all unit test files by default",
+        )
+        self.parser_bench.add_argument("--rounds", type=int, default=100)
+        self.parser_bench.add_argument("--cc", type=str, default="cc")
+        self.parser_bench.set_defaults(func=self.bench)
+
+    def _load_captures(self, filename):
+        f = FlipperFormatFile()
+        f.load(filename)
+
+        filetype, version = f.getHeader()
+        if filetype != "IR tests file" or version != 1:
+            self.logger.error(f"Incorrect file type({filetype}) or version({version})")
+            return None
+
+        # Long arrays may continue on lines without a key, read them line by line
+        records = []
+        for line in f.lines[f.cursor :]:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            key, sep, value = line.partition(":")
+            if sep and key.isidentifier():
+                records.append([key.strip(), value.strip()])
+            elif records:
+                records[-1][1] += " " + line
+
+        captures = {}
+        expected = {}
+        name = ""
+        for key, value in records:
+            if key == "name":
+                name = value
+            elif key == "data" and name.startswith("decoder_input"):
+                captures[name.removeprefix("decoder_input")] = value
+            elif key == "count" and name.startswith("decoder_expected"):
+                expected[name.removeprefix("decoder_expected")] = int(value)
+
+        return [(index, data, expected.get(index, 0)) for index, data in captures.items()]
+
+    def bench(self):
+        files = self.args.files or sorted(glob.glob(path.join(IRTEST_DIR, "*.irtest")))
+
+        lines = []
+        expected = []
+        for filename in files:
+            captures = self._load_captures(filename)
+            if captures is None:
+                return 1
+            protocol = path.splitext(path.basename(filename))[0].removeprefix("test_")
+            for index, data, count in captures:
+                lines.append(f"{protocol}#{index} {data}\n")
+                expected.append(count)
+
+        sources = glob.glob(path.join(DECODER_DIR, "**", "*.c"), recursive=True)
+        with tempfile.TemporaryDirectory() as tmp:
+            binary = path.join(tmp, "replay_bench")
+            cmd = [
+                self.args.cc,
+                "-O2",
+                "-std=gnu17",
+                f"-I{path.join(REPLAY_DIR, 'shim')}",
+                f"-I{path.join(ROOT_DIR, 'furi')}",
+                f"-I{DECODER_DIR}",
+                path.join(REPLAY_DIR, "replay_bench.c"),
+                *sources,
+                "-o",
+                binary,
+            ]
+            self.logger.debug(" ".join(cmd))
+            subprocess.run(cmd, check=True)
+            result = subprocess.run(
+                [binary, str(self.args.rounds)],
+                input="".join(lines),
+                capture_output=True,
+                text=True,
+                check=True,
+            )
+
+        return_code = 0
+        total_edges = 0
+        total_ns = 0
+        print(f"{'capture':<16} {'edges':>10} {'msgs':>6} {'edges/s':>12} {'ns/msg':>8}")
+        for line, count in zip(result.stdout.splitlines(), expected):
+            name, edges, messages, rate, frame_ns = line.split()
+            print(f"{name:<16} {edges:>10} {messages:>6} {rate:>12} {frame_ns:>8}")
+            if int(messages) != count:
+                self.logger.error(f"{name}: decoded {messages} messages, expected {count}")
+                return_code = 1
+            total_edges += int(edges)
+            total_ns += int(edges) * 1000000000 // max(int(rate), 1)
+
+        if total_ns:
+            self.logger.info(f"Total: {total_edges * 1000000000 // total_ns} edges/s")
+
+        return return_code
+
     def cleanup(self):
         f = FlipperFormatFile()
         f.load(self.args.filename)
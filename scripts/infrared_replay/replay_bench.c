@@ -0,0 +1,91 @@
+/**
+ * @file replay_bench.c
+ * Host side replay benchmark for lib/infrared decoders
+ *
+ * Reads captures from stdin, one per line: name followed by the edge
+ * durations in microseconds, starting with a space. Every capture is
+ * replayed through the full decoder set the way the infrared worker feeds it
+ * and one result line is printed per capture:
+ * name, edges, decoded messages, edges/s and ns per decoded message.
+ *
+ * Built and driven by `scripts/infrared.py bench`.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <infrared.h>
+
+#define REPLAY_LINE_MAX    (64 * 1024)
+#define REPLAY_TIMINGS_MAX (8 * 1024)
+
+static uint64_t replay_bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint32_t replay_bench_round(
+    InfraredDecoderHandler* decoder,
+    const uint32_t* timings,
+    uint32_t timings_count) {
+    uint32_t messages = 0;
+    bool level = false;
+
+    infrared_reset_decoder(decoder);
+    for(uint32_t i = 0; i < timings_count; ++i) {
+        if(timings[i] > INFRARED_RAW_RX_TIMING_DELAY_US) {
+            if(infrared_check_decoder_ready(decoder)) ++messages;
+        }
+        if(infrared_decode(decoder, level, timings[i])) ++messages;
+        level = !level;
+    }
+    if(infrared_check_decoder_ready(decoder)) ++messages;
+
+    return messages;
+}
+
+int main(int argc, char** argv) {
+    uint32_t rounds = argc > 1 ? strtoul(argv[1], NULL, 10) : 100;
+    if(!rounds) rounds = 1;
+
+    char* line = malloc(REPLAY_LINE_MAX);
+    uint32_t* timings = malloc(REPLAY_TIMINGS_MAX * sizeof(uint32_t));
+    InfraredDecoderHandler* decoder = infrared_alloc_decoder();
+
+    while(fgets(line, REPLAY_LINE_MAX, stdin)) {
+        char* save = NULL;
+        const char* name = strtok_r(line, " \n", &save);
+        if(!name) continue;
+
+        uint32_t timings_count = 0;
+        const char* token;
+        while((token = strtok_r(NULL, " \n", &save)) && timings_count < REPLAY_TIMINGS_MAX) {
+            timings[timings_count++] = strtoul(token, NULL, 10);
+        }
+
+        uint32_t messages = 0;
+        uint64_t start = replay_bench_now_ns();
+        for(uint32_t round = 0; round < rounds; ++round) {
+            messages += replay_bench_round(decoder, timings, timings_count);
+        }
+        uint64_t elapsed = replay_bench_now_ns() - start;
+        if(!elapsed) elapsed = 1;
+
+        uint64_t edges = (uint64_t)timings_count * rounds;
+        printf(
+            "%s %llu %u %llu %llu\n",
+            name,
+            (unsigned long long)edges,
+            messages / rounds,
+            (unsigned long long)(edges * 1000000000ULL / elapsed),
+            (unsigned long long)(messages ? elapsed / messages : 0));
+    }
+
+    infrared_free_decoder(decoder);
+    free(timings);
+    free(line);
+
+    return 0;
+}
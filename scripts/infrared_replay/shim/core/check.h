@@ -0,0 +1,28 @@
+/**
+ * @file check.h
+ * Host build stand-in for furi/core/check.h, used by the infrared replay bench
+ */
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_defines.h"
+
+#define furi_crash(...)                                          \
+    do {                                                         \
+        fprintf(stderr, "crash at %s:%d\n", __FILE__, __LINE__); \
+        abort();                                                 \
+    } while(0)
+
+#define furi_halt(...) furi_crash()
+
+#define __furi_host_check(__e, ...) \
+    do {                            \
+        if(!(__e)) {                \
+            furi_crash();           \
+        }                           \
+    } while(0)
+
+#define furi_check(...)  __furi_host_check(__VA_ARGS__, NULL)
+#define furi_assert(...) __furi_host_check(__VA_ARGS__, NULL)
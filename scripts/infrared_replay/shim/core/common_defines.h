@@ -0,0 +1,24 @@
+/**
+ * @file common_defines.h
+ * Host build stand-in for furi/core/common_defines.h, without CMSIS
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdnoreturn.h>
+
+#include <core/core_defines.h>
+
+#define FURI_NORETURN noreturn
+
+#ifndef FURI_WARN_UNUSED
+#define FURI_WARN_UNUSED __attribute__((warn_unused_result))
+#endif
+
+#ifndef FURI_PACKED
+#define FURI_PACKED __attribute__((packed))
+#endif
+
+#ifndef FURI_ALWAYS_INLINE
+#define FURI_ALWAYS_INLINE __attribute__((always_inline)) inline
+#endif
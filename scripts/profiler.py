@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+
+import shutil
+import subprocess
+from collections import Counter
+
+from flipper.app import App
+from flipper.storage import FlipperStorage
+from flipper.utils.cdc import resolve_port
+
+
+class Main(App):
+    # Collects `profiler sample` output and folds it into flame graph input
+    def init(self):
+        self.parser.add_argument("-p", "--port", help="CDC Port", default="auto")
+        self.parser.add_argument(
+            "-d", "--duration", help="Sampling duration, ms", type=int, default=5000
+        )
+        self.parser.add_argument(
+            "-f", "--frequency", help="Sampling frequency, Hz", type=int, default=1000
+        )
+        self.parser.add_argument(
+            "-e",
+            "--elf",
+            help="Firmware ELF to symbolize against",
+            default="build/latest/firmware.elf",
+        )
+        self.parser.add_argument(
+            "--addr2line", help="addr2line tool", default="arm-none-eabi-addr2line"
+        )
+        self.parser.add_argument(
+            "-o", "--output", help="Folded stacks output", default="profile.folded"
+        )
+        self.parser.set_defaults(func=self.profile)
+
+    def _collect(self, flipper: FlipperStorage):
+        duration = self.args.duration
+        flipper.port.timeout = duration / 1000 + 5
+        flipper.send(f"profiler sample {duration} {self.args.frequency}\r")
+
+        threads = {}
+        samples = []
+        dropped = 0
+        while True:
+            line = flipper.read.until(flipper.CLI_EOL).decode("ascii", "replace")
+            if line.startswith("T "):
+                _, thread_id, name = line.split(" ", 2)
+                threads[int(thread_id, 16)] = name
+            elif line.startswith("S "):
+                _, thread_id, pc, lr = line.split(" ")
+                samples.append((int(thread_id, 16), int(pc, 16), int(lr, 16)))
+            elif line.startswith("I "):
+                _, _, name = line.split(" ", 2)
+                samples.append((None, name, None))
+            elif line.startswith("D "):
+                dropped = int(line[2:])
+                break
+            elif line.startswith("Usage") or line.startswith("Sampling timer"):
+                self.logger.error(line)
+                break
+
+        flipper.read.until(flipper.CLI_PROMPT)
+        return threads, samples, dropped
+
+    def _symbolize(self, addresses):
+        tool = shutil.which(self.args.addr2line)
+        if not tool:
+            self.logger.warning(f"{self.args.addr2line} not found, using raw addresses")
+            return {address: f"0x{address:08x}" for address in addresses}
+
+        addresses = sorted(addresses)
+        result = subprocess.run(
+            [tool, "-f", "-e", self.args.elf]
+            + [f"0x{address:08x}" for address in addresses],
+            capture_output=True,
+            check=True,
+            text=True,
+        )
+        # Function name and location line per address
+        names = result.stdout.splitlines()[::2]
+        return {
+            address: name if name != "??" else f"0x{address:08x}"
+            for address, name in zip(addresses, names)
+        }
+
+    def profile(self):
+        if not (port := resolve_port(self.logger, self.args.port)):
+            return 1
+
+        with FlipperStorage(port) as flipper:
+            threads, samples, dropped = self._collect(flipper)
+
+        if not samples:
+            self.logger.error("No samples collected")
+            return 1
+
+        # Thumb bit cleared, return address pointed back into the call instruction
+        addresses = set()
+        for thread_id, pc, lr in samples:
+            if thread_id is None:
+                continue
+            addresses.add(pc & ~1)
+            # LR is a real return address only in leaf functions, EXC_RETURN is skipped
+            if lr < 0xF0000000:
+                addresses.add((lr & ~1) - 2)
+        symbols = self._symbolize(addresses)
+
+        stacks = Counter()
+        for thread_id, pc, lr in samples:
+            if thread_id is None:
+                stacks[f"[interrupt];{pc}"] += 1
+                continue
+            frames = [threads.get(thread_id, f"0x{thread_id:08x}")]
+            caller = symbols.get((lr & ~1) - 2)
+            function = symbols[pc & ~1]
+            if caller and caller != function:
+                frames.append(caller)
+            frames.append(function)
+            stacks[";".join(frames)] += 1
+
+        with open(self.args.output, "w") as output:
+            for stack, count in stacks.most_common():
+                output.write(f"{stack} {count}\n")
+
+        self.logger.info(
+            f"{len(samples)} samples, {dropped} dropped, written to {self.args.output}"
+        )
+        for stack, count in stacks.most_common(10):
+            self.logger.info(f"{count * 100 / len(samples):5.1f}% {stack}")
+
+        return 0
+
+
+if __name__ == "__main__":
+    Main()()
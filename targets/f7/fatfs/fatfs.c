@@ -18,6 +18,8 @@ DWORD get_fattime(void) {
     DateTime furi_time;
     furi_hal_rtc_get_datetime(&furi_time);
 
+    // Seconds are stored with 2 second resolution
     return ((uint32_t)(furi_time.year - 1980) << 25) | furi_time.month << 21 |
-           furi_time.day << 16 | furi_time.hour << 11 | furi_time.minute << 5 | furi_time.second;
+           furi_time.day << 16 | furi_time.hour << 11 | furi_time.minute << 5 |
+           furi_time.second / 2;
 }
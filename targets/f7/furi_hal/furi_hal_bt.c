@@ -2,6 +2,7 @@
 #include <core/check.h>
 #include <gap.h>
 #include <furi_hal_bt.h>
+#include <furi_hal_crc.h>
 #include <furi_ble/profile_interface.h>
 
 #include <ble/ble.h>
@@ -224,6 +225,9 @@ void furi_hal_bt_reinit(void) {
     // enterprise delay
     furi_delay_ms(100);
 
+    // CRC unit is shared with furi_hal_crc, no calculation may run while it is reset
+    furi_check(furi_hal_crc_acquire(FuriWaitForever));
+
     furi_hal_bus_disable(FuriHalBusHSEM);
     furi_hal_bus_disable(FuriHalBusIPCC);
     furi_hal_bus_disable(FuriHalBusAES2);
@@ -231,6 +235,7 @@ void furi_hal_bt_reinit(void) {
     furi_hal_bus_disable(FuriHalBusCRC);
 
     furi_hal_bt_init();
+    furi_hal_crc_release();
     furi_hal_bt_unlock_core2();
     furi_hal_bt_start_radio_stack();
     furi_hal_power_insomnia_exit();
@@ -0,0 +1,55 @@
+#include <furi_hal_crc.h>
+#include <furi_hal_bus.h>
+#include <furi.h>
+
+#include <stm32wbxx_ll_crc.h>
+
+static FuriMutex* furi_hal_crc_mutex = NULL;
+
+void furi_hal_crc_init(void) {
+    furi_hal_crc_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+}
+
+bool furi_hal_crc_acquire(uint32_t timeout) {
+    if(!furi_hal_crc_mutex || FURI_IS_ISR() || !furi_kernel_is_running()) {
+        return false;
+    }
+    return furi_mutex_acquire(furi_hal_crc_mutex, timeout) == FuriStatusOk;
+}
+
+void furi_hal_crc_release(void) {
+    furi_check(furi_mutex_get_owner(furi_hal_crc_mutex) == furi_thread_get_current_id());
+    furi_check(furi_mutex_release(furi_hal_crc_mutex) == FuriStatusOk);
+}
+
+bool furi_hal_crc_calc32(uint32_t* crc, const uint32_t* data, size_t words, uint32_t timeout) {
+    furi_check(crc);
+    furi_check(data || !words);
+    furi_check(((uintptr_t)data & 0x3U) == 0);
+
+    if(!furi_hal_crc_acquire(timeout)) {
+        return false;
+    }
+
+    // Bus is also enabled by BT HAL, so it is only enabled here if needed and never disabled
+    if(!furi_hal_bus_is_enabled(FuriHalBusCRC)) {
+        furi_hal_bus_enable(FuriHalBusCRC);
+    }
+
+    // Unit works MSB first, so reflected CRC is done by reversing words in and result out
+    LL_CRC_SetPolynomialSize(CRC, LL_CRC_POLYLENGTH_32B);
+    LL_CRC_SetPolynomialCoef(CRC, LL_CRC_DEFAULT_CRC32_POLY);
+    LL_CRC_SetInputDataReverseMode(CRC, LL_CRC_INDATA_REVERSE_WORD);
+    LL_CRC_SetOutputDataReverseMode(CRC, LL_CRC_OUTDATA_REVERSE_BIT);
+    LL_CRC_SetInitialData(CRC, __RBIT(~*crc));
+    LL_CRC_ResetCRCCalculationUnit(CRC);
+
+    for(size_t i = 0; i < words; i++) {
+        LL_CRC_FeedData32(CRC, data[i]);
+    }
+
+    *crc = ~LL_CRC_ReadData32(CRC);
+
+    furi_hal_crc_release();
+    return true;
+}
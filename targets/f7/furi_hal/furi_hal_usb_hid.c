@@ -308,6 +308,44 @@ bool furi_hal_hid_kb_release_all(void) {
     return hid_send_report(ReportIdKeyboard);
 }
 
+bool furi_hal_hid_kb_type(const uint16_t* buttons, size_t count) {
+    furi_check(buttons || count == 0);
+
+    // Typed keys take one free slot, held keys and modifiers are left as is
+    uint8_t slot = HID_KB_MAX_KEYS;
+    for(uint8_t key_nb = 0; key_nb < HID_KB_MAX_KEYS; key_nb++) {
+        if(hid_report.keyboard.boot.btn[key_nb] == 0) {
+            slot = key_nb;
+            break;
+        }
+    }
+    if(slot == HID_KB_MAX_KEYS) return false;
+
+    const uint8_t held_mods = hid_report.keyboard.boot.mods;
+    bool state = true;
+    for(size_t i = 0; (i < count) && state; i++) {
+        uint8_t key = buttons[i] & 0xFF;
+        if(key == HID_KEYBOARD_NONE) continue;
+
+        const uint8_t mods = held_mods | (buttons[i] >> 8);
+        if(hid_report.keyboard.boot.btn[slot] == key || hid_report.keyboard.boot.mods != mods) {
+            // Same key twice in a row or modifier change: release the previous key and set
+            // modifiers in a report of its own, hosts may apply them late otherwise
+            hid_report.keyboard.boot.btn[slot] = 0;
+            hid_report.keyboard.boot.mods = mods;
+            state = hid_send_report(ReportIdKeyboard);
+            if(!state) break;
+        }
+
+        hid_report.keyboard.boot.btn[slot] = key;
+        state = hid_send_report(ReportIdKeyboard);
+    }
+
+    hid_report.keyboard.boot.btn[slot] = 0;
+    hid_report.keyboard.boot.mods = held_mods;
+    return hid_send_report(ReportIdKeyboard) && state;
+}
+
 bool furi_hal_hid_mouse_move(int8_t dx, int8_t dy) {
     hid_report.mouse.x = dx;
     hid_report.mouse.y = dy;
@@ -40,6 +40,7 @@ struct STOP_EXTERNING_ME {};
 #include <furi_hal_serial.h>
 #include <furi_hal_info.h>
 #include <furi_hal_random.h>
+#include <furi_hal_crc.h>
 #include <furi_hal_target_hw.h>
 
 #ifdef __cplusplus
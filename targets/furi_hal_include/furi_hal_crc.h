@@ -0,0 +1,52 @@
+/**
+ * @file furi_hal_crc.h
+ * CRC calculation unit HAL API
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Initialize CRC HAL */
+void furi_hal_crc_init(void);
+
+/** Take exclusive ownership of CRC peripheral
+ *
+ * Anyone who resets, reconfigures or stops the clock of the peripheral must
+ * own it, so that no calculation is running at the same time.
+ *
+ * @param      timeout  lock timeout in ticks
+ *
+ * @return     true if acquired, false on timeout, in interrupt context or
+ *             before HAL is initialized
+ */
+bool furi_hal_crc_acquire(uint32_t timeout);
+
+/** Release CRC peripheral, must be called by the owner thread */
+void furi_hal_crc_release(void);
+
+/** Calculate CRC32 of word aligned data with CRC peripheral
+ *
+ * Result is the same as crc32_calc_buffer() gives: IEEE 802.3 polynomial,
+ * reflected input and output, inverted initial and final value.
+ *
+ * Peripheral is shared, calculation is not performed if it is busy for
+ * longer than timeout, in interrupt context or before HAL is initialized.
+ *
+ * @param[in,out]  crc      previous CRC value, 0 for new calculation
+ * @param          data     4 byte aligned data
+ * @param          words    data length in 32-bit words
+ * @param          timeout  peripheral lock timeout in ticks
+ *
+ * @return         true if calculated, crc is updated
+ */
+bool furi_hal_crc_calc32(uint32_t* crc, const uint32_t* data, size_t words, uint32_t timeout);
+
+#ifdef __cplusplus
+}
+#endif
@@ -5,6 +5,8 @@
 #include "hid_usage_consumer.h"
 #include "hid_usage_led.h"
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -227,6 +229,21 @@ bool furi_hal_hid_kb_release(uint16_t button);
  */
 bool furi_hal_hid_kb_release_all(void);
 
+/** Type a sequence of keys using as few HID reports as possible
+ *
+ * Each key is pressed in the same report that releases the previous one. An
+ * extra release report is sent between two presses of the same key and before
+ * a key with different modifiers, which are changed in that report. Keys held
+ * with furi_hal_hid_kb_press stay pressed. Reports are paced by the
+ * endpoint transfer completion, not by thread delays.
+ *
+ * @param      buttons  key codes, HID_KEYBOARD_NONE entries are skipped
+ * @param      count    number of key codes
+ *
+ * @return     true if all reports were sent
+ */
+bool furi_hal_hid_kb_type(const uint16_t* buttons, size_t count);
+
 /** Set mouse movement and send HID report
  *
  * @param      dx  x coordinate delta